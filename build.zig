@@ -47,6 +47,7 @@ pub fn build(b: *std.Build) void {
     zbcx.tests(b, target, optimize, test_step, test_filters);
     zdfs.tests(b, target, optimize, test_step, test_filters);
     zmsx.tests(b, target, optimize, test_step, test_filters);
+    test_step.dependOn(&cimgui.testDraw(b, target, optimize).step);
 
     const doc_step = b.step("doc", "Generate documentation");
     engine.doc(b, target, optimize, doc_step);
@@ -104,16 +105,53 @@ pub fn build(b: *std.Build) void {
     const run_demotest = b.addRunArtifact(demotest);
     run_demotest.has_side_effects = true;
     demotest_step.dependOn(&run_demotest.step);
+
+    const bench_imhash_step = b.step("bench-imhash", "Run Dear ImGui ID hashing micro-benchmark");
+    const bench_crc32c = b.option(
+        bool,
+        "imgui-crc32c",
+        "Benchmark Dear ImGui built with IMGUI_USE_CRC32C (changes IDs)",
+    ) orelse false;
+    bench_imhash_step.dependOn(&cimgui.benchHash(b, target, bench_crc32c).step);
+
+    const bench_imgui_step = b.step("bench-imgui", "Run Dear ImGui UI workload benchmarks");
+    bench_imgui_step.dependOn(&cimgui.benchUi(b, target, b.args).step);
+
+    const bench_zdfs_step = b.step("bench-zdfs", "Time serial and prefetching ZDFS mounts");
+    bench_zdfs_step.dependOn(&zdfs.bench(b, target, b.args).step);
 }
 
 pub const engine = struct {
     pub fn link(b: *std.Build, compile: *std.Build.Step.Compile, name: ?[]const u8) void {
-        compile.root_module.addImport(
-            name orelse "viletech",
-            b.addModule("viletech", .{
-                .root_source_file = b.path("engine/src/root.zig"),
-            }),
-        );
+        const module = b.addModule("viletech", .{
+            .root_source_file = b.path("engine/src/root.zig"),
+        });
+
+        module.addImport("deque", b.addModule("deque", .{
+            .root_source_file = b.path("depend/deque.zig"),
+        }));
+        module.addImport("jobpool", jobPool(b));
+
+        compile.root_module.addImport(name orelse "viletech", module);
+        compile.addIncludePath(b.path("engine/include"));
+    }
+
+    /// `engine/src/JobPool.zig` as a module of its own, so that libraries can
+    /// submit work to the engine's job pool without depending on the rest of
+    /// the engine. Created once per build, since a file can only belong to one
+    /// module of a compilation.
+    pub fn jobPool(b: *std.Build) *std.Build.Module {
+        if (b.modules.get("jobpool")) |module| return module;
+
+        const module = b.addModule("jobpool", .{
+            .root_source_file = b.path("engine/src/JobPool.zig"),
+        });
+
+        module.addImport("deque", b.addModule("deque", .{
+            .root_source_file = b.path("depend/deque.zig"),
+        }));
+
+        return module;
     }
 
     fn doc(
@@ -129,6 +167,11 @@ pub const engine = struct {
             .optimize = optimize,
         });
 
+        dummy.root_module.addImport("deque", b.addModule("deque", .{
+            .root_source_file = b.path("depend/deque.zig"),
+        }));
+        dummy.root_module.addImport("jobpool", jobPool(b));
+
         const install_docs = b.addInstallDirectory(.{
             .source_dir = dummy.getEmittedDocs(),
             .install_dir = .{ .custom = "docs" },
@@ -151,10 +194,31 @@ pub const engine = struct {
             .optimize = optimize,
         });
 
+        unit_tests.root_module.addImport("deque", b.addModule("deque", .{
+            .root_source_file = b.path("depend/deque.zig"),
+        }));
+
+        unit_tests.root_module.addImport("jobpool", jobPool(b));
+
         unit_tests.filters = filters;
 
         const run_unit_tests = b.addRunArtifact(unit_tests);
         test_step.dependOn(&run_unit_tests.step);
+
+        const jobpool_tests = b.addTest(.{
+            .root_source_file = b.path("engine/src/JobPool.zig"),
+            .target = target,
+            .optimize = optimize,
+        });
+
+        jobpool_tests.root_module.addImport("deque", b.addModule("deque", .{
+            .root_source_file = b.path("depend/deque.zig"),
+        }));
+
+        jobpool_tests.filters = filters;
+
+        const run_jobpool_tests = b.addRunArtifact(jobpool_tests);
+        test_step.dependOn(&run_jobpool_tests.step);
     }
 };
 
@@ -228,6 +292,8 @@ pub const subterra = struct {
             .root_source_file = b.path("libs/subterra/src/root.zig"),
         });
 
+        module.addImport("jobpool", engine.jobPool(b));
+
         const opts = b.addOptions();
         opts.addOption(bool, "znbx", config.znbx);
         compile.root_module.addOptions("cfg", opts);
@@ -254,6 +320,8 @@ pub const subterra = struct {
             .optimize = optimize,
         });
 
+        dummy.root_module.addImport("jobpool", engine.jobPool(b));
+
         const install_docs = b.addInstallDirectory(.{
             .source_dir = dummy.getEmittedDocs(),
             .install_dir = .{ .custom = "docs" },
@@ -298,6 +366,7 @@ pub const subterra = struct {
         opts.addOption([]const u8, "genmidi_sample", genmidi);
         opts.addOption(bool, "znbx", test_znbx);
         unit_tests.root_module.addOptions("cfg", opts);
+        unit_tests.root_module.addImport("jobpool", engine.jobPool(b));
 
         if (test_znbx) {
             znbx.link(b, unit_tests, .{
@@ -537,6 +606,8 @@ pub const zdfs = struct {
             .root_source_file = b.path("libs/zdfs/src/root.zig"),
         });
 
+        module.addImport("jobpool", engine.jobPool(b));
+
         compile.root_module.addImport(config.name, module);
     }
 
@@ -554,6 +625,7 @@ pub const zdfs = struct {
         });
 
         c.link(b, dummy, target, optimize);
+        dummy.root_module.addImport("jobpool", engine.jobPool(b));
 
         const install_docs = b.addInstallDirectory(.{
             .source_dir = dummy.getEmittedDocs(),
@@ -578,12 +650,36 @@ pub const zdfs = struct {
         });
 
         c.link(b, unit_tests, target, optimize);
+        unit_tests.root_module.addImport("jobpool", engine.jobPool(b));
 
         unit_tests.filters = filters;
 
         const run_unit_tests = b.addRunArtifact(unit_tests);
         test_step.dependOn(&run_unit_tests.step);
     }
+
+    /// Builds and runs `libs/zdfs/src/bench.zig` against the archives in `args`.
+    fn bench(
+        b: *std.Build,
+        target: std.Build.ResolvedTarget,
+        args: ?[]const []const u8,
+    ) *std.Build.Step.Run {
+        const exe = b.addExecutable(.{
+            .name = "zdfs-bench",
+            .root_source_file = b.path("libs/zdfs/src/bench.zig"),
+            .target = target,
+            // Timings of unoptimized builds are meaningless.
+            .optimize = .ReleaseFast,
+        });
+
+        link(b, exe, .{ .target = target, .optimize = .ReleaseFast });
+        exe.root_module.addImport("jobpool", engine.jobPool(b));
+
+        const run = b.addRunArtifact(exe);
+        run.has_side_effects = true;
+        if (args) |a| run.addArgs(a);
+        return run;
+    }
 };
 
 pub const zmsx = struct {
@@ -3,6 +3,7 @@
 const builtin = @import("builtin");
 const std = @import("std");
 const StreamWriter = std.io.BufferedWriter(4096, std.fs.File.Writer);
+const JobPool = @import("viletech").JobPool;
 
 const Doom = @import("Doom.zig");
 const Frontend = @import("Frontend.zig");
@@ -12,6 +13,8 @@ const Self = @This();
 comptime {
     // Don't smash the stack on a standard Windows thread.
     std.debug.assert(@sizeOf(Self) < (1024 * 1024));
+    // Link in the job pool's C API for the C and C++ code.
+    _ = JobPool.c_api;
 }
 
 pub const Scene = union(enum) {
@@ -33,6 +36,8 @@ pub const Transition = enum {
 };
 
 alloc: std.mem.Allocator,
+/// Shared by the whole process; also installed as `JobPool.global`.
+jobs: *JobPool,
 scene: Scene,
 
 stderr_file: std.fs.File.Writer,
@@ -46,8 +51,12 @@ pub fn init(alloc: std.mem.Allocator) !Self {
     const stderr_file = std.io.getStdErr().writer();
     const stdout_file = std.io.getStdOut().writer();
 
+    const jobs = try JobPool.create(alloc, .{});
+    JobPool.global.store(jobs, .release);
+
     return Self{
         .alloc = alloc,
+        .jobs = jobs,
         .scene = Scene{ .entry = {} },
         .transition = .entry_to_frontend,
         .stderr_file = stderr_file,
@@ -58,6 +67,10 @@ pub fn init(alloc: std.mem.Allocator) !Self {
 }
 
 pub fn deinit(self: *Self) !void {
+    // Jobs still running while the pool shuts down may use `global`.
+    self.jobs.destroy();
+    JobPool.global.store(null, .release);
+
     self.stdout_bw.flush() catch {};
     self.stderr_bw.flush() catch {};
 }
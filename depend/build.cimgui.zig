@@ -56,3 +56,114 @@ pub fn moduleLink(b: *std.Build, module: *std.Build.Module) void {
 
     module.addSystemIncludePath(b.path("depend/imgui"));
 }
+
+/// Builds and runs `imgui_bench_hash.cpp`, which verifies and times `ImHashStr`
+/// and `ImHashData` against a reference lookup table implementation.
+/// `crc32c` compiles Dear ImGui with `IMGUI_USE_CRC32C`.
+pub fn benchHash(
+    b: *std.Build,
+    target: std.Build.ResolvedTarget,
+    crc32c: bool,
+) *std.Build.Step.Run {
+    const exe = b.addExecutable(.{
+        .name = "imgui-bench-hash",
+        .target = target,
+        // Timings of unoptimized builds are meaningless.
+        .optimize = .ReleaseFast,
+    });
+
+    const flags: []const []const u8 = if (crc32c)
+        &.{ "--std=c++20", "-DIMGUI_USE_CRC32C" }
+    else
+        &.{"--std=c++20"};
+
+    exe.addCSourceFiles(.{
+        .root = b.path("depend/imgui"),
+        .flags = flags,
+        .files = &[_][]const u8{
+            "imgui_bench_hash.cpp",
+            "imgui_draw.cpp",
+            "imgui_tables.cpp",
+            "imgui_widgets.cpp",
+            "imgui.cpp",
+        },
+    });
+
+    exe.addIncludePath(b.path("depend/imgui"));
+    exe.linkLibCpp();
+
+    const run = b.addRunArtifact(exe);
+    run.has_side_effects = true;
+    return run;
+}
+
+/// Builds and runs `imgui_bench_ui.cpp`, which runs fixed UI workloads headless
+/// (clipped 100k-row table, 10k tree nodes, large `InputTextMultiline`, text wall,
+/// line-heavy canvas) and prints `NewFrame`/submission/`Render` timings, vertex/index
+/// counts and allocation counts per frame.
+/// `args` are forwarded to the benchmark to select workloads by name.
+pub fn benchUi(
+    b: *std.Build,
+    target: std.Build.ResolvedTarget,
+    args: ?[]const []const u8,
+) *std.Build.Step.Run {
+    const exe = b.addExecutable(.{
+        .name = "imgui-bench-ui",
+        .target = target,
+        // Timings of unoptimized builds are meaningless.
+        .optimize = .ReleaseFast,
+    });
+
+    exe.addCSourceFiles(.{
+        .root = b.path("depend/imgui"),
+        .flags = &.{"--std=c++20"},
+        .files = &[_][]const u8{
+            "imgui_bench_ui.cpp",
+            "imgui_draw.cpp",
+            "imgui_tables.cpp",
+            "imgui_widgets.cpp",
+            "imgui.cpp",
+        },
+    });
+
+    exe.addIncludePath(b.path("depend/imgui"));
+    exe.linkLibCpp();
+
+    const run = b.addRunArtifact(exe);
+    run.has_side_effects = true;
+    if (args) |a| run.addArgs(a);
+    return run;
+}
+
+/// Builds and runs `imgui_test_draw.cpp`, headless checks of `ImDrawList` output.
+/// The run fails if any check does.
+pub fn testDraw(
+    b: *std.Build,
+    target: std.Build.ResolvedTarget,
+    optimize: std.builtin.OptimizeMode,
+) *std.Build.Step.Run {
+    const exe = b.addExecutable(.{
+        .name = "imgui-test-draw",
+        .target = target,
+        .optimize = optimize,
+    });
+
+    exe.addCSourceFiles(.{
+        .root = b.path("depend/imgui"),
+        .flags = &.{"--std=c++20"},
+        .files = &[_][]const u8{
+            "imgui_test_draw.cpp",
+            "imgui_draw.cpp",
+            "imgui_tables.cpp",
+            "imgui_widgets.cpp",
+            "imgui.cpp",
+        },
+    });
+
+    exe.addIncludePath(b.path("depend/imgui"));
+    exe.linkLibCpp();
+
+    const run = b.addRunArtifact(exe);
+    run.expectExitCode(0);
+    return run;
+}
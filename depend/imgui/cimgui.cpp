@@ -1006,6 +1006,14 @@ CIMGUI_API void igPlotHistogram_FnFloatPtr(const char* label,float(*values_gette
 {
     return ImGui::PlotHistogram(label,values_getter,data,values_count,values_offset,overlay_text,scale_min,scale_max,graph_size);
 }
+CIMGUI_API void igPlotLines_PlotBufferPtr(const char* label,const ImGuiPlotBuffer* buffer,const char* overlay_text,float scale_min,float scale_max,ImVec2 graph_size)
+{
+    return ImGui::PlotLines(label,buffer,overlay_text,scale_min,scale_max,graph_size);
+}
+CIMGUI_API void igPlotHistogram_PlotBufferPtr(const char* label,const ImGuiPlotBuffer* buffer,const char* overlay_text,float scale_min,float scale_max,ImVec2 graph_size)
+{
+    return ImGui::PlotHistogram(label,buffer,overlay_text,scale_min,scale_max,graph_size);
+}
 CIMGUI_API void igValue_Bool(const char* prefix,bool b)
 {
     return ImGui::Value(prefix,b);
@@ -1464,10 +1472,30 @@ CIMGUI_API int igGetFrameCount()
 {
     return ImGui::GetFrameCount();
 }
+CIMGUI_API float igGetIdleWaitTime()
+{
+    return ImGui::GetIdleWaitTime();
+}
 CIMGUI_API ImDrawListSharedData* igGetDrawListSharedData()
 {
     return ImGui::GetDrawListSharedData();
 }
+CIMGUI_API ImDrawListSharedData* igCreateDrawListSharedData()
+{
+    return ImGui::CreateDrawListSharedData();
+}
+CIMGUI_API void igUpdateDrawListSharedData(ImDrawListSharedData* shared_data)
+{
+    return ImGui::UpdateDrawListSharedData(shared_data);
+}
+CIMGUI_API void igDestroyDrawListSharedData(ImDrawListSharedData* shared_data)
+{
+    return ImGui::DestroyDrawListSharedData(shared_data);
+}
+CIMGUI_API void igAddDrawListToWindow(ImDrawList* draw_list)
+{
+    return ImGui::AddDrawListToWindow(draw_list);
+}
 CIMGUI_API const char* igGetStyleColorName(ImGuiCol idx)
 {
     return ImGui::GetStyleColorName(idx);
@@ -1624,6 +1652,14 @@ CIMGUI_API const char* igSaveIniSettingsToMemory(size_t* out_ini_size)
 {
     return ImGui::SaveIniSettingsToMemory(out_ini_size);
 }
+CIMGUI_API bool igLoadIniSettingsFromBinary(const void* data,size_t data_size,size_t* out_valid_size)
+{
+    return ImGui::LoadIniSettingsFromBinary(data,data_size,out_valid_size);
+}
+CIMGUI_API const void* igSaveIniSettingsToBinary(size_t* out_size,bool only_dirty)
+{
+    return ImGui::SaveIniSettingsToBinary(out_size,only_dirty);
+}
 CIMGUI_API void igDebugTextEncoding(const char* text)
 {
     return ImGui::DebugTextEncoding(text);
@@ -1636,6 +1672,18 @@ CIMGUI_API void igDebugStartItemPicker()
 {
     return ImGui::DebugStartItemPicker();
 }
+CIMGUI_API void igDebugProfilerScopeBegin(const char* name)
+{
+    return ImGui::DebugProfilerScopeBegin(name);
+}
+CIMGUI_API void igDebugProfilerScopeEnd()
+{
+    return ImGui::DebugProfilerScopeEnd();
+}
+CIMGUI_API void igDebugSetProfilerHook(ImGuiProfilerHookCallback callback,void* user_data)
+{
+    return ImGui::DebugSetProfilerHook(callback,user_data);
+}
 CIMGUI_API bool igDebugCheckVersionAndDataLayout(const char* version_str,size_t sz_io,size_t sz_style,size_t sz_vec2,size_t sz_vec4,size_t sz_drawvert,size_t sz_drawidx)
 {
     return ImGui::DebugCheckVersionAndDataLayout(version_str,sz_io,sz_style,sz_vec2,sz_vec4,sz_drawvert,sz_drawidx);
@@ -1864,6 +1912,10 @@ CIMGUI_API bool ImGuiTextFilter_PassFilter(ImGuiTextFilter* self,const char* tex
 {
     return self->PassFilter(text,text_end);
 }
+CIMGUI_API bool ImGuiTextFilter_PassFilterCached(ImGuiTextFilter* self,ImGuiID key,const char* text,const char* text_end)
+{
+    return self->PassFilterCached(key,text,text_end);
+}
 CIMGUI_API void ImGuiTextFilter_Build(ImGuiTextFilter* self)
 {
     return self->Build();
@@ -1872,6 +1924,10 @@ CIMGUI_API void ImGuiTextFilter_Clear(ImGuiTextFilter* self)
 {
     return self->Clear();
 }
+CIMGUI_API void ImGuiTextFilter_ClearCache(ImGuiTextFilter* self)
+{
+    return self->ClearCache();
+}
 CIMGUI_API bool ImGuiTextFilter_IsActive(ImGuiTextFilter* self)
 {
     return self->IsActive();
@@ -1956,6 +2012,14 @@ CIMGUI_API ImGuiStoragePair* ImGuiStoragePair_ImGuiStoragePair_Ptr(ImGuiID _key,
 {
     return IM_NEW(ImGuiStoragePair)(_key,_val);
 }
+CIMGUI_API ImGuiStorage* ImGuiStorage_ImGuiStorage(void)
+{
+    return IM_NEW(ImGuiStorage)();
+}
+CIMGUI_API void ImGuiStorage_destroy(ImGuiStorage* self)
+{
+    IM_DELETE(self);
+}
 CIMGUI_API void ImGuiStorage_Clear(ImGuiStorage* self)
 {
     return self->Clear();
@@ -2012,10 +2076,50 @@ CIMGUI_API void ImGuiStorage_BuildSortByKey(ImGuiStorage* self)
 {
     return self->BuildSortByKey();
 }
+CIMGUI_API void ImGuiStorage_SetHashMapEnabled(ImGuiStorage* self,bool enabled)
+{
+    return self->SetHashMapEnabled(enabled);
+}
 CIMGUI_API void ImGuiStorage_SetAllInt(ImGuiStorage* self,int val)
 {
     return self->SetAllInt(val);
 }
+CIMGUI_API ImGuiListClipperHeights* ImGuiListClipperHeights_ImGuiListClipperHeights(void)
+{
+    return IM_NEW(ImGuiListClipperHeights)();
+}
+CIMGUI_API void ImGuiListClipperHeights_destroy(ImGuiListClipperHeights* self)
+{
+    IM_DELETE(self);
+}
+CIMGUI_API int ImGuiListClipperHeights_GetCount(ImGuiListClipperHeights* self)
+{
+    return self->GetCount();
+}
+CIMGUI_API float ImGuiListClipperHeights_GetHeight(ImGuiListClipperHeights* self,int n)
+{
+    return self->GetHeight(n);
+}
+CIMGUI_API void ImGuiListClipperHeights_Resize(ImGuiListClipperHeights* self,int count,float default_height)
+{
+    return self->Resize(count,default_height);
+}
+CIMGUI_API void ImGuiListClipperHeights_Build(ImGuiListClipperHeights* self,int count,float(*height_func)(void* user_data,int n),void* user_data)
+{
+    return self->Build(count,height_func,user_data);
+}
+CIMGUI_API void ImGuiListClipperHeights_SetHeight(ImGuiListClipperHeights* self,int n,float height)
+{
+    return self->SetHeight(n,height);
+}
+CIMGUI_API double ImGuiListClipperHeights_GetOffset(ImGuiListClipperHeights* self,int n)
+{
+    return self->GetOffset(n);
+}
+CIMGUI_API int ImGuiListClipperHeights_FindItemAtOffset(ImGuiListClipperHeights* self,double offset)
+{
+    return self->FindItemAtOffset(offset);
+}
 CIMGUI_API ImGuiListClipper* ImGuiListClipper_ImGuiListClipper(void)
 {
     return IM_NEW(ImGuiListClipper)();
@@ -2028,6 +2132,10 @@ CIMGUI_API void ImGuiListClipper_Begin(ImGuiListClipper* self,int items_count,fl
 {
     return self->Begin(items_count,items_height);
 }
+CIMGUI_API void ImGuiListClipper_BeginVariableHeight(ImGuiListClipper* self,ImGuiListClipperHeights* heights)
+{
+    return self->BeginVariableHeight(heights);
+}
 CIMGUI_API void ImGuiListClipper_End(ImGuiListClipper* self)
 {
     return self->End();
@@ -2044,6 +2152,66 @@ CIMGUI_API void ImGuiListClipper_IncludeItemsByIndex(ImGuiListClipper* self,int
 {
     return self->IncludeItemsByIndex(item_begin,item_end);
 }
+CIMGUI_API ImGuiTableSortIndex* ImGuiTableSortIndex_ImGuiTableSortIndex(void)
+{
+    return IM_NEW(ImGuiTableSortIndex)();
+}
+CIMGUI_API void ImGuiTableSortIndex_destroy(ImGuiTableSortIndex* self)
+{
+    IM_DELETE(self);
+}
+CIMGUI_API bool ImGuiTableSortIndex_Update(ImGuiTableSortIndex* self,ImGuiTableSortSpecs* sort_specs,int items_count)
+{
+    return self->Update(sort_specs,items_count);
+}
+CIMGUI_API void ImGuiTableSortIndex_Invalidate(ImGuiTableSortIndex* self)
+{
+    return self->Invalidate();
+}
+CIMGUI_API bool ImGuiTableSortIndex_IsSorting(ImGuiTableSortIndex* self)
+{
+    return self->IsSorting();
+}
+CIMGUI_API ImGuiPlotBuffer* ImGuiPlotBuffer_ImGuiPlotBuffer(int capacity)
+{
+    return IM_NEW(ImGuiPlotBuffer)(capacity);
+}
+CIMGUI_API void ImGuiPlotBuffer_destroy(ImGuiPlotBuffer* self)
+{
+    IM_DELETE(self);
+}
+CIMGUI_API int ImGuiPlotBuffer_GetCapacity(ImGuiPlotBuffer* self)
+{
+    return self->GetCapacity();
+}
+CIMGUI_API int ImGuiPlotBuffer_GetCount(ImGuiPlotBuffer* self)
+{
+    return self->GetCount();
+}
+CIMGUI_API float ImGuiPlotBuffer_GetValue(ImGuiPlotBuffer* self,int n)
+{
+    return self->GetValue(n);
+}
+CIMGUI_API void ImGuiPlotBuffer_SetCapacity(ImGuiPlotBuffer* self,int capacity)
+{
+    return self->SetCapacity(capacity);
+}
+CIMGUI_API void ImGuiPlotBuffer_Clear(ImGuiPlotBuffer* self)
+{
+    return self->Clear();
+}
+CIMGUI_API void ImGuiPlotBuffer_AddValue(ImGuiPlotBuffer* self,float v)
+{
+    return self->AddValue(v);
+}
+CIMGUI_API void ImGuiPlotBuffer_SetValue(ImGuiPlotBuffer* self,int n,float v)
+{
+    return self->SetValue(n,v);
+}
+CIMGUI_API void ImGuiPlotBuffer_GetMinMax(ImVec2 *pOut,ImGuiPlotBuffer* self,int n_begin,int n_end)
+{
+    *pOut = self->GetMinMax(n_begin,n_end);
+}
 CIMGUI_API ImColor* ImColor_ImColor_Nil(void)
 {
     return IM_NEW(ImColor)();
@@ -2104,10 +2272,18 @@ CIMGUI_API void ImDrawListSplitter_ClearFreeMemory(ImDrawListSplitter* self)
 {
     return self->ClearFreeMemory();
 }
+CIMGUI_API void ImDrawListSplitter_ClearFreeMemoryUnusedChannels(ImDrawListSplitter* self,int channels_keep)
+{
+    return self->ClearFreeMemoryUnusedChannels(channels_keep);
+}
 CIMGUI_API void ImDrawListSplitter_Split(ImDrawListSplitter* self,ImDrawList* draw_list,int count)
 {
     return self->Split(draw_list,count);
 }
+CIMGUI_API void ImDrawListSplitter_SplitSharedIndices(ImDrawListSplitter* self,ImDrawList* draw_list,int count)
+{
+    return self->SplitSharedIndices(draw_list,count);
+}
 CIMGUI_API void ImDrawListSplitter_Merge(ImDrawListSplitter* self,ImDrawList* draw_list)
 {
     return self->Merge(draw_list);
@@ -2116,6 +2292,14 @@ CIMGUI_API void ImDrawListSplitter_SetCurrentChannel(ImDrawListSplitter* self,Im
 {
     return self->SetCurrentChannel(draw_list,channel_idx);
 }
+CIMGUI_API ImDrawTextLayout* ImDrawTextLayout_ImDrawTextLayout(void)
+{
+    return IM_NEW(ImDrawTextLayout)();
+}
+CIMGUI_API void ImDrawTextLayout_destroy(ImDrawTextLayout* self)
+{
+    IM_DELETE(self);
+}
 CIMGUI_API ImDrawList* ImDrawList_ImDrawList(ImDrawListSharedData* shared_data)
 {
     return IM_NEW(ImDrawList)(shared_data);
@@ -2216,6 +2400,10 @@ CIMGUI_API void ImDrawList_AddText_FontPtr(ImDrawList* self,const ImFont* font,f
 {
     return self->AddText(font,font_size,pos,col,text_begin,text_end,wrap_width,cpu_fine_clip_rect);
 }
+CIMGUI_API void ImDrawList_AddTextCached(ImDrawList* self,ImGuiID layout_id,const ImFont* font,float font_size,const ImVec2 pos,ImU32 col,const char* text_begin,const char* text_end,float wrap_width)
+{
+    return self->AddTextCached(layout_id,font,font_size,pos,col,text_begin,text_end,wrap_width);
+}
 CIMGUI_API void ImDrawList_AddBezierCubic(ImDrawList* self,const ImVec2 p1,const ImVec2 p2,const ImVec2 p3,const ImVec2 p4,ImU32 col,float thickness,int num_segments)
 {
     return self->AddBezierCubic(p1,p2,p3,p4,col,thickness,num_segments);
@@ -2236,6 +2424,26 @@ CIMGUI_API void ImDrawList_AddConcavePolyFilled(ImDrawList* self,const ImVec2* p
 {
     return self->AddConcavePolyFilled(points,num_points,col);
 }
+CIMGUI_API void ImDrawList_AddLines(ImDrawList* self,const ImVec2* p1,const ImVec2* p2,int count,ImU32 col,float thickness,const ImU32* cols)
+{
+    return self->AddLines(p1,p2,count,col,thickness,cols);
+}
+CIMGUI_API void ImDrawList_AddLinesIndexed(ImDrawList* self,const ImVec2* points,const int* indices,int count,ImU32 col,float thickness,const ImU32* cols)
+{
+    return self->AddLinesIndexed(points,indices,count,col,thickness,cols);
+}
+CIMGUI_API void ImDrawList_AddRectsFilled(ImDrawList* self,const ImVec2* p_min,const ImVec2* p_max,int count,ImU32 col,const ImU32* cols)
+{
+    return self->AddRectsFilled(p_min,p_max,count,col,cols);
+}
+CIMGUI_API void ImDrawList_AddCircles(ImDrawList* self,const ImVec2* centers,const float* radii,int count,ImU32 col,int num_segments,float thickness,const ImU32* cols)
+{
+    return self->AddCircles(centers,radii,count,col,num_segments,thickness,cols);
+}
+CIMGUI_API void ImDrawList_AddCirclesFilled(ImDrawList* self,const ImVec2* centers,const float* radii,int count,ImU32 col,int num_segments,const ImU32* cols)
+{
+    return self->AddCirclesFilled(centers,radii,count,col,num_segments,cols);
+}
 CIMGUI_API void ImDrawList_AddImage(ImDrawList* self,ImTextureID user_texture_id,const ImVec2 p_min,const ImVec2 p_max,const ImVec2 uv_min,const ImVec2 uv_max,ImU32 col)
 {
     return self->AddImage(user_texture_id,p_min,p_max,uv_min,uv_max,col);
@@ -2360,6 +2568,10 @@ CIMGUI_API void ImDrawList__ClearFreeMemory(ImDrawList* self)
 {
     return self->_ClearFreeMemory();
 }
+CIMGUI_API void ImDrawList__ClearTextLayouts(ImDrawList* self)
+{
+    return self->_ClearTextLayouts();
+}
 CIMGUI_API void ImDrawList__PopUnusedDrawCmd(ImDrawList* self)
 {
     return self->_PopUnusedDrawCmd();
@@ -2640,6 +2852,10 @@ CIMGUI_API void ImFont_RenderText(ImFont* self,ImDrawList* draw_list,float size,
 {
     return self->RenderText(draw_list,size,pos,col,clip_rect,text_begin,text_end,wrap_width,cpu_fine_clip);
 }
+CIMGUI_API void ImFont_PreloadGlyphs(ImFont* self,const char* text_begin,const char* text_end)
+{
+    return self->PreloadGlyphs(text_begin,text_end);
+}
 CIMGUI_API void ImFont_BuildLookupTable(ImFont* self)
 {
     return self->BuildLookupTable();
@@ -2768,6 +2984,10 @@ CIMGUI_API const char* igImStristr(const char* haystack,const char* haystack_end
 {
     return ImStristr(haystack,haystack_end,needle,needle_end);
 }
+CIMGUI_API const char* igImStristrLowered(const char* haystack,const char* haystack_end,const char* needle,const char* needle_end)
+{
+    return ImStristrLowered(haystack,haystack_end,needle,needle_end);
+}
 CIMGUI_API void igImStrTrimBlanks(char* str)
 {
     return ImStrTrimBlanks(str);
@@ -2788,6 +3008,10 @@ CIMGUI_API char igImToUpper(char c)
 {
     return ImToUpper(c);
 }
+CIMGUI_API char igImToLower(char c)
+{
+    return ImToLower(c);
+}
 CIMGUI_API bool igImCharIsBlankA(char c)
 {
     return ImCharIsBlankA(c);
@@ -3263,6 +3487,30 @@ CIMGUI_API void ImBitVector_ClearBit(ImBitVector* self,int n)
 {
     return self->ClearBit(n);
 }
+CIMGUI_API ImFrameArena* ImFrameArena_ImFrameArena(void)
+{
+    return IM_NEW(ImFrameArena)();
+}
+CIMGUI_API void ImFrameArena_destroy(ImFrameArena* self)
+{
+    IM_DELETE(self);
+}
+CIMGUI_API void* ImFrameArena_Alloc(ImFrameArena* self,size_t sz,size_t align)
+{
+    return self->Alloc(sz,align);
+}
+CIMGUI_API void ImFrameArena_NewFrame(ImFrameArena* self)
+{
+    return self->NewFrame();
+}
+CIMGUI_API void ImFrameArena_ClearFreeMemory(ImFrameArena* self)
+{
+    return self->ClearFreeMemory();
+}
+CIMGUI_API size_t ImFrameArena_GetCapacity(ImFrameArena* self)
+{
+    return self->GetCapacity();
+}
 CIMGUI_API void ImGuiTextIndex_clear(ImGuiTextIndex* self)
 {
     return self->clear();
@@ -3395,6 +3643,10 @@ CIMGUI_API void ImGuiInputTextState_OnKeyPressed(ImGuiInputTextState* self,int k
 {
     return self->OnKeyPressed(key);
 }
+CIMGUI_API void ImGuiInputTextState_OnCharPressed(ImGuiInputTextState* self,unsigned int c)
+{
+    return self->OnCharPressed(c);
+}
 CIMGUI_API void ImGuiInputTextState_CursorAnimReset(ImGuiInputTextState* self)
 {
     return self->CursorAnimReset();
@@ -3731,6 +3983,14 @@ CIMGUI_API void ImGuiDebugAllocInfo_destroy(ImGuiDebugAllocInfo* self)
 {
     IM_DELETE(self);
 }
+CIMGUI_API ImGuiProfiler* ImGuiProfiler_ImGuiProfiler(void)
+{
+    return IM_NEW(ImGuiProfiler)();
+}
+CIMGUI_API void ImGuiProfiler_destroy(ImGuiProfiler* self)
+{
+    IM_DELETE(self);
+}
 CIMGUI_API ImGuiStackLevelInfo* ImGuiStackLevelInfo_ImGuiStackLevelInfo(void)
 {
     return IM_NEW(ImGuiStackLevelInfo)();
@@ -4103,6 +4363,18 @@ CIMGUI_API ImGuiSettingsHandler* igFindSettingsHandler(const char* type_name)
 {
     return ImGui::FindSettingsHandler(type_name);
 }
+CIMGUI_API ImGuiSettingsHandler* igFindSettingsHandlerByHash(ImGuiID type_hash)
+{
+    return ImGui::FindSettingsHandlerByHash(type_hash);
+}
+CIMGUI_API bool igLoadIniSettingsFromDiskBinary(const char* filename)
+{
+    return ImGui::LoadIniSettingsFromDiskBinary(filename);
+}
+CIMGUI_API void igSaveIniSettingsToDiskBinary(const char* filename)
+{
+    return ImGui::SaveIniSettingsToDiskBinary(filename);
+}
 CIMGUI_API ImGuiWindowSettings* igCreateNewWindowSettings(const char* name)
 {
     return ImGui::CreateNewWindowSettings(name);
@@ -5047,6 +5319,10 @@ CIMGUI_API void igTableGcCompactTransientBuffers_TableTempDataPtr(ImGuiTableTemp
 {
     return ImGui::TableGcCompactTransientBuffers(table);
 }
+CIMGUI_API void igTableGcCompactUnusedDrawChannels(ImGuiTableTempData* table)
+{
+    return ImGui::TableGcCompactUnusedDrawChannels(table);
+}
 CIMGUI_API void igTableGcCompactSettings()
 {
     return ImGui::TableGcCompactSettings();
@@ -5403,6 +5679,10 @@ CIMGUI_API int igPlotEx(ImGuiPlotType plot_type,const char* label,float(*values_
 {
     return ImGui::PlotEx(plot_type,label,values_getter,data,values_count,values_offset,overlay_text,scale_min,scale_max,size_arg);
 }
+CIMGUI_API int igPlotBufferEx(ImGuiPlotType plot_type,const char* label,const ImGuiPlotBuffer* buffer,const char* overlay_text,float scale_min,float scale_max,const ImVec2 size_arg)
+{
+    return ImGui::PlotBufferEx(plot_type,label,buffer,overlay_text,scale_min,scale_max,size_arg);
+}
 CIMGUI_API void igShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list,int vert_start_idx,int vert_end_idx,ImVec2 gradient_p0,ImVec2 gradient_p1,ImU32 col0,ImU32 col1)
 {
     return ImGui::ShadeVertsLinearColorGradientKeepAlpha(draw_list,vert_start_idx,vert_end_idx,gradient_p0,gradient_p1,col0,col1);
@@ -5415,6 +5695,10 @@ CIMGUI_API void igShadeVertsTransformPos(ImDrawList* draw_list,int vert_start_id
 {
     return ImGui::ShadeVertsTransformPos(draw_list,vert_start_idx,vert_end_idx,pivot_in,cos_a,sin_a,pivot_out);
 }
+CIMGUI_API void* igMemAllocFrame(size_t size)
+{
+    return ImGui::MemAllocFrame(size);
+}
 CIMGUI_API void igGcCompactTransientMiscBuffers()
 {
     return ImGui::GcCompactTransientMiscBuffers();
@@ -5618,6 +5902,18 @@ CIMGUI_API void igImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[2
 {
     return ImFontAtlasBuildMultiplyRectAlpha8(table,pixels,x,y,w,h,stride);
 }
+CIMGUI_API void igImFontAtlasBuildDynamicGlyph(ImFontAtlas* atlas,ImFont* font,ImFontGlyph* glyph)
+{
+    return ImFontAtlasBuildDynamicGlyph(atlas,font,glyph);
+}
+CIMGUI_API void igImFontAtlasBuildDynamicNewFrame(ImFontAtlas* atlas)
+{
+    return ImFontAtlasBuildDynamicNewFrame(atlas);
+}
+CIMGUI_API void igImFontAtlasBuildDynamicDestroy(ImFontAtlas* atlas)
+{
+    return ImFontAtlasBuildDynamicDestroy(atlas);
+}
 
 
 
@@ -47,6 +47,7 @@ typedef struct ImDrawData ImDrawData;
 typedef struct ImDrawList ImDrawList;
 typedef struct ImDrawListSharedData ImDrawListSharedData;
 typedef struct ImDrawListSplitter ImDrawListSplitter;
+typedef struct ImDrawTextLayout ImDrawTextLayout;
 typedef struct ImDrawVert ImDrawVert;
 typedef struct ImFont ImFont;
 typedef struct ImFontAtlas ImFontAtlas;
@@ -60,17 +61,20 @@ typedef struct ImGuiIO ImGuiIO;
 typedef struct ImGuiInputTextCallbackData ImGuiInputTextCallbackData;
 typedef struct ImGuiKeyData ImGuiKeyData;
 typedef struct ImGuiListClipper ImGuiListClipper;
+typedef struct ImGuiListClipperHeights ImGuiListClipperHeights;
 typedef struct ImGuiOnceUponAFrame ImGuiOnceUponAFrame;
 typedef struct ImGuiPayload ImGuiPayload;
 typedef struct ImGuiPlatformIO ImGuiPlatformIO;
 typedef struct ImGuiPlatformMonitor ImGuiPlatformMonitor;
 typedef struct ImGuiPlatformImeData ImGuiPlatformImeData;
+typedef struct ImGuiPlotBuffer ImGuiPlotBuffer;
 typedef struct ImGuiSizeCallbackData ImGuiSizeCallbackData;
 typedef struct ImGuiStorage ImGuiStorage;
 typedef struct ImGuiStoragePair ImGuiStoragePair;
 typedef struct ImGuiStyle ImGuiStyle;
 typedef struct ImGuiTableSortSpecs ImGuiTableSortSpecs;
 typedef struct ImGuiTableColumnSortSpecs ImGuiTableColumnSortSpecs;
+typedef struct ImGuiTableSortIndex ImGuiTableSortIndex;
 typedef struct ImGuiTextBuffer ImGuiTextBuffer;
 typedef struct ImGuiTextFilter ImGuiTextFilter;
 typedef struct ImGuiViewport ImGuiViewport;
@@ -95,12 +99,14 @@ typedef struct ImGuiMenuColumns ImGuiMenuColumns;
 typedef struct ImGuiNavItemData ImGuiNavItemData;
 typedef struct ImGuiNavTreeNodeData ImGuiNavTreeNodeData;
 typedef struct ImGuiMetricsConfig ImGuiMetricsConfig;
+typedef struct ImGuiProfiler ImGuiProfiler;
 typedef struct ImGuiNextWindowData ImGuiNextWindowData;
 typedef struct ImGuiNextItemData ImGuiNextItemData;
 typedef struct ImGuiOldColumnData ImGuiOldColumnData;
 typedef struct ImGuiOldColumns ImGuiOldColumns;
 typedef struct ImGuiPopupData ImGuiPopupData;
 typedef struct ImGuiSettingsHandler ImGuiSettingsHandler;
+typedef struct ImGuiSettingsBinWriter ImGuiSettingsBinWriter;
 typedef struct ImGuiStackSizes ImGuiStackSizes;
 typedef struct ImGuiStyleMod ImGuiStyleMod;
 typedef struct ImGuiTabBar ImGuiTabBar;
@@ -135,6 +141,7 @@ struct ImDrawData;
 struct ImDrawList;
 struct ImDrawListSharedData;
 struct ImDrawListSplitter;
+struct ImDrawTextLayout;
 struct ImDrawVert;
 struct ImFont;
 struct ImFontAtlas;
@@ -204,8 +211,11 @@ typedef unsigned short ImWchar16;
 typedef ImWchar16 ImWchar;
 typedef int (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);
+typedef void (*ImGuiProfilerHookCallback)(void* user_data, const char* name, bool is_begin, ImU64 time_ns);
 typedef void* (*ImGuiMemAllocFunc)(size_t sz, void* user_data);
 typedef void (*ImGuiMemFreeFunc)(void* ptr, void* user_data);
+typedef int (*ImGuiTableSortCompareFunc)(void* user_data, const ImGuiTableSortSpecs* sort_specs, int lhs, int rhs);
+typedef void (*ImGuiParallelForFunc)(void* user_data, int jobs_count, void (*job_func)(void* job_data, int job_index), void* job_data);
 typedef struct ImVec2 ImVec2;
 struct ImVec2
 {
@@ -653,6 +663,8 @@ typedef enum {
     ImGuiBackendFlags_HasMouseCursors = 1 << 1,
     ImGuiBackendFlags_HasSetMousePos = 1 << 2,
     ImGuiBackendFlags_RendererHasVtxOffset = 1 << 3,
+    ImGuiBackendFlags_RendererHasTexUpdates = 1 << 4,
+    ImGuiBackendFlags_RendererHasGpuLines = 1 << 5,
     ImGuiBackendFlags_PlatformHasViewports = 1 << 10,
     ImGuiBackendFlags_HasMouseHoveredViewport=1 << 11,
     ImGuiBackendFlags_RendererHasViewports = 1 << 12,
@@ -970,6 +982,7 @@ struct ImGuiStyle
     float MouseCursorScale;
     bool AntiAliasedLines;
     bool AntiAliasedLinesUseTex;
+    bool AntiAliasedLinesUseGpu;
     bool AntiAliasedFill;
     float CurveTessellationTol;
     float CircleTessellationMaxError;
@@ -997,6 +1010,7 @@ struct ImGuiIO
     float DeltaTime;
     float IniSavingRate;
     const char* IniFilename;
+    const char* IniBinaryFilename;
     const char* LogFilename;
     void* UserData;
     ImFontAtlas*Fonts;
@@ -1151,12 +1165,6 @@ typedef struct ImGuiTextRange ImGuiTextRange;
 
 typedef struct ImVector_ImGuiTextRange {int Size;int Capacity;ImGuiTextRange* Data;} ImVector_ImGuiTextRange;
 
-struct ImGuiTextFilter
-{
-    char InputBuf[256];
-    ImVector_ImGuiTextRange Filters;
-    int CountGrep;
-};
 typedef struct ImGuiTextRange ImGuiTextRange;
 typedef struct ImVector_char {int Size;int Capacity;char* Data;} ImVector_char;
 
@@ -1171,9 +1179,33 @@ struct ImGuiStoragePair
 };
 typedef struct ImVector_ImGuiStoragePair {int Size;int Capacity;ImGuiStoragePair* Data;} ImVector_ImGuiStoragePair;
 
+typedef struct ImVector_int {int Size;int Capacity;int* Data;} ImVector_int;
+
 struct ImGuiStorage
 {
     ImVector_ImGuiStoragePair Data;
+    ImVector_int HashTable;
+    bool HashMapEnabled;
+};
+struct ImGuiTextFilter
+{
+    char InputBuf[256];
+    ImVector_ImGuiTextRange Filters;
+    int CountGrep;
+    char InputBufLower[256];
+    int Generation;
+    ImGuiStorage Cache;
+};
+typedef struct ImVector_float {int Size;int Capacity;float* Data;} ImVector_float;
+
+typedef struct ImVector_double {int Size;int Capacity;double* Data;} ImVector_double;
+
+struct ImGuiListClipperHeights
+{
+    ImVector_float Heights;
+    ImVector_double Tree;
+    int AnchorItem;
+    double AnchorOffset;
 };
 struct ImGuiListClipper
 {
@@ -1183,8 +1215,39 @@ struct ImGuiListClipper
     int ItemsCount;
     float ItemsHeight;
     float StartPosY;
+    ImGuiListClipperHeights* VariableHeights;
     void* TempData;
 };
+typedef struct ImVector_ImGuiTableColumnSortSpecs {int Size;int Capacity;ImGuiTableColumnSortSpecs* Data;} ImVector_ImGuiTableColumnSortSpecs;
+
+struct ImGuiTableSortIndex
+{
+    ImVector_int Order;
+    ImGuiTableSortCompareFunc CompareFunc;
+    void* CompareUserData;
+    ImGuiParallelForFunc ParallelFor;
+    void* ParallelForUserData;
+    int MaxItemsPerFrame;
+    int Generation;
+    int OrderGeneration;
+    ImVector_ImGuiTableColumnSortSpecs SpecsCopy;
+    ImGuiTableSortSpecs Specs;
+    ImVector_int SortBuf;
+    ImVector_int SortTmp;
+    int SortWidth;
+    int SortBlock;
+    bool WantSort;
+};
+typedef struct ImVector_ImVec2 {int Size;int Capacity;ImVec2* Data;} ImVector_ImVec2;
+
+struct ImGuiPlotBuffer
+{
+    ImVector_float Values;
+    ImVector_ImVec2 Tree;
+    int TreeSize;
+    int Count;
+    int Offset;
+};
 struct ImColor
 {
     ImVec4 Value;
@@ -1200,12 +1263,41 @@ struct ImDrawCmd
     ImDrawCallback UserCallback;
     void* UserCallbackData;
 };
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+typedef struct ImDrawVertPosComponent ImDrawVertPosComponent;
+struct ImDrawVertPosComponent
+{
+    ImS16 Value;
+};
+typedef struct ImDrawVertUvComponent ImDrawVertUvComponent;
+struct ImDrawVertUvComponent
+{
+    ImU16 Value;
+};
+typedef struct ImDrawVertPos ImDrawVertPos;
+struct ImDrawVertPos
+{
+    ImDrawVertPosComponent x, y;
+};
+typedef struct ImDrawVertUv ImDrawVertUv;
+struct ImDrawVertUv
+{
+    ImDrawVertUvComponent x, y;
+};
+struct ImDrawVert
+{
+    ImDrawVertPos pos;
+    ImDrawVertUv uv;
+    ImU32 col;
+};
+#else
 struct ImDrawVert
 {
     ImVec2 pos;
     ImVec2 uv;
     ImU32 col;
 };
+#endif
 typedef struct ImDrawCmdHeader ImDrawCmdHeader;
 struct ImDrawCmdHeader
 {
@@ -1229,6 +1321,7 @@ struct ImDrawListSplitter
     int _Current;
     int _Count;
     ImVector_ImDrawChannel _Channels;
+    bool _SharedIdx;
 };
 typedef enum {
     ImDrawFlags_None = 0,
@@ -1252,15 +1345,29 @@ typedef enum {
     ImDrawListFlags_AntiAliasedLinesUseTex = 1 << 1,
     ImDrawListFlags_AntiAliasedFill = 1 << 2,
     ImDrawListFlags_AllowVtxOffset = 1 << 3,
+    ImDrawListFlags_AntiAliasedLinesUseGpu = 1 << 4,
 }ImDrawListFlags_;
 typedef struct ImVector_ImDrawVert {int Size;int Capacity;ImDrawVert* Data;} ImVector_ImDrawVert;
 
-typedef struct ImVector_ImVec2 {int Size;int Capacity;ImVec2* Data;} ImVector_ImVec2;
+struct ImDrawTextLayout
+{
+    ImGuiID Key;
+    const ImFont* Font;
+    float FontSize;
+    float WrapWidth;
+    int TexGeneration;
+    int LastUsedFrame;
+    ImVec2 BoundsMin;
+    ImVec2 BoundsMax;
+    ImVector_ImDrawVert VtxBuffer;
+};
 
 typedef struct ImVector_ImVec4 {int Size;int Capacity;ImVec4* Data;} ImVector_ImVec4;
 
 typedef struct ImVector_ImTextureID {int Size;int Capacity;ImTextureID* Data;} ImVector_ImTextureID;
 
+typedef struct ImVector_ImDrawTextLayout {int Size;int Capacity;ImDrawTextLayout* Data;} ImVector_ImDrawTextLayout;
+
 struct ImDrawList
 {
     ImVector_ImDrawCmd CmdBuffer;
@@ -1278,6 +1385,9 @@ struct ImDrawList
     ImVector_ImTextureID _TextureIdStack;
     float _FringeScale;
     const char* _OwnerName;
+    ImVector_ImDrawTextLayout _TextLayouts;
+    ImGuiStorage _TextLayoutsMap;
+    int _TextLayoutsFrame;
 };
 typedef struct ImVector_ImDrawListPtr {int Size;int Capacity;ImDrawList** Data;} ImVector_ImDrawListPtr;
 
@@ -1341,11 +1451,18 @@ struct ImFontAtlasCustomRect
     ImVec2 GlyphOffset;
     ImFont* Font;
 };
+typedef struct ImFontAtlasTexRect ImFontAtlasTexRect;
+struct ImFontAtlasTexRect
+{
+    unsigned short X, Y;
+    unsigned short Width, Height;
+};
 typedef enum {
     ImFontAtlasFlags_None = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,
     ImFontAtlasFlags_NoMouseCursors = 1 << 1,
     ImFontAtlasFlags_NoBakedLines = 1 << 2,
+    ImFontAtlasFlags_DynamicGlyphs = 1 << 3,
 }ImFontAtlasFlags_;
 typedef struct ImVector_ImFontPtr {int Size;int Capacity;ImFont** Data;} ImVector_ImFontPtr;
 
@@ -1353,6 +1470,8 @@ typedef struct ImVector_ImFontAtlasCustomRect {int Size;int Capacity;ImFontAtlas
 
 typedef struct ImVector_ImFontConfig {int Size;int Capacity;ImFontConfig* Data;} ImVector_ImFontConfig;
 
+typedef struct ImVector_ImFontAtlasTexRect {int Size;int Capacity;ImFontAtlasTexRect* Data;} ImVector_ImFontAtlasTexRect;
+
 struct ImFontAtlas
 {
     ImFontAtlasFlags Flags;
@@ -1373,12 +1492,15 @@ struct ImFontAtlas
     ImVector_ImFontAtlasCustomRect CustomRects;
     ImVector_ImFontConfig ConfigData;
     ImVec4 TexUvLines[(63) + 1];
+    ImVector_ImFontAtlasTexRect TexDirtyRects;
+    int TexGeneration;
+    bool DynamicGlyphsQueued;
     const ImFontBuilderIO* FontBuilderIO;
     unsigned int FontBuilderFlags;
+    void* FontBuilderDynamicData;
     int PackIdMouseCursors;
     int PackIdLines;
 };
-typedef struct ImVector_float {int Size;int Capacity;float* Data;} ImVector_float;
 
 typedef struct ImVector_ImFontGlyph {int Size;int Capacity;ImFontGlyph* Data;} ImVector_ImFontGlyph;
 
@@ -1403,6 +1525,7 @@ struct ImFont
     float Ascent, Descent;
     int MetricsTotalSurface;
     ImU8 Used4kPagesMap[(0xFFFF +1)/4096/8];
+    const ImFontGlyph* AsciiGlyphs[128];
 };
 typedef enum {
     ImGuiViewportFlags_None = 0,
@@ -1508,12 +1631,14 @@ struct ImGuiMenuColumns;
 struct ImGuiNavItemData;
 struct ImGuiNavTreeNodeData;
 struct ImGuiMetricsConfig;
+struct ImGuiProfiler;
 struct ImGuiNextWindowData;
 struct ImGuiNextItemData;
 struct ImGuiOldColumnData;
 struct ImGuiOldColumns;
 struct ImGuiPopupData;
 struct ImGuiSettingsHandler;
+struct ImGuiSettingsBinWriter;
 struct ImGuiStackSizes;
 struct ImGuiStyleMod;
 struct ImGuiTabBar;
@@ -1563,7 +1688,7 @@ typedef struct StbUndoState StbUndoState;
 struct StbUndoState
 {
    StbUndoRecord undo_rec [99];
-   ImWchar undo_char[999];
+   char undo_char[999];
    short undo_point, redo_point;
    int undo_char_point, redo_char_point;
 };
@@ -1613,8 +1738,22 @@ struct ImBitVector
     ImVector_ImU32 Storage;
 };
 typedef int ImPoolIdx;
+typedef struct ImFrameArenaBlock ImFrameArenaBlock;
+struct ImFrameArenaBlock
+{
+    ImFrameArenaBlock* Next;
+    size_t Size;
+    size_t Used;
+};
+typedef struct ImFrameArena ImFrameArena;
+struct ImFrameArena
+{
+    ImFrameArenaBlock* Blocks[2];
+    size_t UsedBytes[2];
+    size_t PeakBytes;
+    int CurrIdx;
+};
 typedef struct ImGuiTextIndex ImGuiTextIndex;
-typedef struct ImVector_int {int Size;int Capacity;int* Data;} ImVector_int;
 
 struct ImGuiTextIndex
 {
@@ -1630,6 +1769,7 @@ struct ImDrawListSharedData
     float CircleSegmentMaxError;
     ImVec4 ClipRectFullscreen;
     ImDrawListFlags InitialFlags;
+    bool NoDynamicGlyphs;
     ImVector_ImVec2 TempBuffer;
     ImVec2 ArcFastVtx[48];
     float ArcFastRadiusCutoff;
@@ -1842,11 +1982,12 @@ struct ImGuiInputTextState
 {
     ImGuiContext* Ctx;
     ImGuiID ID;
-    int CurLenW, CurLenA;
-    ImVector_ImWchar TextW;
+    int CurLenA;
     ImVector_char TextA;
     ImVector_char InitialTextA;
-    bool TextAIsValid;
+    ImVector_char CallbackTextBackup;
+    const char* TextSrc;
+    ImVector_int LineStarts;
     int BufCapacityA;
     float ScrollX;
     STB_TexteditState Stb;
@@ -1854,6 +1995,7 @@ struct ImGuiInputTextState
     bool CursorFollow;
     bool SelectedAllMouseLock;
     bool Edited;
+    bool CallbackTextBackupValid;
     ImGuiInputTextFlags Flags;
     bool ReloadUserBuf;
     int ReloadSelectionStart;
@@ -2131,6 +2273,7 @@ struct ImGuiListClipperData
     float LossynessOffset;
     int StepNo;
     int ItemsFrozen;
+    int ItemsCursor;
     ImVector_ImGuiListClipperRange Ranges;
 };
 typedef enum {
@@ -2415,8 +2558,20 @@ struct ImGuiSettingsHandler
     void (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line);
     void (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);
     void (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);
+    void (*ReadBinFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const void* data, int data_size);
+    void (*WriteBinFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiSettingsBinWriter* out);
     void* UserData;
 };
+struct ImGuiSettingsBinWriter
+{
+    ImVector_char Buf;
+    ImGuiStorage Hashes;
+    const ImGuiStorage* PrevHashes;
+    ImGuiTextBuffer TextBuf;
+    ImGuiID TypeHash;
+    int RecordOffset;
+    int LiveSize;
+};
 typedef enum {
 ImGuiLocKey_VersionStr=0,
 ImGuiLocKey_TableSizeOne=1,
@@ -2466,6 +2621,47 @@ struct ImGuiDebugAllocInfo
     int TotalFreeCount;
     ImS16 LastEntriesIdx;
     ImGuiDebugAllocEntry LastEntriesBuf[6];
+    int NoAllocFramesCount;
+    int AssertAllocAfterFrames;
+    const void* OwnerThread;
+};
+typedef struct ImGuiProfilerEvent ImGuiProfilerEvent;
+struct ImGuiProfilerEvent
+{
+    const char* Name;
+    ImU64 StartNs;
+    ImU64 EndNs;
+    int Depth;
+};
+typedef struct ImGuiProfilerFrame ImGuiProfilerFrame;
+struct ImGuiProfilerFrame
+{
+    ImU64 StartNs;
+    float DurationMs;
+    float TopLevelMs;
+    float ScopeTimesMs[32];
+    int ScopeCalls[32];
+};
+typedef struct ImVector_ImGuiProfilerEvent {int Size;int Capacity;ImGuiProfilerEvent* Data;} ImVector_ImGuiProfilerEvent;
+
+struct ImGuiProfiler
+{
+    bool Enabled;
+    bool Paused;
+    ImGuiProfilerHookCallback HookCallback;
+    void* HookUserData;
+    const char* ScopeNames[32];
+    int ScopeNamesCount;
+    ImGuiProfilerFrame CurrentFrame;
+    ImGuiProfilerFrame Frames[120];
+    int FramesIdx;
+    int FramesCount;
+    ImVector_ImGuiProfilerEvent Stack;
+    ImVector_ImGuiProfilerEvent Events;
+    ImVector_ImGuiProfilerEvent EventsLastFrame;
+    ImU64 EventsLastFrameStartNs;
+    float EventsLastFrameDurationMs;
+    float TimelineZoom;
 };
 struct ImGuiMetricsConfig
 {
@@ -2577,6 +2773,7 @@ struct ImGuiContext
     float FontBaseSize;
     float CurrentDpiScale;
     ImDrawListSharedData DrawListSharedData;
+    int DrawListSharedDataCopiesCount;
     double Time;
     int FrameCount;
     int FrameCountEnded;
@@ -2595,7 +2792,6 @@ struct ImGuiContext
     ImU32 InputEventsNextEventId;
     ImVector_ImGuiWindowPtr Windows;
     ImVector_ImGuiWindowPtr WindowsFocusOrder;
-    ImVector_ImGuiWindowPtr WindowsTempSortBuffer;
     ImVector_ImGuiWindowStackData CurrentWindowStack;
     ImGuiStorage WindowsById;
     int WindowsActiveCount;
@@ -2816,6 +3012,9 @@ struct ImGuiContext
     bool SettingsLoaded;
     float SettingsDirtyTimer;
     ImGuiTextBuffer SettingsIniData;
+    ImGuiSettingsBinWriter SettingsBinData;
+    ImGuiStorage SettingsBinHashes;
+    int SettingsBinStoreSize;
     ImVector_ImGuiSettingsHandler SettingsHandlers;
     ImChunkStream_ImGuiWindowSettings SettingsWindows;
     ImChunkStream_ImGuiTableSettings SettingsTables;
@@ -2850,6 +3049,7 @@ struct ImGuiContext
     ImGuiMetricsConfig DebugMetricsConfig;
     ImGuiIDStackTool DebugIDStackTool;
     ImGuiDebugAllocInfo DebugAllocInfo;
+    ImGuiProfiler DebugProfiler;
     ImGuiDockNode* DebugHoveredDockNode;
     float FramerateSecPerFrame[60];
     int FramerateSecPerFrameIdx;
@@ -2859,6 +3059,7 @@ struct ImGuiContext
     int WantCaptureKeyboardNextFrame;
     int WantTextInputNextFrame;
     ImVector_char TempBuffer;
+    ImFrameArena FrameArena;
     char TempKeychordName[64];
 };
 struct ImGuiWindowTempData
@@ -2995,6 +3196,7 @@ struct ImGuiWindow
     int SettingsOffset;
     ImDrawList* DrawList;
     ImDrawList DrawListInst;
+    ImVector_ImDrawListPtr ExternalDrawLists;
     ImGuiWindow* ParentWindow;
     ImGuiWindow* ParentWindowInBeginStack;
     ImGuiWindow* RootWindow;
@@ -3164,8 +3366,6 @@ typedef struct ImSpan_ImGuiTableCellData {ImGuiTableCellData* Data;ImGuiTableCel
 
 typedef struct ImVector_ImGuiTableInstanceData {int Size;int Capacity;ImGuiTableInstanceData* Data;} ImVector_ImGuiTableInstanceData;
 
-typedef struct ImVector_ImGuiTableColumnSortSpecs {int Size;int Capacity;ImGuiTableColumnSortSpecs* Data;} ImVector_ImGuiTableColumnSortSpecs;
-
 struct ImGuiTable
 {
     ImGuiID ID;
@@ -3291,6 +3491,8 @@ struct ImGuiTableTempData
     ImVector_ImGuiTableHeaderData AngledHeadersRequests;
     ImVec2 UserOuterSize;
     ImDrawListSplitter DrawSplitter;
+    int DrawChannelsUsedMax;
+    float DrawChannelsGcTime;
     ImRect HostBackupWorkRect;
     ImRect HostBackupParentWorkRect;
     ImVec2 HostBackupPrevLineSize;
@@ -3328,6 +3530,7 @@ struct ImFontBuilderIO
 #define IMGUI_HAS_DOCK       1
 
 #define ImDrawCallback_ResetRenderState       (ImDrawCallback)(-8)
+#define ImDrawCallback_GpuLines               (ImDrawCallback)(-9)
 
 #else
 struct GLFWwindow;
@@ -3352,9 +3555,11 @@ typedef ImVector<ImDrawChannel> ImVector_ImDrawChannel;
 typedef ImVector<ImDrawCmd> ImVector_ImDrawCmd;
 typedef ImVector<ImDrawIdx> ImVector_ImDrawIdx;
 typedef ImVector<ImDrawList*> ImVector_ImDrawListPtr;
+typedef ImVector<ImDrawTextLayout> ImVector_ImDrawTextLayout;
 typedef ImVector<ImDrawVert> ImVector_ImDrawVert;
 typedef ImVector<ImFont*> ImVector_ImFontPtr;
 typedef ImVector<ImFontAtlasCustomRect> ImVector_ImFontAtlasCustomRect;
+typedef ImVector<ImFontAtlasTexRect> ImVector_ImFontAtlasTexRect;
 typedef ImVector<ImFontConfig> ImVector_ImFontConfig;
 typedef ImVector<ImFontGlyph> ImVector_ImFontGlyph;
 typedef ImVector<ImGuiColorMod> ImVector_ImGuiColorMod;
@@ -3374,6 +3579,7 @@ typedef ImVector<ImGuiOldColumnData> ImVector_ImGuiOldColumnData;
 typedef ImVector<ImGuiOldColumns> ImVector_ImGuiOldColumns;
 typedef ImVector<ImGuiPlatformMonitor> ImVector_ImGuiPlatformMonitor;
 typedef ImVector<ImGuiPopupData> ImVector_ImGuiPopupData;
+typedef ImVector<ImGuiProfilerEvent> ImVector_ImGuiProfilerEvent;
 typedef ImVector<ImGuiPtrOrIndex> ImVector_ImGuiPtrOrIndex;
 typedef ImVector<ImGuiSettingsHandler> ImVector_ImGuiSettingsHandler;
 typedef ImVector<ImGuiShrinkWidthItem> ImVector_ImGuiShrinkWidthItem;
@@ -3397,6 +3603,7 @@ typedef ImVector<ImVec4> ImVector_ImVec4;
 typedef ImVector<ImWchar> ImVector_ImWchar;
 typedef ImVector<char> ImVector_char;
 typedef ImVector<const char*> ImVector_const_charPtr;
+typedef ImVector<double> ImVector_double;
 typedef ImVector<float> ImVector_float;
 typedef ImVector<int> ImVector_int;
 typedef ImVector<unsigned char> ImVector_unsigned_char;
@@ -3639,6 +3846,8 @@ CIMGUI_API void igPlotLines_FloatPtr(const char* label,const float* values,int v
 CIMGUI_API void igPlotLines_FnFloatPtr(const char* label,float(*values_getter)(void* data,int idx),void* data,int values_count,int values_offset,const char* overlay_text,float scale_min,float scale_max,ImVec2 graph_size);
 CIMGUI_API void igPlotHistogram_FloatPtr(const char* label,const float* values,int values_count,int values_offset,const char* overlay_text,float scale_min,float scale_max,ImVec2 graph_size,int stride);
 CIMGUI_API void igPlotHistogram_FnFloatPtr(const char* label,float(*values_getter)(void* data,int idx),void* data,int values_count,int values_offset,const char* overlay_text,float scale_min,float scale_max,ImVec2 graph_size);
+CIMGUI_API void igPlotLines_PlotBufferPtr(const char* label,const ImGuiPlotBuffer* buffer,const char* overlay_text,float scale_min,float scale_max,ImVec2 graph_size);
+CIMGUI_API void igPlotHistogram_PlotBufferPtr(const char* label,const ImGuiPlotBuffer* buffer,const char* overlay_text,float scale_min,float scale_max,ImVec2 graph_size);
 CIMGUI_API void igValue_Bool(const char* prefix,bool b);
 CIMGUI_API void igValue_Int(const char* prefix,int v);
 CIMGUI_API void igValue_Uint(const char* prefix,unsigned int v);
@@ -3752,7 +3961,12 @@ CIMGUI_API bool igIsRectVisible_Nil(const ImVec2 size);
 CIMGUI_API bool igIsRectVisible_Vec2(const ImVec2 rect_min,const ImVec2 rect_max);
 CIMGUI_API double igGetTime(void);
 CIMGUI_API int igGetFrameCount(void);
+CIMGUI_API float igGetIdleWaitTime(void);
 CIMGUI_API ImDrawListSharedData* igGetDrawListSharedData(void);
+CIMGUI_API ImDrawListSharedData* igCreateDrawListSharedData(void);
+CIMGUI_API void igUpdateDrawListSharedData(ImDrawListSharedData* shared_data);
+CIMGUI_API void igDestroyDrawListSharedData(ImDrawListSharedData* shared_data);
+CIMGUI_API void igAddDrawListToWindow(ImDrawList* draw_list);
 CIMGUI_API const char* igGetStyleColorName(ImGuiCol idx);
 CIMGUI_API void igSetStateStorage(ImGuiStorage* storage);
 CIMGUI_API ImGuiStorage* igGetStateStorage(void);
@@ -3792,9 +4006,14 @@ CIMGUI_API void igLoadIniSettingsFromDisk(const char* ini_filename);
 CIMGUI_API void igLoadIniSettingsFromMemory(const char* ini_data,size_t ini_size);
 CIMGUI_API void igSaveIniSettingsToDisk(const char* ini_filename);
 CIMGUI_API const char* igSaveIniSettingsToMemory(size_t* out_ini_size);
+CIMGUI_API bool igLoadIniSettingsFromBinary(const void* data,size_t data_size,size_t* out_valid_size);
+CIMGUI_API const void* igSaveIniSettingsToBinary(size_t* out_size,bool only_dirty);
 CIMGUI_API void igDebugTextEncoding(const char* text);
 CIMGUI_API void igDebugFlashStyleColor(ImGuiCol idx);
 CIMGUI_API void igDebugStartItemPicker(void);
+CIMGUI_API void igDebugProfilerScopeBegin(const char* name);
+CIMGUI_API void igDebugProfilerScopeEnd(void);
+CIMGUI_API void igDebugSetProfilerHook(ImGuiProfilerHookCallback callback,void* user_data);
 CIMGUI_API bool igDebugCheckVersionAndDataLayout(const char* version_str,size_t sz_io,size_t sz_style,size_t sz_vec2,size_t sz_vec4,size_t sz_drawvert,size_t sz_drawidx);
 CIMGUI_API void igSetAllocatorFunctions(ImGuiMemAllocFunc alloc_func,ImGuiMemFreeFunc free_func,void* user_data);
 CIMGUI_API void igGetAllocatorFunctions(ImGuiMemAllocFunc* p_alloc_func,ImGuiMemFreeFunc* p_free_func,void** p_user_data);
@@ -3852,8 +4071,10 @@ CIMGUI_API ImGuiTextFilter* ImGuiTextFilter_ImGuiTextFilter(const char* default_
 CIMGUI_API void ImGuiTextFilter_destroy(ImGuiTextFilter* self);
 CIMGUI_API bool ImGuiTextFilter_Draw(ImGuiTextFilter* self,const char* label,float width);
 CIMGUI_API bool ImGuiTextFilter_PassFilter(ImGuiTextFilter* self,const char* text,const char* text_end);
+CIMGUI_API bool ImGuiTextFilter_PassFilterCached(ImGuiTextFilter* self,ImGuiID key,const char* text,const char* text_end);
 CIMGUI_API void ImGuiTextFilter_Build(ImGuiTextFilter* self);
 CIMGUI_API void ImGuiTextFilter_Clear(ImGuiTextFilter* self);
+CIMGUI_API void ImGuiTextFilter_ClearCache(ImGuiTextFilter* self);
 CIMGUI_API bool ImGuiTextFilter_IsActive(ImGuiTextFilter* self);
 CIMGUI_API ImGuiTextRange* ImGuiTextRange_ImGuiTextRange_Nil(void);
 CIMGUI_API void ImGuiTextRange_destroy(ImGuiTextRange* self);
@@ -3875,6 +4096,8 @@ CIMGUI_API ImGuiStoragePair* ImGuiStoragePair_ImGuiStoragePair_Int(ImGuiID _key,
 CIMGUI_API void ImGuiStoragePair_destroy(ImGuiStoragePair* self);
 CIMGUI_API ImGuiStoragePair* ImGuiStoragePair_ImGuiStoragePair_Float(ImGuiID _key,float _val);
 CIMGUI_API ImGuiStoragePair* ImGuiStoragePair_ImGuiStoragePair_Ptr(ImGuiID _key,void* _val);
+CIMGUI_API ImGuiStorage* ImGuiStorage_ImGuiStorage(void);
+CIMGUI_API void ImGuiStorage_destroy(ImGuiStorage* self);
 CIMGUI_API void ImGuiStorage_Clear(ImGuiStorage* self);
 CIMGUI_API int ImGuiStorage_GetInt(ImGuiStorage* self,ImGuiID key,int default_val);
 CIMGUI_API void ImGuiStorage_SetInt(ImGuiStorage* self,ImGuiID key,int val);
@@ -3889,14 +4112,40 @@ CIMGUI_API bool* ImGuiStorage_GetBoolRef(ImGuiStorage* self,ImGuiID key,bool def
 CIMGUI_API float* ImGuiStorage_GetFloatRef(ImGuiStorage* self,ImGuiID key,float default_val);
 CIMGUI_API void** ImGuiStorage_GetVoidPtrRef(ImGuiStorage* self,ImGuiID key,void* default_val);
 CIMGUI_API void ImGuiStorage_BuildSortByKey(ImGuiStorage* self);
+CIMGUI_API void ImGuiStorage_SetHashMapEnabled(ImGuiStorage* self,bool enabled);
 CIMGUI_API void ImGuiStorage_SetAllInt(ImGuiStorage* self,int val);
+CIMGUI_API ImGuiListClipperHeights* ImGuiListClipperHeights_ImGuiListClipperHeights(void);
+CIMGUI_API void ImGuiListClipperHeights_destroy(ImGuiListClipperHeights* self);
+CIMGUI_API int ImGuiListClipperHeights_GetCount(ImGuiListClipperHeights* self);
+CIMGUI_API float ImGuiListClipperHeights_GetHeight(ImGuiListClipperHeights* self,int n);
+CIMGUI_API void ImGuiListClipperHeights_Resize(ImGuiListClipperHeights* self,int count,float default_height);
+CIMGUI_API void ImGuiListClipperHeights_Build(ImGuiListClipperHeights* self,int count,float(*height_func)(void* user_data,int n),void* user_data);
+CIMGUI_API void ImGuiListClipperHeights_SetHeight(ImGuiListClipperHeights* self,int n,float height);
+CIMGUI_API double ImGuiListClipperHeights_GetOffset(ImGuiListClipperHeights* self,int n);
+CIMGUI_API int ImGuiListClipperHeights_FindItemAtOffset(ImGuiListClipperHeights* self,double offset);
 CIMGUI_API ImGuiListClipper* ImGuiListClipper_ImGuiListClipper(void);
 CIMGUI_API void ImGuiListClipper_destroy(ImGuiListClipper* self);
 CIMGUI_API void ImGuiListClipper_Begin(ImGuiListClipper* self,int items_count,float items_height);
+CIMGUI_API void ImGuiListClipper_BeginVariableHeight(ImGuiListClipper* self,ImGuiListClipperHeights* heights);
 CIMGUI_API void ImGuiListClipper_End(ImGuiListClipper* self);
 CIMGUI_API bool ImGuiListClipper_Step(ImGuiListClipper* self);
 CIMGUI_API void ImGuiListClipper_IncludeItemByIndex(ImGuiListClipper* self,int item_index);
 CIMGUI_API void ImGuiListClipper_IncludeItemsByIndex(ImGuiListClipper* self,int item_begin,int item_end);
+CIMGUI_API ImGuiTableSortIndex* ImGuiTableSortIndex_ImGuiTableSortIndex(void);
+CIMGUI_API void ImGuiTableSortIndex_destroy(ImGuiTableSortIndex* self);
+CIMGUI_API bool ImGuiTableSortIndex_Update(ImGuiTableSortIndex* self,ImGuiTableSortSpecs* sort_specs,int items_count);
+CIMGUI_API void ImGuiTableSortIndex_Invalidate(ImGuiTableSortIndex* self);
+CIMGUI_API bool ImGuiTableSortIndex_IsSorting(ImGuiTableSortIndex* self);
+CIMGUI_API ImGuiPlotBuffer* ImGuiPlotBuffer_ImGuiPlotBuffer(int capacity);
+CIMGUI_API void ImGuiPlotBuffer_destroy(ImGuiPlotBuffer* self);
+CIMGUI_API int ImGuiPlotBuffer_GetCapacity(ImGuiPlotBuffer* self);
+CIMGUI_API int ImGuiPlotBuffer_GetCount(ImGuiPlotBuffer* self);
+CIMGUI_API float ImGuiPlotBuffer_GetValue(ImGuiPlotBuffer* self,int n);
+CIMGUI_API void ImGuiPlotBuffer_SetCapacity(ImGuiPlotBuffer* self,int capacity);
+CIMGUI_API void ImGuiPlotBuffer_Clear(ImGuiPlotBuffer* self);
+CIMGUI_API void ImGuiPlotBuffer_AddValue(ImGuiPlotBuffer* self,float v);
+CIMGUI_API void ImGuiPlotBuffer_SetValue(ImGuiPlotBuffer* self,int n,float v);
+CIMGUI_API void ImGuiPlotBuffer_GetMinMax(ImVec2 *pOut,ImGuiPlotBuffer* self,int n_begin,int n_end);
 CIMGUI_API ImColor* ImColor_ImColor_Nil(void);
 CIMGUI_API void ImColor_destroy(ImColor* self);
 CIMGUI_API ImColor* ImColor_ImColor_Float(float r,float g,float b,float a);
@@ -3912,9 +4161,13 @@ CIMGUI_API ImDrawListSplitter* ImDrawListSplitter_ImDrawListSplitter(void);
 CIMGUI_API void ImDrawListSplitter_destroy(ImDrawListSplitter* self);
 CIMGUI_API void ImDrawListSplitter_Clear(ImDrawListSplitter* self);
 CIMGUI_API void ImDrawListSplitter_ClearFreeMemory(ImDrawListSplitter* self);
+CIMGUI_API void ImDrawListSplitter_ClearFreeMemoryUnusedChannels(ImDrawListSplitter* self,int channels_keep);
 CIMGUI_API void ImDrawListSplitter_Split(ImDrawListSplitter* self,ImDrawList* draw_list,int count);
+CIMGUI_API void ImDrawListSplitter_SplitSharedIndices(ImDrawListSplitter* self,ImDrawList* draw_list,int count);
 CIMGUI_API void ImDrawListSplitter_Merge(ImDrawListSplitter* self,ImDrawList* draw_list);
 CIMGUI_API void ImDrawListSplitter_SetCurrentChannel(ImDrawListSplitter* self,ImDrawList* draw_list,int channel_idx);
+CIMGUI_API ImDrawTextLayout* ImDrawTextLayout_ImDrawTextLayout(void);
+CIMGUI_API void ImDrawTextLayout_destroy(ImDrawTextLayout* self);
 CIMGUI_API ImDrawList* ImDrawList_ImDrawList(ImDrawListSharedData* shared_data);
 CIMGUI_API void ImDrawList_destroy(ImDrawList* self);
 CIMGUI_API void ImDrawList_PushClipRect(ImDrawList* self,const ImVec2 clip_rect_min,const ImVec2 clip_rect_max,bool intersect_with_current_clip_rect);
@@ -3940,11 +4193,17 @@ CIMGUI_API void ImDrawList_AddEllipse(ImDrawList* self,const ImVec2 center,const
 CIMGUI_API void ImDrawList_AddEllipseFilled(ImDrawList* self,const ImVec2 center,const ImVec2 radius,ImU32 col,float rot,int num_segments);
 CIMGUI_API void ImDrawList_AddText_Vec2(ImDrawList* self,const ImVec2 pos,ImU32 col,const char* text_begin,const char* text_end);
 CIMGUI_API void ImDrawList_AddText_FontPtr(ImDrawList* self,const ImFont* font,float font_size,const ImVec2 pos,ImU32 col,const char* text_begin,const char* text_end,float wrap_width,const ImVec4* cpu_fine_clip_rect);
+CIMGUI_API void ImDrawList_AddTextCached(ImDrawList* self,ImGuiID layout_id,const ImFont* font,float font_size,const ImVec2 pos,ImU32 col,const char* text_begin,const char* text_end,float wrap_width);
 CIMGUI_API void ImDrawList_AddBezierCubic(ImDrawList* self,const ImVec2 p1,const ImVec2 p2,const ImVec2 p3,const ImVec2 p4,ImU32 col,float thickness,int num_segments);
 CIMGUI_API void ImDrawList_AddBezierQuadratic(ImDrawList* self,const ImVec2 p1,const ImVec2 p2,const ImVec2 p3,ImU32 col,float thickness,int num_segments);
 CIMGUI_API void ImDrawList_AddPolyline(ImDrawList* self,const ImVec2* points,int num_points,ImU32 col,ImDrawFlags flags,float thickness);
 CIMGUI_API void ImDrawList_AddConvexPolyFilled(ImDrawList* self,const ImVec2* points,int num_points,ImU32 col);
 CIMGUI_API void ImDrawList_AddConcavePolyFilled(ImDrawList* self,const ImVec2* points,int num_points,ImU32 col);
+CIMGUI_API void ImDrawList_AddLines(ImDrawList* self,const ImVec2* p1,const ImVec2* p2,int count,ImU32 col,float thickness,const ImU32* cols);
+CIMGUI_API void ImDrawList_AddLinesIndexed(ImDrawList* self,const ImVec2* points,const int* indices,int count,ImU32 col,float thickness,const ImU32* cols);
+CIMGUI_API void ImDrawList_AddRectsFilled(ImDrawList* self,const ImVec2* p_min,const ImVec2* p_max,int count,ImU32 col,const ImU32* cols);
+CIMGUI_API void ImDrawList_AddCircles(ImDrawList* self,const ImVec2* centers,const float* radii,int count,ImU32 col,int num_segments,float thickness,const ImU32* cols);
+CIMGUI_API void ImDrawList_AddCirclesFilled(ImDrawList* self,const ImVec2* centers,const float* radii,int count,ImU32 col,int num_segments,const ImU32* cols);
 CIMGUI_API void ImDrawList_AddImage(ImDrawList* self,ImTextureID user_texture_id,const ImVec2 p_min,const ImVec2 p_max,const ImVec2 uv_min,const ImVec2 uv_max,ImU32 col);
 CIMGUI_API void ImDrawList_AddImageQuad(ImDrawList* self,ImTextureID user_texture_id,const ImVec2 p1,const ImVec2 p2,const ImVec2 p3,const ImVec2 p4,const ImVec2 uv1,const ImVec2 uv2,const ImVec2 uv3,const ImVec2 uv4,ImU32 col);
 CIMGUI_API void ImDrawList_AddImageRounded(ImDrawList* self,ImTextureID user_texture_id,const ImVec2 p_min,const ImVec2 p_max,const ImVec2 uv_min,const ImVec2 uv_max,ImU32 col,float rounding,ImDrawFlags flags);
@@ -3976,6 +4235,7 @@ CIMGUI_API void ImDrawList_PrimWriteIdx(ImDrawList* self,ImDrawIdx idx);
 CIMGUI_API void ImDrawList_PrimVtx(ImDrawList* self,const ImVec2 pos,const ImVec2 uv,ImU32 col);
 CIMGUI_API void ImDrawList__ResetForNewFrame(ImDrawList* self);
 CIMGUI_API void ImDrawList__ClearFreeMemory(ImDrawList* self);
+CIMGUI_API void ImDrawList__ClearTextLayouts(ImDrawList* self);
 CIMGUI_API void ImDrawList__PopUnusedDrawCmd(ImDrawList* self);
 CIMGUI_API void ImDrawList__TryMergeDrawCmds(ImDrawList* self);
 CIMGUI_API void ImDrawList__OnChangedClipRect(ImDrawList* self);
@@ -4046,6 +4306,7 @@ CIMGUI_API void ImFont_CalcTextSizeA(ImVec2 *pOut,ImFont* self,float size,float
 CIMGUI_API const char* ImFont_CalcWordWrapPositionA(ImFont* self,float scale,const char* text,const char* text_end,float wrap_width);
 CIMGUI_API void ImFont_RenderChar(ImFont* self,ImDrawList* draw_list,float size,const ImVec2 pos,ImU32 col,ImWchar c);
 CIMGUI_API void ImFont_RenderText(ImFont* self,ImDrawList* draw_list,float size,const ImVec2 pos,ImU32 col,const ImVec4 clip_rect,const char* text_begin,const char* text_end,float wrap_width,bool cpu_fine_clip);
+CIMGUI_API void ImFont_PreloadGlyphs(ImFont* self,const char* text_begin,const char* text_end);
 CIMGUI_API void ImFont_BuildLookupTable(ImFont* self);
 CIMGUI_API void ImFont_ClearOutputData(ImFont* self);
 CIMGUI_API void ImFont_GrowIndex(ImFont* self,int new_size);
@@ -4078,11 +4339,13 @@ CIMGUI_API char* igImStrdupcpy(char* dst,size_t* p_dst_size,const char* str);
 CIMGUI_API const char* igImStrchrRange(const char* str_begin,const char* str_end,char c);
 CIMGUI_API const char* igImStreolRange(const char* str,const char* str_end);
 CIMGUI_API const char* igImStristr(const char* haystack,const char* haystack_end,const char* needle,const char* needle_end);
+CIMGUI_API const char* igImStristrLowered(const char* haystack,const char* haystack_end,const char* needle,const char* needle_end);
 CIMGUI_API void igImStrTrimBlanks(char* str);
 CIMGUI_API const char* igImStrSkipBlank(const char* str);
 CIMGUI_API int igImStrlenW(const ImWchar* str);
 CIMGUI_API const ImWchar* igImStrbolW(const ImWchar* buf_mid_line,const ImWchar* buf_begin);
 CIMGUI_API char igImToUpper(char c);
+CIMGUI_API char igImToLower(char c);
 CIMGUI_API bool igImCharIsBlankA(char c);
 CIMGUI_API bool igImCharIsBlankW(unsigned int c);
 CIMGUI_API int igImFormatString(char* buf,size_t buf_size,const char* fmt,...);
@@ -4200,6 +4463,12 @@ CIMGUI_API void ImBitVector_Clear(ImBitVector* self);
 CIMGUI_API bool ImBitVector_TestBit(ImBitVector* self,int n);
 CIMGUI_API void ImBitVector_SetBit(ImBitVector* self,int n);
 CIMGUI_API void ImBitVector_ClearBit(ImBitVector* self,int n);
+CIMGUI_API ImFrameArena* ImFrameArena_ImFrameArena(void);
+CIMGUI_API void ImFrameArena_destroy(ImFrameArena* self);
+CIMGUI_API void* ImFrameArena_Alloc(ImFrameArena* self,size_t sz,size_t align);
+CIMGUI_API void ImFrameArena_NewFrame(ImFrameArena* self);
+CIMGUI_API void ImFrameArena_ClearFreeMemory(ImFrameArena* self);
+CIMGUI_API size_t ImFrameArena_GetCapacity(ImFrameArena* self);
 CIMGUI_API void ImGuiTextIndex_clear(ImGuiTextIndex* self);
 CIMGUI_API int ImGuiTextIndex_size(ImGuiTextIndex* self);
 CIMGUI_API const char* ImGuiTextIndex_get_line_begin(ImGuiTextIndex* self,const char* base,int n);
@@ -4233,6 +4502,7 @@ CIMGUI_API void ImGuiInputTextState_ClearFreeMemory(ImGuiInputTextState* self);
 CIMGUI_API int ImGuiInputTextState_GetUndoAvailCount(ImGuiInputTextState* self);
 CIMGUI_API int ImGuiInputTextState_GetRedoAvailCount(ImGuiInputTextState* self);
 CIMGUI_API void ImGuiInputTextState_OnKeyPressed(ImGuiInputTextState* self,int key);
+CIMGUI_API void ImGuiInputTextState_OnCharPressed(ImGuiInputTextState* self,unsigned int c);
 CIMGUI_API void ImGuiInputTextState_CursorAnimReset(ImGuiInputTextState* self);
 CIMGUI_API void ImGuiInputTextState_CursorClamp(ImGuiInputTextState* self);
 CIMGUI_API bool ImGuiInputTextState_HasSelection(ImGuiInputTextState* self);
@@ -4317,6 +4587,8 @@ CIMGUI_API ImGuiSettingsHandler* ImGuiSettingsHandler_ImGuiSettingsHandler(void)
 CIMGUI_API void ImGuiSettingsHandler_destroy(ImGuiSettingsHandler* self);
 CIMGUI_API ImGuiDebugAllocInfo* ImGuiDebugAllocInfo_ImGuiDebugAllocInfo(void);
 CIMGUI_API void ImGuiDebugAllocInfo_destroy(ImGuiDebugAllocInfo* self);
+CIMGUI_API ImGuiProfiler* ImGuiProfiler_ImGuiProfiler(void);
+CIMGUI_API void ImGuiProfiler_destroy(ImGuiProfiler* self);
 CIMGUI_API ImGuiStackLevelInfo* ImGuiStackLevelInfo_ImGuiStackLevelInfo(void);
 CIMGUI_API void ImGuiStackLevelInfo_destroy(ImGuiStackLevelInfo* self);
 CIMGUI_API ImGuiIDStackTool* ImGuiIDStackTool_ImGuiIDStackTool(void);
@@ -4410,6 +4682,9 @@ CIMGUI_API void igClearIniSettings(void);
 CIMGUI_API void igAddSettingsHandler(const ImGuiSettingsHandler* handler);
 CIMGUI_API void igRemoveSettingsHandler(const char* type_name);
 CIMGUI_API ImGuiSettingsHandler* igFindSettingsHandler(const char* type_name);
+CIMGUI_API ImGuiSettingsHandler* igFindSettingsHandlerByHash(ImGuiID type_hash);
+CIMGUI_API bool igLoadIniSettingsFromDiskBinary(const char* filename);
+CIMGUI_API void igSaveIniSettingsToDiskBinary(const char* filename);
 CIMGUI_API ImGuiWindowSettings* igCreateNewWindowSettings(const char* name);
 CIMGUI_API ImGuiWindowSettings* igFindWindowSettingsByID(ImGuiID id);
 CIMGUI_API ImGuiWindowSettings* igFindWindowSettingsByWindow(ImGuiWindow* window);
@@ -4646,6 +4921,7 @@ CIMGUI_API void igTableSetColumnWidthAutoAll(ImGuiTable* table);
 CIMGUI_API void igTableRemove(ImGuiTable* table);
 CIMGUI_API void igTableGcCompactTransientBuffers_TablePtr(ImGuiTable* table);
 CIMGUI_API void igTableGcCompactTransientBuffers_TableTempDataPtr(ImGuiTableTempData* table);
+CIMGUI_API void igTableGcCompactUnusedDrawChannels(ImGuiTableTempData* table);
 CIMGUI_API void igTableGcCompactSettings(void);
 CIMGUI_API void igTableLoadSettings(ImGuiTable* table);
 CIMGUI_API void igTableSaveSettings(ImGuiTable* table);
@@ -4735,9 +5011,11 @@ CIMGUI_API void igColorTooltip(const char* text,const float* col,ImGuiColorEditF
 CIMGUI_API void igColorEditOptionsPopup(const float* col,ImGuiColorEditFlags flags);
 CIMGUI_API void igColorPickerOptionsPopup(const float* ref_col,ImGuiColorEditFlags flags);
 CIMGUI_API int igPlotEx(ImGuiPlotType plot_type,const char* label,float(*values_getter)(void* data,int idx),void* data,int values_count,int values_offset,const char* overlay_text,float scale_min,float scale_max,const ImVec2 size_arg);
+CIMGUI_API int igPlotBufferEx(ImGuiPlotType plot_type,const char* label,const ImGuiPlotBuffer* buffer,const char* overlay_text,float scale_min,float scale_max,const ImVec2 size_arg);
 CIMGUI_API void igShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list,int vert_start_idx,int vert_end_idx,ImVec2 gradient_p0,ImVec2 gradient_p1,ImU32 col0,ImU32 col1);
 CIMGUI_API void igShadeVertsLinearUV(ImDrawList* draw_list,int vert_start_idx,int vert_end_idx,const ImVec2 a,const ImVec2 b,const ImVec2 uv_a,const ImVec2 uv_b,bool clamp);
 CIMGUI_API void igShadeVertsTransformPos(ImDrawList* draw_list,int vert_start_idx,int vert_end_idx,const ImVec2 pivot_in,float cos_a,float sin_a,const ImVec2 pivot_out);
+CIMGUI_API void* igMemAllocFrame(size_t size);
 CIMGUI_API void igGcCompactTransientMiscBuffers(void);
 CIMGUI_API void igGcCompactTransientWindowBuffers(ImGuiWindow* window);
 CIMGUI_API void igGcAwakeTransientWindowBuffers(ImGuiWindow* window);
@@ -4788,6 +5066,9 @@ CIMGUI_API void igImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas,in
 CIMGUI_API void igImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas,int x,int y,int w,int h,const char* in_str,char in_marker_char,unsigned int in_marker_pixel_value);
 CIMGUI_API void igImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256],float in_multiply_factor);
 CIMGUI_API void igImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256],unsigned char* pixels,int x,int y,int w,int h,int stride);
+CIMGUI_API void igImFontAtlasBuildDynamicGlyph(ImFontAtlas* atlas,ImFont* font,ImFontGlyph* glyph);
+CIMGUI_API void igImFontAtlasBuildDynamicNewFrame(ImFontAtlas* atlas);
+CIMGUI_API void igImFontAtlasBuildDynamicDestroy(ImFontAtlas* atlas);
 
 
 /////////////////////////hand written functions
@@ -30,6 +30,28 @@ CIMGUI_API bool ImGui_ImplOpenGL3_CreateFontsTexture(void);
 CIMGUI_API void ImGui_ImplOpenGL3_DestroyFontsTexture(void);
 CIMGUI_API bool ImGui_ImplOpenGL3_CreateDeviceObjects(void);
 CIMGUI_API void ImGui_ImplOpenGL3_DestroyDeviceObjects(void);
+typedef int ImGui_ImplOpenGL3_Flags;
+typedef enum {
+    ImGui_ImplOpenGL3_Flags_None = 0,
+    ImGui_ImplOpenGL3_Flags_BufferStorage = 1 << 0,
+    ImGui_ImplOpenGL3_Flags_SingleUpload = 1 << 1,
+    ImGui_ImplOpenGL3_Flags_FontTextureRGBA32 = 1 << 2,
+    ImGui_ImplOpenGL3_Flags_RetainBuffers = 1 << 3,
+    ImGui_ImplOpenGL3_Flags_NoStateBackup = 1 << 4
+}ImGui_ImplOpenGL3_Flags_;
+CIMGUI_API void ImGui_ImplOpenGL3_SetFlags(ImGui_ImplOpenGL3_Flags flags);
+CIMGUI_API ImGui_ImplOpenGL3_Flags ImGui_ImplOpenGL3_GetFlags(void);
+CIMGUI_API bool ImGui_ImplOpenGL3_HasDrawDataChanged(ImDrawData* draw_data);
+typedef struct ImGui_ImplOpenGL3_AtlasImage ImGui_ImplOpenGL3_AtlasImage;
+struct ImGui_ImplOpenGL3_AtlasImage
+{
+    ImTextureID TexID;
+    ImVec2 Uv0, Uv1;
+    int Page, Shelf, X, Width;
+    unsigned int PageGeneration;
+};
+CIMGUI_API bool ImGui_ImplOpenGL3_AddAtlasImage(const void* rgba_pixels,int width,int height,ImGui_ImplOpenGL3_AtlasImage* out_image);
+CIMGUI_API void ImGui_ImplOpenGL3_RemoveAtlasImage(ImGui_ImplOpenGL3_AtlasImage* image);
 
 #endif
 #ifdef CIMGUI_USE_OPENGL2
@@ -69,6 +91,7 @@ CIMGUI_API bool ImGui_ImplSDL2_InitForOther(SDL_Window* window);
 CIMGUI_API void ImGui_ImplSDL2_Shutdown(void);
 CIMGUI_API void ImGui_ImplSDL2_NewFrame(void);
 CIMGUI_API bool ImGui_ImplSDL2_ProcessEvent(const SDL_Event* event);
+CIMGUI_API int ImGui_ImplSDL2_GetIdleTimeout(int max_timeout_ms);
 CIMGUI_API void ImGui_ImplSDL2_SetGamepadMode(ImGui_ImplSDL2_GamepadMode mode,struct _SDL_GameController** manual_gamepads_array,int manual_gamepads_count);
 
 #endif
@@ -1019,6 +1019,7 @@ CODE
 // System includes
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #include <stdint.h>     // intptr_t
+#include <time.h>       // clock_gettime
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -1125,7 +1126,7 @@ static void             SetCurrentWindow(ImGuiWindow* window);
 static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
 
-static void             AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
+static void             AddWindowToSortBuffer(ImGuiWindow** out_sorted_windows, int* out_sorted_count, ImGuiWindow* window);
 
 // Settings
 static void             WindowSettingsHandler_ClearAll(ImGuiContext*, ImGuiSettingsHandler*);
@@ -1133,6 +1134,9 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static void             WindowSettingsHandler_ReadBin(ImGuiContext*, ImGuiSettingsHandler*, const void* data, int data_size);
+static void             WindowSettingsHandler_WriteBin(ImGuiContext*, ImGuiSettingsHandler*, ImGuiSettingsBinWriter* out);
+static void             LoadIniSettingsLines(ImGuiContext* ctx, char* buf, char* buf_end);
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data_ctx);
@@ -1171,6 +1175,7 @@ static void             ErrorCheckEndFrameSanityChecks();
 static void             UpdateDebugToolItemPicker();
 static void             UpdateDebugToolStackQueries();
 static void             UpdateDebugToolFlashStyleColor();
+static void             UpdateDebugToolProfiler();
 
 // Inputs
 static void             UpdateKeyboardInputs();
@@ -1297,6 +1302,7 @@ ImGuiStyle::ImGuiStyle()
     MouseCursorScale            = 1.0f;             // Scale software rendered mouse cursor (when io.MouseDrawCursor is enabled). May be removed later.
     AntiAliasedLines            = true;             // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU.
     AntiAliasedLinesUseTex      = true;             // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
+    AntiAliasedLinesUseGpu      = false;            // Enable anti-aliased lines/borders expanded by the renderer on the GPU. Require backend to support ImGuiBackendFlags_RendererHasGpuLines.
     AntiAliasedFill             = true;             // Enable anti-aliased filled shapes (rounded rectangles, circles, etc.).
     CurveTessellationTol        = 1.25f;            // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     CircleTessellationMaxError  = 0.30f;            // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
@@ -1356,6 +1362,7 @@ ImGuiIO::ImGuiIO()
     DeltaTime = 1.0f / 60.0f;
     IniSavingRate = 5.0f;
     IniFilename = "imgui.ini"; // Important: "imgui.ini" is relative to current working dir, most apps will want to lock this to an absolute path (e.g. same path as executables).
+    IniBinaryFilename = NULL;
     LogFilename = "imgui_log.txt";
 #ifndef IMGUI_DISABLE_OBSOLETE_KEYIO
     for (int i = 0; i < ImGuiKey_COUNT; i++)
@@ -2017,6 +2024,62 @@ const char* ImStristr(const char* haystack, const char* haystack_end, const char
     return NULL;
 }
 
+#ifdef IMGUI_ENABLE_SSE
+static inline __m128i ImToLowerSSE(__m128i v)
+{
+    const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+    return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(32)));
+}
+#endif
+
+// Needle was lowered once by the caller (e.g. ImGuiTextFilter::Build()) so only the haystack needs folding.
+// With SSE, 16 candidate positions are tested at once by comparing the first and last characters of the needle.
+const char* ImStristrLowered(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
+{
+    if (!haystack_end)
+        haystack_end = haystack + strlen(haystack);
+    if (!needle_end)
+        needle_end = needle + strlen(needle);
+    const int needle_len = (int)(needle_end - needle);
+    if (needle_len == 0)
+        return haystack;
+    if (haystack_end - haystack < needle_len)
+        return NULL;
+
+    const char* last_start = haystack_end - needle_len;
+    const char* p = haystack;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needle_len - 1]);
+    for (; last_start - p >= 15; p += 16)
+    {
+        const __m128i block_first = ImToLowerSSE(_mm_loadu_si128((const __m128i*)p));
+        const __m128i block_last = ImToLowerSSE(_mm_loadu_si128((const __m128i*)(p + needle_len - 1)));
+        for (int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last))), n = 0; mask != 0; mask >>= 1, n++)
+        {
+            if ((mask & 1) == 0)
+                continue;
+            int i = 1;
+            while (i < needle_len - 1 && ImToLower(p[n + i]) == needle[i])
+                i++;
+            if (i >= needle_len - 1)
+                return p + n;
+        }
+    }
+#endif
+    for (; p <= last_start; p++)
+    {
+        if (ImToLower(*p) != needle[0])
+            continue;
+        int i = 1;
+        while (i < needle_len && ImToLower(p[i]) == needle[i])
+            i++;
+        if (i == needle_len)
+            return p;
+    }
+    return NULL;
+}
+
 // Trim str by offsetting contents when there's leading data + writing a \0 at the trailing position. We use this in situation where the cost is negligible.
 void ImStrTrimBlanks(char* buf)
 {
@@ -2137,6 +2200,71 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
+#if defined(IMGUI_ENABLE_SSE4_2_CRC32) || defined(IMGUI_ENABLE_ARM_CRC32)
+// Hardware CRC32 (or CRC32C with IMGUI_USE_CRC32C), 8 bytes at a time. Same (reflected) bit-ordering as the lookup table version.
+static inline ImU32 ImHashCrc32Update(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+#if defined(IMGUI_ENABLE_SSE4_2_CRC32) && (defined(__x86_64__) || defined(_M_X64))
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = (ImU32)_mm_crc32_u64(crc, v);
+    }
+#elif defined(IMGUI_ENABLE_SSE4_2_CRC32)
+    for (; data_size >= 4; data += 4, data_size -= 4)
+    {
+        ImU32 v;
+        memcpy(&v, data, 4);
+        crc = _mm_crc32_u32(crc, v);
+    }
+#else
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+#ifdef IMGUI_USE_CRC32C
+        crc = __crc32cd(crc, v);
+#else
+        crc = __crc32d(crc, v);
+#endif
+    }
+#endif
+    for (; data_size > 0; data++, data_size--)
+    {
+#if defined(IMGUI_ENABLE_SSE4_2_CRC32)
+        crc = _mm_crc32_u8(crc, *data);
+#elif defined(IMGUI_USE_CRC32C)
+        crc = __crc32cb(crc, *data);
+#else
+        crc = __crc32b(crc, *data);
+#endif
+    }
+    return crc;
+}
+
+ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
+{
+    return ~ImHashCrc32Update(~seed, (const unsigned char*)data_p, data_size);
+}
+
+// Same as the lookup table version below: as "###" resets the hash to the seed, we only need to hash from its last occurrence.
+ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
+{
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const char* data_end = data_p + data_size;
+    for (const char* p = data_p; (p = (const char*)memchr(p, '#', (size_t)(data_end - p))) != NULL; p++)
+        if (data_end - p >= 3 && p[1] == '#' && p[2] == '#')
+        {
+            data_size = (size_t)(data_end - p);
+            data_p = p;
+        }
+    return ~ImHashCrc32Update(~seed, (const unsigned char*)data_p, data_size);
+}
+
+#else
+
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -2207,6 +2335,8 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     return ~crc;
 }
 
+#endif // #if defined(IMGUI_ENABLE_SSE4_2_CRC32) || defined(IMGUI_ENABLE_ARM_CRC32)
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -2243,6 +2373,23 @@ bool    ImFileClose(ImFileHandle f)     { return fclose(f) == 0; }
 ImU64   ImFileGetSize(ImFileHandle f)   { long off = 0, sz = 0; return ((off = ftell(f)) != -1 && !fseek(f, 0, SEEK_END) && (sz = ftell(f)) != -1 && !fseek(f, off, SEEK_SET)) ? (ImU64)sz : (ImU64)-1; }
 ImU64   ImFileRead(void* data, ImU64 sz, ImU64 count, ImFileHandle f)           { return fread(data, (size_t)sz, (size_t)count, f); }
 ImU64   ImFileWrite(const void* data, ImU64 sz, ImU64 count, ImFileHandle f)    { return fwrite(data, (size_t)sz, (size_t)count, f); }
+
+// Replace 'dst' with 'src', atomically where the OS supports it.
+bool ImFileRename(const char* src, const char* dst)
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(__CYGWIN__)
+    // rename() fails on Windows when 'dst' exists.
+    const int src_wsize = ::MultiByteToWideChar(CP_UTF8, 0, src, -1, NULL, 0);
+    const int dst_wsize = ::MultiByteToWideChar(CP_UTF8, 0, dst, -1, NULL, 0);
+    ImVector<wchar_t> buf;
+    buf.resize(src_wsize + dst_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, src, -1, buf.Data, src_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, dst, -1, buf.Data + src_wsize, dst_wsize);
+    return ::MoveFileExW(buf.Data, buf.Data + src_wsize, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return rename(src, dst) == 0;
+#endif
+}
 #endif // #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 
 // Helper: Load file content into memory
@@ -2611,18 +2758,111 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+static inline ImU32 ImGuiStorageHashSlot(ImGuiID key, ImU32 mask)
+{
+    // Keys are generally already hashes, but scramble them anyway as nothing prevents users from using sequential keys
+    key ^= key >> 16;
+    key *= 0x85EBCA6Bu;
+    key ^= key >> 13;
+    return key & mask;
+}
+
+static void ImGuiStorageRebuildHashTable(ImGuiStorage* storage, int table_size)
+{
+    if (table_size == 0)
+    {
+        storage->HashTable.clear();
+        return;
+    }
+    storage->HashTable.resize(table_size);
+    memset(storage->HashTable.Data, 0xFF, (size_t)storage->HashTable.size_in_bytes()); // -1
+    const ImU32 mask = (ImU32)table_size - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        ImU32 slot = ImGuiStorageHashSlot(storage->Data.Data[n].key, mask);
+        while (storage->HashTable.Data[slot] != -1)
+            slot = (slot + 1) & mask;
+        storage->HashTable.Data[slot] = n;
+    }
+}
+
+// Find pair, return NULL if missing
+static ImGuiStoragePair* ImGuiStorageFindPair(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStoragePair* data = const_cast<ImGuiStoragePair*>(storage->Data.Data);
+    if (storage->HashMapEnabled)
+    {
+        if (storage->HashTable.Size == 0)
+            return NULL;
+        const ImU32 mask = (ImU32)storage->HashTable.Size - 1;
+        for (ImU32 slot = ImGuiStorageHashSlot(key, mask); ; slot = (slot + 1) & mask)
+        {
+            const int idx = storage->HashTable.Data[slot];
+            if (idx == -1)
+                return NULL;
+            if (data[idx].key == key)
+                return &data[idx];
+        }
+    }
+    ImGuiStoragePair* it = ImLowerBound(data, data + storage->Data.Size, key);
+    if (it == data + storage->Data.Size || it->key != key)
+        return NULL;
+    return it;
+}
+
+// Find pair, insert 'new_pair' if missing.
+// FIXME-OPT: Sorted insertion is O(N) (without hash map) - not too bad because it only happens on explicit interaction (maximum one a frame)
+static ImGuiStoragePair* ImGuiStorageFindOrAddPair(ImGuiStorage* storage, const ImGuiStoragePair& new_pair)
+{
+    if (storage->HashMapEnabled)
+    {
+        // Keep load factor <= 0.5
+        if ((storage->Data.Size + 1) * 2 > storage->HashTable.Size)
+            ImGuiStorageRebuildHashTable(storage, ImMax(16, ImUpperPowerOfTwo((storage->Data.Size + 1) * 2)));
+        const ImU32 mask = (ImU32)storage->HashTable.Size - 1;
+        ImU32 slot = ImGuiStorageHashSlot(new_pair.key, mask);
+        for (int idx; (idx = storage->HashTable.Data[slot]) != -1; slot = (slot + 1) & mask)
+            if (storage->Data.Data[idx].key == new_pair.key)
+                return &storage->Data.Data[idx];
+        storage->HashTable.Data[slot] = storage->Data.Size;
+        storage->Data.push_back(new_pair);
+        return &storage->Data.back();
+    }
+    ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + storage->Data.Size, new_pair.key);
+    if (it == storage->Data.end() || it->key != new_pair.key)
+        it = storage->Data.insert(it, new_pair);
+    return it;
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    if (HashMapEnabled)
+        ImGuiStorageRebuildHashTable(this, Data.Size > 0 ? ImMax(16, ImUpperPowerOfTwo(Data.Size * 2)) : 0);
+}
+
+void ImGuiStorage::SetHashMapEnabled(bool enabled)
+{
+    if (HashMapEnabled == enabled)
+        return;
+    HashMapEnabled = enabled;
+    if (enabled)
+    {
+        if (Data.Size > 0)
+            ImGuiStorageRebuildHashTable(this, ImMax(16, ImUpperPowerOfTwo(Data.Size * 2)));
+    }
+    else
+    {
+        HashTable.clear();
+        ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    }
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = ImGuiStorageFindPair(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2632,27 +2872,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = ImGuiStorageFindPair(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = ImGuiStorageFindPair(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &ImGuiStorageFindOrAddPair(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2662,28 +2895,17 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &ImGuiStorageFindOrAddPair(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &ImGuiStorageFindOrAddPair(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
-// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_i = val;
+    ImGuiStorageFindOrAddPair(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2693,20 +2915,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_f = val;
+    ImGuiStorageFindOrAddPair(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.end() || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_p = val;
+    ImGuiStorageFindOrAddPair(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2722,8 +2936,10 @@ void ImGuiStorage::SetAllInt(int v)
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
 ImGuiTextFilter::ImGuiTextFilter(const char* default_filter) //-V1077
 {
-    InputBuf[0] = 0;
+    InputBuf[0] = InputBufLower[0] = 0;
     CountGrep = 0;
+    Generation = 0;
+    Cache.SetHashMapEnabled(true);
     if (default_filter)
     {
         ImStrncpy(InputBuf, default_filter, IM_ARRAYSIZE(InputBuf));
@@ -2777,6 +2993,12 @@ void ImGuiTextFilter::Build()
         if (f.b[0] != '-')
             CountGrep += 1;
     }
+
+    // Lower the whole input once so PassFilter() only needs to fold item text
+    for (int n = 0; n < IM_ARRAYSIZE(InputBuf); n++)
+        if ((InputBufLower[n] = ImToLower(InputBuf[n])) == 0)
+            break;
+    Generation = (Generation % 0x3FFFFFFF) + 1;
 }
 
 bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
@@ -2786,21 +3008,25 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 
     if (text == NULL)
         text = "";
+    if (text_end == NULL)
+        text_end = text + strlen(text); // Measure once for all terms
 
     for (const ImGuiTextRange& f : Filters)
     {
         if (f.empty())
             continue;
+        const char* lower_b = InputBufLower + (f.b - InputBuf);
+        const char* lower_e = InputBufLower + (f.e - InputBuf);
         if (f.b[0] == '-')
         {
             // Subtract
-            if (ImStristr(text, text_end, f.b + 1, f.e) != NULL)
+            if (ImStristrLowered(text, text_end, lower_b + 1, lower_e) != NULL)
                 return false;
         }
         else
         {
             // Grep
-            if (ImStristr(text, text_end, f.b, f.e) != NULL)
+            if (ImStristrLowered(text, text_end, lower_b, lower_e) != NULL)
                 return true;
         }
     }
@@ -2812,6 +3038,19 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+bool ImGuiTextFilter::PassFilterCached(ImGuiID key, const char* text, const char* text_end)
+{
+    if (Filters.empty())
+        return true;
+
+    int* result = Cache.GetIntRef(key, 0);
+    if ((*result >> 1) == Generation)
+        return (*result & 1) != 0;
+    const bool pass = PassFilter(text, text_end);
+    *result = (Generation << 1) | (pass ? 1 : 0);
+    return pass;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
 //-----------------------------------------------------------------------------
@@ -2895,6 +3134,86 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
     EndOffset = ImMax(EndOffset, new_size);
 }
 
+// Block data starts after the header, rounded so it keeps the alignment of the allocation
+static const size_t IM_FRAME_ARENA_BLOCK_HEADER_SIZE = IM_MEMALIGN(sizeof(ImFrameArenaBlock), 16);
+
+void* ImFrameArena::Alloc(size_t sz, size_t align)
+{
+    IM_ASSERT(align > 0 && (align & (align - 1)) == 0);
+    ImFrameArenaBlock* block = Blocks[CurrIdx];
+    if (block != NULL)
+    {
+        char* block_data = (char*)block + IM_FRAME_ARENA_BLOCK_HEADER_SIZE;
+        const size_t off = (size_t)(IM_MEMALIGN((uintptr_t)(block_data + block->Used), align) - (uintptr_t)block_data);
+        if (off + sz <= block->Size)
+        {
+            block->Used = off + sz;
+            UsedBytes[CurrIdx] += sz;
+            return block_data + off;
+        }
+    }
+
+    // Chain a new block, at least twice as large as the previous one
+    const size_t block_size = ImMax(ImMax(sz + align, (size_t)IMGUI_FRAME_ARENA_MIN_BLOCK_SIZE), block ? block->Size * 2 : 0);
+    ImFrameArenaBlock* new_block = (ImFrameArenaBlock*)IM_ALLOC(IM_FRAME_ARENA_BLOCK_HEADER_SIZE + block_size);
+    new_block->Next = block;
+    new_block->Size = block_size;
+    new_block->Used = 0;
+    Blocks[CurrIdx] = new_block;
+    return Alloc(sz, align);
+}
+
+void ImFrameArena::NewFrame()
+{
+    PeakBytes = ImMax(PeakBytes, UsedBytes[CurrIdx]);
+    CurrIdx ^= 1;
+    UsedBytes[CurrIdx] = 0;
+    ImFrameArenaBlock* block = Blocks[CurrIdx];
+    if (block == NULL)
+        return;
+    if (block->Next != NULL)
+    {
+        // Coalesce into a single block large enough for everything this half held
+        size_t total_size = 0;
+        while (block != NULL)
+        {
+            ImFrameArenaBlock* next = block->Next;
+            total_size += block->Size;
+            IM_FREE(block);
+            block = next;
+        }
+        block = (ImFrameArenaBlock*)IM_ALLOC(IM_FRAME_ARENA_BLOCK_HEADER_SIZE + total_size);
+        block->Next = NULL;
+        block->Size = total_size;
+        Blocks[CurrIdx] = block;
+    }
+    block->Used = 0;
+}
+
+void ImFrameArena::ClearFreeMemory()
+{
+    for (int half = 0; half < 2; half++)
+    {
+        for (ImFrameArenaBlock* block = Blocks[half]; block != NULL; )
+        {
+            ImFrameArenaBlock* next = block->Next;
+            IM_FREE(block);
+            block = next;
+        }
+        Blocks[half] = NULL;
+        UsedBytes[half] = 0;
+    }
+}
+
+size_t ImFrameArena::GetCapacity() const
+{
+    size_t capacity = 0;
+    for (int half = 0; half < 2; half++)
+        for (ImFrameArenaBlock* block = Blocks[half]; block != NULL; block = block->Next)
+            capacity += block->Size;
+    return capacity;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 //-----------------------------------------------------------------------------
@@ -2931,7 +3250,7 @@ static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>&
     }
 }
 
-static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height)
+static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height, int row_increase = -1)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
     // FIXME: It is problematic that we have to do that here, because custom/equivalent end-user code would stumble on the same issue.
@@ -2950,7 +3269,8 @@ static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_
         if (table->IsInsideRow)
             ImGui::TableEndRow(table);
         table->RowPosY2 = window->DC.CursorPos.y;
-        const int row_increase = (int)((off_y / line_height) + 0.5f);
+        if (row_increase < 0)
+            row_increase = (int)((off_y / line_height) + 0.5f);
         //table->CurrentRow += row_increase; // Can't do without fixing TableEndRow()
         table->RowBgColorCounter += row_increase;
     }
@@ -2961,8 +3281,100 @@ static void ImGuiListClipper_SeekCursorForItem(ImGuiListClipper* clipper, int it
     // StartPosY starts from ItemsFrozen hence the subtraction
     // Perform the add and multiply with double to allow seeking through larger ranges
     ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
-    float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + (double)(item_n - data->ItemsFrozen) * clipper->ItemsHeight);
-    ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, clipper->ItemsHeight);
+    if (ImGuiListClipperHeights* heights = clipper->VariableHeights)
+    {
+        // Variable height: rows can't be inferred from the seek distance, pass the number of skipped items explicitly
+        float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + (heights->GetOffset(item_n) - heights->GetOffset(data->ItemsFrozen)));
+        float line_height = (item_n > 0) ? heights->GetHeight(item_n - 1) : clipper->ItemsHeight;
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, line_height, ImMax(item_n - data->ItemsCursor, 0));
+    }
+    else
+    {
+        float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + (double)(item_n - data->ItemsFrozen) * clipper->ItemsHeight);
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, clipper->ItemsHeight);
+    }
+    data->ItemsCursor = item_n;
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiListClipperHeights
+// Fenwick tree (binary indexed tree): Tree[i] holds the sum of Heights[i - (i & -i) .. i - 1].
+// Sums are accumulated in double so long lists don't drift.
+//-----------------------------------------------------------------------------
+
+static void ImGuiListClipperHeights_BuildTree(ImGuiListClipperHeights* heights)
+{
+    const int count = heights->Heights.Size;
+    heights->Tree.resize(count + 1);
+    heights->Tree.Data[0] = 0.0;
+    for (int i = 1; i <= count; i++)
+        heights->Tree.Data[i] = heights->Heights.Data[i - 1];
+    for (int i = 1; i <= count; i++)
+    {
+        const int parent = i + (i & -i);
+        if (parent <= count)
+            heights->Tree.Data[parent] += heights->Tree.Data[i];
+    }
+    if (heights->AnchorItem >= count)
+        heights->AnchorItem = -1;
+}
+
+void ImGuiListClipperHeights::Resize(int count, float default_height)
+{
+    IM_ASSERT(count >= 0);
+    const int old_count = Heights.Size;
+    Heights.resize(count);
+    for (int n = old_count; n < count; n++)
+        Heights.Data[n] = default_height;
+    ImGuiListClipperHeights_BuildTree(this);
+}
+
+void ImGuiListClipperHeights::Build(int count, float (*height_func)(void* user_data, int n), void* user_data)
+{
+    IM_ASSERT(count >= 0 && height_func != NULL);
+    Heights.resize(count);
+    for (int n = 0; n < count; n++)
+        Heights.Data[n] = height_func(user_data, n);
+    ImGuiListClipperHeights_BuildTree(this);
+}
+
+void ImGuiListClipperHeights::SetHeight(int n, float height)
+{
+    IM_ASSERT(n >= 0 && n < Heights.Size && Tree.Size == Heights.Size + 1);
+    const double delta = (double)height - Heights.Data[n];
+    if (delta == 0.0)
+        return;
+    Heights.Data[n] = height;
+    for (int i = n + 1; i <= Heights.Size; i += (i & -i))
+        Tree.Data[i] += delta;
+}
+
+double ImGuiListClipperHeights::GetOffset(int n) const
+{
+    IM_ASSERT(n >= 0 && n <= Heights.Size && Tree.Size == Heights.Size + 1);
+    double offset = 0.0;
+    for (int i = n; i > 0; i -= (i & -i))
+        offset += Tree.Data[i];
+    return offset;
+}
+
+int ImGuiListClipperHeights::FindItemAtOffset(double offset) const
+{
+    // Descend the tree to find the largest 'pos' with GetOffset(pos) <= offset
+    const int count = Heights.Size;
+    if (count == 0 || offset <= 0.0)
+        return 0;
+    int pos = 0;
+    int step = 1;
+    while (step * 2 <= count)
+        step *= 2;
+    for (; step > 0; step >>= 1)
+        if (pos + step <= count && Tree.Data[pos + step] <= offset)
+        {
+            pos += step;
+            offset -= Tree.Data[pos];
+        }
+    return ImMin(pos, count - 1);
 }
 
 ImGuiListClipper::ImGuiListClipper()
@@ -3001,6 +3413,28 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     data->Reset(this);
     data->LossynessOffset = window->DC.CursorStartPosLossyness.y;
     TempData = data;
+    VariableHeights = NULL;
+}
+
+// Setup the clipper with an average item height so no measuring step is needed. Positions are converted using 'heights'.
+void ImGuiListClipper::BeginVariableHeight(ImGuiListClipperHeights* heights)
+{
+    IM_ASSERT(heights != NULL && heights->Tree.Size == heights->Heights.Size + 1 && "Call Resize() or Build() on ImGuiListClipperHeights first!");
+    const int items_count = heights->GetCount();
+    const double total_height = heights->GetOffset(items_count);
+    Begin(items_count, (items_count > 0 && total_height > 0.0) ? (float)(total_height / items_count) : 1.0f);
+    VariableHeights = heights;
+
+    // When heights above the first visible item changed since last use, adjust scrolling to keep it in place.
+    // (this applies on next frame, same as any other SetScrollY() call)
+    ImGuiContext& g = *Ctx;
+    if (heights->AnchorItem >= 0 && !g.LogEnabled)
+    {
+        const float delta = (float)(heights->GetOffset(heights->AnchorItem) - heights->AnchorOffset);
+        if (ImFabs(delta) > 0.01f)
+            ImGui::SetScrollY(g.CurrentWindow->Scroll.y + delta);
+        heights->AnchorOffset = heights->GetOffset(heights->AnchorItem);
+    }
 }
 
 void ImGuiListClipper::End()
@@ -3024,6 +3458,7 @@ void ImGuiListClipper::End()
         TempData = NULL;
     }
     ItemsCount = -1;
+    VariableHeights = NULL;
 }
 
 void ImGuiListClipper::IncludeItemsByIndex(int item_begin, int item_end)
@@ -3058,6 +3493,7 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         clipper->DisplayEnd = ImMin(data->ItemsFrozen + 1, clipper->ItemsCount);
         if (clipper->DisplayStart < clipper->DisplayEnd)
             data->ItemsFrozen++;
+        data->ItemsCursor = clipper->DisplayEnd;
         return true;
     }
 
@@ -3072,6 +3508,7 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
             data->Ranges.push_front(ImGuiListClipperRange::FromIndices(data->ItemsFrozen, data->ItemsFrozen + 1));
             clipper->DisplayStart = ImMax(data->Ranges[0].Min, data->ItemsFrozen);
             clipper->DisplayEnd = ImMin(data->Ranges[0].Max, clipper->ItemsCount);
+            data->ItemsCursor = clipper->DisplayEnd;
             data->StepNo = 1;
             return true;
         }
@@ -3127,6 +3564,25 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         // - Very important: when a starting position is after our maximum item, we set Min to (ItemsCount - 1). This allows us to handle most forms of wrapping.
         // - Due to how Selectable extra padding they tend to be "unaligned" with exact unit in the item list,
         //   which with the flooring/ceiling tend to lead to 2 items instead of one being submitted.
+        if (ImGuiListClipperHeights* heights = clipper->VariableHeights)
+        {
+            // Variable height: offsets are relative to item 'already_submitted', which is at the current cursor position
+            const double base_offset = heights->GetOffset(already_submitted) - window->DC.CursorPos.y - data->LossynessOffset;
+            for (ImGuiListClipperRange& range : data->Ranges)
+                if (range.PosToIndexConvert)
+                {
+                    int m1 = heights->FindItemAtOffset(range.Min + base_offset);
+                    int m2 = heights->FindItemAtOffset(range.Max + base_offset) + 1;
+                    range.Min = ImClamp(m1 + range.PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
+                    range.Max = ImClamp(m2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
+                    range.PosToIndexConvert = false;
+                }
+            if (!g.LogEnabled)
+            {
+                heights->AnchorItem = heights->FindItemAtOffset(window->ClipRect.Min.y + base_offset);
+                heights->AnchorOffset = heights->GetOffset(heights->AnchorItem);
+            }
+        }
         for (ImGuiListClipperRange& range : data->Ranges)
             if (range.PosToIndexConvert)
             {
@@ -3146,6 +3602,7 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
         if (clipper->DisplayStart > already_submitted) //-V1051
             ImGuiListClipper_SeekCursorForItem(clipper, clipper->DisplayStart);
+        data->ItemsCursor = clipper->DisplayEnd; // Position after user submits the range
         data->StepNo++;
         if (clipper->DisplayStart == clipper->DisplayEnd && data->StepNo < data->Ranges.Size)
             continue;
@@ -3773,6 +4230,8 @@ void ImGui::Initialize()
         ini_handler.ReadLineFn = WindowSettingsHandler_ReadLine;
         ini_handler.ApplyAllFn = WindowSettingsHandler_ApplyAll;
         ini_handler.WriteAllFn = WindowSettingsHandler_WriteAll;
+        ini_handler.ReadBinFn = WindowSettingsHandler_ReadBin;
+        ini_handler.WriteBinFn = WindowSettingsHandler_WriteBin;
         AddSettingsHandler(&ini_handler);
     }
     TableSettingsAddSettingsHandler();
@@ -3834,7 +4293,9 @@ void ImGui::Shutdown()
         return;
 
     // Save settings (unless we haven't attempted to load them: CreateContext/DestroyContext without a call to NewFrame shouldn't save an empty file)
-    if (g.SettingsLoaded && g.IO.IniFilename != NULL)
+    if (g.SettingsLoaded && g.IO.IniBinaryFilename != NULL)
+        SaveIniSettingsToDiskBinary(g.IO.IniBinaryFilename);
+    else if (g.SettingsLoaded && g.IO.IniFilename != NULL)
         SaveIniSettingsToDisk(g.IO.IniFilename);
 
     // Destroy platform windows
@@ -3848,7 +4309,7 @@ void ImGui::Shutdown()
     // Clear everything else
     g.Windows.clear_delete();
     g.WindowsFocusOrder.clear();
-    g.WindowsTempSortBuffer.clear();
+    g.FrameArena.ClearFreeMemory();
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
@@ -4006,7 +4467,8 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListIdxCapacity = window->DrawList->IdxBuffer.Capacity;
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
-    window->DrawList->_ClearFreeMemory();
+    window->DrawList->_ClearFreeMemory(); // Also releases layouts cached by ImDrawList::AddTextCached()
+    window->ExternalDrawLists.clear();
     window->DC.ChildWindows.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
@@ -4398,12 +4860,23 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
 }
 
 // IM_ALLOC() == ImGui::MemAlloc()
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+// Its address identifies the calling thread: allocations made by other threads than the one calling NewFrame() are not tracked.
+static thread_local char GImDebugAllocThreadTag;
+
+static inline bool DebugAllocIsOwnerThread(const ImGuiDebugAllocInfo* info)
+{
+    return info->OwnerThread == NULL || info->OwnerThread == &GImDebugAllocThreadTag;
+}
+#endif
+
 void* ImGui::MemAlloc(size_t size)
 {
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ImGuiContext* ctx = GImGui)
-        DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+        if (DebugAllocIsOwnerThread(&ctx->DebugAllocInfo))
+            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
 #endif
     return ptr;
 }
@@ -4414,11 +4887,19 @@ void ImGui::MemFree(void* ptr)
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ptr != NULL)
         if (ImGuiContext* ctx = GImGui)
-            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
+            if (DebugAllocIsOwnerThread(&ctx->DebugAllocInfo))
+                DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
 #endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+// Transient allocations for the current frame, see ImFrameArena
+void* ImGui::MemAllocFrame(size_t size)
+{
+    ImGuiContext& g = *GImGui;
+    return g.FrameArena.Alloc(size);
+}
+
 // We record the number of allocation in recent frames, as a way to audit/sanitize our guiding principles of "no allocations on idle/repeating frames"
 void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size)
 {
@@ -4433,6 +4914,12 @@ void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr
     }
     if (size != (size_t)-1)
     {
+        // Steady-state frames are expected to be allocation-free: break here to find out what allocated
+        if (info->AssertAllocAfterFrames > 0 && info->NoAllocFramesCount >= info->AssertAllocAfterFrames)
+        {
+            info->NoAllocFramesCount = 0;
+            IM_ASSERT(0 && "MemAlloc() called after a run of allocation-free frames! Disable in Metrics->Memory allocations.");
+        }
         entry->AllocCount++;
         info->TotalAllocCount++;
         //printf("[%05d] MemAlloc(%d) -> 0x%p\n", frame_count, size, ptr);
@@ -4493,6 +4980,66 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+// Everything which can change the output of a frame without new input events. Applications may sleep that long (or until the next input event).
+// - Not accounted for: your own animations, io.ConfigMemoryCompactTimer and anything else not affecting what we render.
+float ImGui::GetIdleWaitTime()
+{
+    ImGuiContext& g = *GImGui;
+
+    // Input events pending, or processed this frame: their outcome may take another frame to show (e.g. hovering, popups opening)
+    if (g.InputEventsQueue.Size > 0 || g.InputEventsTrail.Size > 0)
+        return 0.0f;
+
+    // Active widgets may update without input (button repeat, drag autoscroll). An active text field only needs its cursor to blink, unless selecting with mouse.
+    if (g.ActiveId != 0 && (g.ActiveId != g.InputTextState.ID || g.ActiveIdIsJustActivated || IsAnyMouseDown()))
+        return 0.0f;
+
+    // Held keys repeat
+    for (ImGuiKey key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_ReservedForModCtrl; key = (ImGuiKey)(key + 1))
+        if (!IsModKey(key) && !IsMouseKey(key) && IsKeyDown(key))
+            return 0.0f;
+
+    // Requests queued for next frame, fading animations
+    if (g.NavNextActivateId != 0 || g.NavInitRequest || g.NavMoveSubmitted || g.NavWindowingTarget != NULL)
+        return 0.0f;
+    const float dim_bg_ratio_target = (GetTopMostPopupModal() != NULL) ? 1.0f : 0.0f;
+    if (g.DimBgRatio != dim_bg_ratio_target || g.NavWindowingHighlightAlpha > 0.0f)
+        return 0.0f;
+    for (ImGuiPopupData& popup_data : g.OpenPopupStack)
+        if (popup_data.OpenFrameCount == g.FrameCount)
+            return 0.0f;
+
+    // Windows being auto-fit or waiting to be shown
+    for (ImGuiWindow* window : g.Windows)
+        if (window->Active && (window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0 || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX))
+            return 0.0f;
+
+    float wait_time = FLT_MAX;
+
+    // Text cursor blink: visible for 0.80f of each 1.20f cycle, and while CursorAnim <= 0.0f after an edit (see InputTextEx())
+    if (g.ActiveId != 0 && g.ActiveId == g.InputTextState.ID && g.IO.ConfigInputTextCursorBlink)
+    {
+        const float t = g.InputTextState.CursorAnim;
+        const float phase = (t <= 0.0f) ? t : ImFmod(t, 1.20f);
+        wait_time = ImMin(wait_time, (phase < 0.80f) ? 0.80f - phase : 1.20f - phase);
+    }
+
+    // Delayed hover (tooltips). We don't know which delay was requested, so wake up for each of them.
+    if (g.HoverItemDelayId != 0)
+    {
+        const float delays[] = { g.Style.HoverDelayShort - g.HoverItemDelayTimer, g.Style.HoverDelayNormal - g.HoverItemDelayTimer, (g.HoverItemUnlockedStationaryId != g.HoverItemDelayId) ? g.Style.HoverStationaryDelay - g.MouseStationaryTimer : 0.0f };
+        for (float delay : delays)
+            if (delay > 0.0f)
+                wait_time = ImMin(wait_time, delay);
+    }
+
+    // Saving .ini settings
+    if (g.SettingsDirtyTimer > 0.0f)
+        wait_time = ImMin(wait_time, g.SettingsDirtyTimer);
+
+    return wait_time;
+}
+
 static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -4536,6 +5083,54 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+ImDrawListSharedData* ImGui::CreateDrawListSharedData()
+{
+    ImGuiContext& g = *GImGui;
+    ImDrawListSharedData* shared_data = IM_NEW(ImDrawListSharedData)();
+    shared_data->NoDynamicGlyphs = true; // The font atlas is shared with the main thread
+    UpdateDrawListSharedData(shared_data);
+
+    // From now on, the main thread must not rasterize glyphs while workers may be reading them
+    g.DrawListSharedDataCopiesCount++;
+    g.IO.Fonts->DynamicGlyphsQueued = true;
+    return shared_data;
+}
+
+// Copy everything but the temporary buffer, which is what prevents sharing one instance between threads
+void ImGui::UpdateDrawListSharedData(ImDrawListSharedData* shared_data)
+{
+    ImGuiContext& g = *GImGui;
+    const ImDrawListSharedData& src = g.DrawListSharedData;
+    shared_data->TexUvWhitePixel = src.TexUvWhitePixel;
+    shared_data->Font = src.Font;
+    shared_data->FontSize = src.FontSize;
+    shared_data->CurveTessellationTol = src.CurveTessellationTol;
+    shared_data->CircleSegmentMaxError = src.CircleSegmentMaxError;
+    shared_data->ClipRectFullscreen = src.ClipRectFullscreen;
+    shared_data->InitialFlags = src.InitialFlags;
+    memcpy(shared_data->ArcFastVtx, src.ArcFastVtx, sizeof(src.ArcFastVtx));
+    shared_data->ArcFastRadiusCutoff = src.ArcFastRadiusCutoff;
+    memcpy(shared_data->CircleSegmentCounts, src.CircleSegmentCounts, sizeof(src.CircleSegmentCounts));
+    shared_data->TexUvLines = src.TexUvLines;
+}
+
+void ImGui::DestroyDrawListSharedData(ImDrawListSharedData* shared_data)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(shared_data != &g.DrawListSharedData && g.DrawListSharedDataCopiesCount > 0);
+    g.DrawListSharedDataCopiesCount--; // ImFontAtlas::DynamicGlyphsQueued is cleared by next NewFrame()
+    IM_DELETE(shared_data);
+}
+
+// The list is only read by Render(), so it may still be recorded by another thread until then
+void ImGui::AddDrawListToWindow(ImDrawList* draw_list)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(window != NULL && draw_list != NULL && draw_list != window->DrawList);
+    window->ExternalDrawLists.push_back(draw_list);
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -4827,6 +5422,8 @@ static void SetupDrawListSharedData()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLines;
     if (g.Style.AntiAliasedLinesUseTex && !(g.IO.Fonts->Flags & ImFontAtlasFlags_NoBakedLines))
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
+    if (g.Style.AntiAliasedLinesUseGpu && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasGpuLines))
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseGpu;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
@@ -4844,6 +5441,16 @@ void ImGui::NewFrame()
         if (g.Hooks[n].Type == ImGuiContextHookType_PendingRemoval_)
             g.Hooks.erase(&g.Hooks[n]);
 
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    // Only written when it changes, as worker threads read it in MemAlloc()
+    if (g.DebugAllocInfo.OwnerThread != &GImDebugAllocThreadTag)
+        g.DebugAllocInfo.OwnerThread = &GImDebugAllocThreadTag;
+
+    // Close last profiler frame (this is also where application time ends up)
+    UpdateDebugToolProfiler();
+#endif
+    IMGUI_PROFILER_SCOPE("NewFrame");
+
     CallContextHooks(&g, ImGuiContextHookType_NewFramePre);
 
     // Check and assert for various common IO and Configuration mistakes
@@ -4854,6 +5461,15 @@ void ImGui::NewFrame()
     // Load settings on first frame, save settings when modified (after a delay)
     UpdateSettings();
 
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    // Count allocation-free frames (see Metrics->Memory allocations)
+    ImGuiDebugAllocInfo* alloc_info = &g.DebugAllocInfo;
+    alloc_info->NoAllocFramesCount = (alloc_info->LastEntriesBuf[alloc_info->LastEntriesIdx].FrameCount == g.FrameCount) ? 0 : alloc_info->NoAllocFramesCount + 1;
+#endif
+
+    // Release transient allocations made two frames ago
+    g.FrameArena.NewFrame();
+
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
@@ -4876,7 +5492,12 @@ void ImGui::NewFrame()
     UpdateViewportsNewFrame();
 
     // Setup current font and draw list shared data
+    // (Dynamic atlas may need to grow to fit glyphs requested during last frame: do it before any UV is read from the atlas)
     // FIXME-VIEWPORT: the concept of a single ClipRectFullscreen is not ideal!
+    // (No draw list may be recorded on other threads at this point: it is the only time glyphs are rasterized while copies made by CreateDrawListSharedData() exist)
+    if (g.IO.Fonts->FontBuilderDynamicData != NULL)
+        ImFontAtlasBuildDynamicNewFrame(g.IO.Fonts);
+    g.IO.Fonts->DynamicGlyphsQueued = (g.DrawListSharedDataCopiesCount > 0);
     g.IO.Fonts->Locked = true;
     SetupDrawListSharedData();
     SetCurrentFont(GetDefaultFont());
@@ -5057,6 +5678,8 @@ void ImGui::NewFrame()
     for (ImGuiTableTempData& table_temp_data : g.TablesTempData)
         if (table_temp_data.LastTimeActive >= 0.0f && table_temp_data.LastTimeActive < memory_compact_start_time)
             TableGcCompactTransientBuffers(&table_temp_data);
+        else if (table_temp_data.DrawChannelsGcTime < memory_compact_start_time)
+            TableGcCompactUnusedDrawChannels(&table_temp_data);
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
@@ -5126,9 +5749,9 @@ static int IMGUI_CDECL ChildWindowComparer(const void* lhs, const void* rhs)
     return (a->BeginOrderWithinParent - b->BeginOrderWithinParent);
 }
 
-static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
+static void AddWindowToSortBuffer(ImGuiWindow** out_sorted_windows, int* out_sorted_count, ImGuiWindow* window)
 {
-    out_sorted_windows->push_back(window);
+    out_sorted_windows[(*out_sorted_count)++] = window;
     if (window->Active)
     {
         int count = window->DC.ChildWindows.Size;
@@ -5137,7 +5760,7 @@ static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, Im
         {
             ImGuiWindow* child = window->DC.ChildWindows[i];
             if (child->Active)
-                AddWindowToSortBuffer(out_sorted_windows, child);
+                AddWindowToSortBuffer(out_sorted_windows, out_sorted_count, child);
         }
     }
 }
@@ -5151,6 +5774,12 @@ static void AddWindowToDrawData(ImGuiWindow* window, int layer)
     if (window->DrawList->_Splitter._Count > 1)
         window->DrawList->ChannelsMerge(); // Merge if user forgot to merge back. Also required in Docking branch for ImGuiWindowFlags_DockNodeHost windows.
     ImGui::AddDrawListToDrawDataEx(&viewport->DrawDataP, viewport->DrawDataBuilder.Layers[layer], window->DrawList);
+    for (ImDrawList* draw_list : window->ExternalDrawLists)
+    {
+        IM_ASSERT(draw_list->_Splitter._Count <= 1 && "Missing ChannelsMerge() in a draw list passed to AddDrawListToWindow()!");
+        draw_list->_PopUnusedDrawCmd();
+        ImGui::AddDrawListToDrawDataEx(&viewport->DrawDataP, viewport->DrawDataBuilder.Layers[layer], draw_list);
+    }
     for (ImGuiWindow* child : window->DC.ChildWindows)
         if (IsWindowActiveAndVisible(child)) // Clipped children may have been marked not active
             AddWindowToDrawData(child, layer);
@@ -5365,6 +5994,7 @@ void ImGui::EndFrame()
     if (g.FrameCountEnded == g.FrameCount)
         return;
     IM_ASSERT(g.WithinFrameScope && "Forgot to call ImGui::NewFrame()?");
+    IMGUI_PROFILER_SCOPE("EndFrame");
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePre);
 
@@ -5428,18 +6058,19 @@ void ImGui::EndFrame()
 
     // Sort the window list so that all child windows are after their parent
     // We cannot do that on FocusWindow() because children may not exist yet
-    g.WindowsTempSortBuffer.resize(0);
-    g.WindowsTempSortBuffer.reserve(g.Windows.Size);
+    ImGuiWindow** sorted_windows = (ImGuiWindow**)MemAllocFrame(sizeof(ImGuiWindow*) * g.Windows.Size);
+    int sorted_count = 0;
     for (ImGuiWindow* window : g.Windows)
     {
         if (window->Active && (window->Flags & ImGuiWindowFlags_ChildWindow))       // if a child is active its parent will add it
             continue;
-        AddWindowToSortBuffer(&g.WindowsTempSortBuffer, window);
+        AddWindowToSortBuffer(sorted_windows, &sorted_count, window);
     }
 
     // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
-    IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
-    g.Windows.swap(g.WindowsTempSortBuffer);
+    IM_ASSERT(g.Windows.Size == sorted_count);
+    if (sorted_count > 0)
+        memcpy(g.Windows.Data, sorted_windows, sizeof(ImGuiWindow*) * sorted_count);
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
@@ -5466,6 +6097,7 @@ void ImGui::Render()
         EndFrame();
     if (g.FrameCountRendered == g.FrameCount)
         return;
+    IMGUI_PROFILER_SCOPE("Render");
     g.FrameCountRendered = g.FrameCount;
 
     g.IO.MetricsRenderWindows = 0;
@@ -6901,6 +7533,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
+    IMGUI_PROFILER_SCOPE("Begin");
 
     // Find or create
     ImGuiWindow* window = FindWindowByName(name);
@@ -7117,6 +7750,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->ClipRect = ImVec4(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
         window->IDStack.resize(1);
         window->DrawList->_ResetForNewFrame();
+        window->ExternalDrawLists.resize(0);
         window->DC.CurrentTableIdx = -1;
         if (flags & ImGuiWindowFlags_DockNodeHost)
         {
@@ -7823,6 +8457,7 @@ void ImGui::End()
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
+    IMGUI_PROFILER_SCOPE("End");
 
     // Error checking: verify that user hasn't called End() too many times!
     if (g.CurrentWindowStack.Size <= 1 && g.WithinFrameScopeWithImplicitWindow)
@@ -10584,6 +11219,7 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     IM_ASSERT((g.FrameCount == 0 || g.FrameCountEnded == g.FrameCount)  && "Forgot to call Render() or EndFrame() at the end of the previous frame?");
     IM_ASSERT(g.IO.DisplaySize.x >= 0.0f && g.IO.DisplaySize.y >= 0.0f  && "Invalid DisplaySize value!");
     IM_ASSERT(g.IO.Fonts->IsBuilt()                                     && "Font Atlas not built! Make sure you called ImGui_ImplXXXX_NewFrame() function for renderer backend, which should call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8()");
+    IM_ASSERT((g.IO.Fonts->FontBuilderDynamicData == NULL || g.IO.BackendRendererUserData == NULL || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates)) && "ImFontAtlasFlags_DynamicGlyphs requires a renderer backend supporting ImGuiBackendFlags_RendererHasTexUpdates!");
     IM_ASSERT(g.Style.CurveTessellationTol > 0.0f                       && "Invalid style setting!");
     IM_ASSERT(g.Style.CircleTessellationMaxError > 0.0f                 && "Invalid style setting!");
     IM_ASSERT(g.Style.Alpha >= 0.0f && g.Style.Alpha <= 1.0f            && "Invalid style setting!"); // Allows us to avoid a few clamps in color computations
@@ -14487,6 +15123,10 @@ void ImGui::LogButtons()
 // - LoadIniSettingsFromMemory()
 // - SaveIniSettingsToDisk()
 // - SaveIniSettingsToMemory()
+// - LoadIniSettingsFromBinary()
+// - SaveIniSettingsToBinary()
+// - LoadIniSettingsFromDiskBinary() [Internal]
+// - SaveIniSettingsToDiskBinary() [Internal]
 //-----------------------------------------------------------------------------
 // - CreateNewWindowSettings() [Internal]
 // - FindWindowSettingsByID() [Internal]
@@ -14503,7 +15143,10 @@ void ImGui::UpdateSettings()
     if (!g.SettingsLoaded)
     {
         IM_ASSERT(g.SettingsWindows.empty());
-        if (g.IO.IniFilename)
+        bool loaded = false;
+        if (g.IO.IniBinaryFilename)
+            loaded = LoadIniSettingsFromDiskBinary(g.IO.IniBinaryFilename);
+        if (!loaded && g.IO.IniFilename)
             LoadIniSettingsFromDisk(g.IO.IniFilename);
         g.SettingsLoaded = true;
     }
@@ -14514,7 +15157,9 @@ void ImGui::UpdateSettings()
         g.SettingsDirtyTimer -= g.IO.DeltaTime;
         if (g.SettingsDirtyTimer <= 0.0f)
         {
-            if (g.IO.IniFilename != NULL)
+            if (g.IO.IniBinaryFilename != NULL)
+                SaveIniSettingsToDiskBinary(g.IO.IniBinaryFilename);
+            else if (g.IO.IniFilename != NULL)
                 SaveIniSettingsToDisk(g.IO.IniFilename);
             else
                 g.IO.WantSaveIniSettings = true;  // Let user know they can call SaveIniSettingsToMemory(). user will need to clear io.WantSaveIniSettings themselves.
@@ -14553,9 +15198,13 @@ void ImGui::RemoveSettingsHandler(const char* type_name)
 }
 
 ImGuiSettingsHandler* ImGui::FindSettingsHandler(const char* type_name)
+{
+    return FindSettingsHandlerByHash(ImHashStr(type_name));
+}
+
+ImGuiSettingsHandler* ImGui::FindSettingsHandlerByHash(ImGuiID type_hash)
 {
     ImGuiContext& g = *GImGui;
-    const ImGuiID type_hash = ImHashStr(type_name);
     for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
         if (handler.TypeHash == type_hash)
             return &handler;
@@ -14608,6 +15257,22 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
         if (handler.ReadInitFn != NULL)
             handler.ReadInitFn(&g, &handler);
 
+    LoadIniSettingsLines(&g, buf, buf_end);
+    g.SettingsLoaded = true;
+
+    // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
+    memcpy(buf, ini_data, ini_size);
+
+    // Call post-read handlers
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        if (handler.ApplyAllFn != NULL)
+            handler.ApplyAllFn(&g, &handler);
+}
+
+// Parse zero-terminated, writable .ini text and dispatch its entries to handlers. Also used for the text records of the binary store.
+static void LoadIniSettingsLines(ImGuiContext* ctx, char* buf, char* buf_end)
+{
+    ImGuiContext& g = *ctx;
     void* entry_data = NULL;
     ImGuiSettingsHandler* entry_handler = NULL;
 
@@ -14635,7 +15300,7 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
                 continue;
             *type_end = 0; // Overwrite first ']'
             name_start++;  // Skip second '['
-            entry_handler = FindSettingsHandler(type_start);
+            entry_handler = ImGui::FindSettingsHandler(type_start);
             entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
         }
         else if (entry_handler != NULL && entry_data != NULL)
@@ -14644,15 +15309,6 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
             entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
         }
     }
-    g.SettingsLoaded = true;
-
-    // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
-    memcpy(buf, ini_data, ini_size);
-
-    // Call post-read handlers
-    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
-        if (handler.ApplyAllFn != NULL)
-            handler.ApplyAllFn(&g, &handler);
 }
 
 void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
@@ -14685,6 +15341,300 @@ const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
     return g.SettingsIniData.c_str();
 }
 
+// Binary store layout (native endianness, no alignment):
+// - Segment: ImU32 Magic, ImU32 Version, ImU32 Flags, ImU32 RecordsSize, followed by RecordsSize bytes of records.
+// - Record:  ImU32 Key, ImU32 TypeHash, ImU32 DataSize, followed by DataSize bytes of data.
+//   TypeHash is the handler type for binary records, 0 for text records (which carry their "[Type][Name]" header), 0 with DataSize 0 for a deleted entry.
+static const ImU32  IMGUI_SETTINGS_BIN_MAGIC = 0x42474D49; // "IMGB"
+static const ImU32  IMGUI_SETTINGS_BIN_VERSION = 1;
+static const ImU32  IMGUI_SETTINGS_BIN_FLAGS_ALL = 1 << 0;  // Segment holds all records: earlier segments are obsolete
+static const int    IMGUI_SETTINGS_BIN_SEGMENT_HEADER_SIZE = 16;
+static const int    IMGUI_SETTINGS_BIN_RECORD_HEADER_SIZE = 12;
+
+static ImU32 SettingsBinReadU32(const char* p)
+{
+    ImU32 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// Hash TypeHash + DataSize + data. Never 0, so it can be told apart from a missing entry in ImGuiStorage.
+static int SettingsBinHashRecord(const char* record)
+{
+    const ImU32 hash = ImHashData(record + 4, IMGUI_SETTINGS_BIN_RECORD_HEADER_SIZE - 4 + SettingsBinReadU32(record + 8));
+    return (int)(hash != 0 ? hash : 1);
+}
+
+void ImGuiSettingsBinWriter::BeginRecord(ImGuiID id)
+{
+    IM_ASSERT(RecordOffset == -1);
+    RecordOffset = Buf.Size;
+    WriteValue<ImU32>(ImHashData(&id, sizeof(id), TypeHash));
+    WriteValue<ImU32>(TypeHash);
+    WriteValue<ImU32>(0); // Patched by EndRecord()
+}
+
+void ImGuiSettingsBinWriter::EndRecord()
+{
+    IM_ASSERT(RecordOffset != -1);
+    char* record = Buf.Data + RecordOffset;
+    const ImU32 data_size = (ImU32)(Buf.Size - RecordOffset - IMGUI_SETTINGS_BIN_RECORD_HEADER_SIZE);
+    memcpy(record + 8, &data_size, sizeof(data_size));
+    const ImGuiID key = SettingsBinReadU32(record);
+    const int hash = SettingsBinHashRecord(record);
+    Hashes.SetInt(key, hash);
+    LiveSize += Buf.Size - RecordOffset;
+    if (PrevHashes != NULL && PrevHashes->GetInt(key) == hash)
+        Buf.resize(RecordOffset); // Unchanged since the previous save: drop it
+    RecordOffset = -1;
+}
+
+// Store each "[Type][Name]" entry output by a text handler as its own record.
+static void SettingsBinWriteTextRecords(ImGuiSettingsBinWriter* out)
+{
+    const char* buf = out->TextBuf.begin();
+    const char* buf_end = out->TextBuf.end();
+    const char* line_end = NULL;
+    for (const char* line = buf; line < buf_end; line = line_end + 1)
+    {
+        line_end = ImStrchrRange(line, buf_end, '\n');
+        if (line_end == NULL)
+            line_end = buf_end;
+        if (line[0] != '[')
+            continue;
+        out->BeginRecord(ImHashStr(line, (size_t)(line_end - line)));
+        out->Write(line, (size_t)(ImMin(line_end + 1, buf_end) - line));
+        for (const char* next = line_end + 1; next < buf_end && next[0] != '['; next = line_end + 1)
+        {
+            line_end = ImStrchrRange(next, buf_end, '\n');
+            if (line_end == NULL)
+                line_end = buf_end;
+            out->Write(next, (size_t)(ImMin(line_end + 1, buf_end) - next));
+        }
+        out->EndRecord();
+    }
+}
+
+// Replay segments: for each key only the last record of the data, after the last segment holding all records, is applied.
+bool ImGui::LoadIniSettingsFromBinary(const void* data, size_t data_size, size_t* out_valid_size)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    const char* const buf = (const char*)data;
+    const char* const buf_end = buf + data_size;
+
+    // Validate segments and find the last record of each key
+    ImGuiStorage last_records;
+    last_records.SetHashMapEnabled(true);
+    const char* live_begin = buf;
+    const char* valid_end = buf;
+    while (buf_end - valid_end >= IMGUI_SETTINGS_BIN_SEGMENT_HEADER_SIZE)
+    {
+        const char* segment = valid_end;
+        if (SettingsBinReadU32(segment) != IMGUI_SETTINGS_BIN_MAGIC || SettingsBinReadU32(segment + 4) != IMGUI_SETTINGS_BIN_VERSION)
+            break;
+        const char* records = segment + IMGUI_SETTINGS_BIN_SEGMENT_HEADER_SIZE;
+        const ImU32 records_size = SettingsBinReadU32(segment + 12);
+        if ((size_t)(buf_end - records) < records_size)
+            break; // Truncated segment (e.g. interrupted append): ignore it
+        const char* records_end = records + records_size;
+        const char* record = records;
+        while (records_end - record >= IMGUI_SETTINGS_BIN_RECORD_HEADER_SIZE)
+        {
+            const ImU32 record_data_size = SettingsBinReadU32(record + 8);
+            if ((size_t)(records_end - record - IMGUI_SETTINGS_BIN_RECORD_HEADER_SIZE) < record_data_size)
+                break;
+            record += IMGUI_SETTINGS_BIN_RECORD_HEADER_SIZE + record_data_size;
+        }
+        if (record != records_end)
+            break; // Corrupted segment: a record header or payload overruns it
+        if (SettingsBinReadU32(segment + 8) & IMGUI_SETTINGS_BIN_FLAGS_ALL)
+        {
+            live_begin = segment;
+            last_records.Clear();
+        }
+        record = records;
+        while (record < records_end)
+        {
+            last_records.SetInt(SettingsBinReadU32(record), (int)(record - buf) + 1);
+            record += IMGUI_SETTINGS_BIN_RECORD_HEADER_SIZE + SettingsBinReadU32(record + 8);
+        }
+        valid_end = records_end;
+    }
+    if (out_valid_size)
+        *out_valid_size = (size_t)(valid_end - buf);
+    if (valid_end == buf)
+        return false;
+
+    // Call pre-read handlers
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        if (handler.ReadInitFn != NULL)
+            handler.ReadInitFn(&g, &handler);
+
+    g.SettingsBinHashes.Clear();
+    g.SettingsBinHashes.SetHashMapEnabled(true);
+    g.SettingsBinData.LiveSize = 0;
+    ImVector<char>& text_buf = g.SettingsBinData.TextBuf.Buf;
+    // Segments and records in [live_begin, valid_end) were bounds checked above
+    const char* segment = live_begin;
+    while (segment < valid_end)
+    {
+        const char* records_end = segment + IMGUI_SETTINGS_BIN_SEGMENT_HEADER_SIZE + SettingsBinReadU32(segment + 12);
+        const char* next_record = segment + IMGUI_SETTINGS_BIN_SEGMENT_HEADER_SIZE;
+        segment = records_end;
+        while (next_record < records_end)
+        {
+            const char* record = next_record;
+            const ImGuiID key = SettingsBinReadU32(record);
+            const ImGuiID type_hash = SettingsBinReadU32(record + 4);
+            const ImU32 record_data_size = SettingsBinReadU32(record + 8);
+            next_record += IMGUI_SETTINGS_BIN_RECORD_HEADER_SIZE + record_data_size;
+            if (last_records.GetInt(key) != (int)(record - buf) + 1)
+                continue; // Overridden by a later record
+            if (type_hash == 0 && record_data_size == 0)
+                continue; // Deleted entry
+            g.SettingsBinHashes.SetInt(key, SettingsBinHashRecord(record));
+            g.SettingsBinData.LiveSize += IMGUI_SETTINGS_BIN_RECORD_HEADER_SIZE + (int)record_data_size;
+
+            const char* record_data = record + IMGUI_SETTINGS_BIN_RECORD_HEADER_SIZE;
+            if (type_hash == 0)
+            {
+                // Text record: parse a writable, zero-terminated copy
+                text_buf.resize((int)record_data_size + 1);
+                memcpy(text_buf.Data, record_data, record_data_size);
+                text_buf.Data[record_data_size] = 0;
+                LoadIniSettingsLines(&g, text_buf.Data, text_buf.Data + record_data_size);
+            }
+            else if (ImGuiSettingsHandler* handler = FindSettingsHandlerByHash(type_hash))
+            {
+                if (handler->ReadBinFn != NULL)
+                    handler->ReadBinFn(&g, handler, record_data, (int)record_data_size);
+            }
+        }
+    }
+    text_buf.clear();
+    g.SettingsLoaded = true;
+
+    // Call post-read handlers
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        if (handler.ApplyAllFn != NULL)
+            handler.ApplyAllFn(&g, &handler);
+    return true;
+}
+
+// Call registered handlers to write their entries as records. With only_dirty, records which didn't change since the previous save/load are skipped.
+const void* ImGui::SaveIniSettingsToBinary(size_t* out_size, bool only_dirty)
+{
+    ImGuiContext& g = *GImGui;
+    g.SettingsDirtyTimer = 0.0f;
+
+    ImGuiSettingsBinWriter* out = &g.SettingsBinData;
+    out->Buf.resize(0);
+    out->Hashes.Clear();
+    out->Hashes.SetHashMapEnabled(true);
+    out->PrevHashes = only_dirty ? &g.SettingsBinHashes : NULL;
+    out->LiveSize = 0;
+    out->WriteValue<ImU32>(IMGUI_SETTINGS_BIN_MAGIC);
+    out->WriteValue<ImU32>(IMGUI_SETTINGS_BIN_VERSION);
+    out->WriteValue<ImU32>(only_dirty ? 0 : IMGUI_SETTINGS_BIN_FLAGS_ALL);
+    out->WriteValue<ImU32>(0); // Patched below
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+    {
+        if (handler.WriteBinFn != NULL && handler.ReadBinFn != NULL)
+        {
+            out->TypeHash = handler.TypeHash;
+            handler.WriteBinFn(&g, &handler, out);
+        }
+        else
+        {
+            out->TypeHash = 0;
+            out->TextBuf.Buf.resize(0);
+            out->TextBuf.Buf.push_back(0);
+            handler.WriteAllFn(&g, &handler, &out->TextBuf);
+            SettingsBinWriteTextRecords(out);
+        }
+    }
+    out->TextBuf.clear();
+
+    // Delete entries which went away since the previous save
+    if (only_dirty)
+        for (const ImGuiStoragePair& pair : g.SettingsBinHashes.Data)
+            if (out->Hashes.GetInt(pair.key) == 0)
+            {
+                out->WriteValue<ImU32>(pair.key);
+                out->WriteValue<ImU32>(0);
+                out->WriteValue<ImU32>(0);
+            }
+
+    // Hashes of this save become the reference for the next one
+    g.SettingsBinHashes.Data.swap(out->Hashes.Data);
+    g.SettingsBinHashes.HashTable.swap(out->Hashes.HashTable);
+    g.SettingsBinHashes.HashMapEnabled = true;
+    out->PrevHashes = NULL;
+
+    const ImU32 records_size = (ImU32)(out->Buf.Size - IMGUI_SETTINGS_BIN_SEGMENT_HEADER_SIZE);
+    if (only_dirty && records_size == 0)
+        out->Buf.resize(0); // Nothing to append
+    else
+        memcpy(out->Buf.Data + 12, &records_size, sizeof(records_size));
+    if (out_size)
+        *out_size = (size_t)out->Buf.Size;
+    return out->Buf.Data;
+}
+
+bool ImGui::LoadIniSettingsFromDiskBinary(const char* filename)
+{
+    ImGuiContext& g = *GImGui;
+    g.SettingsBinStoreSize = -1;
+    size_t file_data_size = 0;
+    char* file_data = (char*)ImFileLoadToMemory(filename, "rb", &file_data_size);
+    if (!file_data)
+        return false;
+    size_t valid_size = 0;
+    const bool loaded = LoadIniSettingsFromBinary(file_data, file_data_size, &valid_size);
+    if (loaded && valid_size == file_data_size)
+        g.SettingsBinStoreSize = (int)file_data_size; // Otherwise appending after the unreadable tail would lose the new segments: the next save rewrites the store.
+    IM_FREE(file_data);
+    return loaded;
+}
+
+// Append the records which changed to the store, or rewrite it when we didn't load it or when it holds too many obsolete records.
+void ImGui::SaveIniSettingsToDiskBinary(const char* filename)
+{
+    ImGuiContext& g = *GImGui;
+    g.SettingsDirtyTimer = 0.0f;
+    if (!filename)
+        return;
+
+    const bool append = g.SettingsBinStoreSize >= 0 && g.SettingsBinStoreSize <= g.SettingsBinData.LiveSize * 2 + 4096;
+    size_t data_size = 0;
+    const void* data = SaveIniSettingsToBinary(&data_size, append);
+    if (data_size == 0)
+        return;
+
+    // A rewrite goes to a temporary file renamed over the store, so a crash or a full disk can't lose the previous settings.
+    // An interrupted append only leaves a truncated last segment. LoadIniSettingsFromDiskBinary() ignores it, and the next save then rewrites the store instead of appending after it.
+    ImGuiTextBuffer tmp_filename;
+    if (!append)
+        tmp_filename.appendf("%s.tmp", filename);
+    ImFileHandle f = ImFileOpen(append ? filename : tmp_filename.c_str(), append ? "ab" : "wb");
+    if (!f)
+    {
+        g.SettingsBinStoreSize = -1;
+        return;
+    }
+    bool written = ImFileWrite(data, 1, data_size, f) == data_size;
+    written = ImFileClose(f) && written;
+    if (!append)
+    {
+        if (written)
+            written = ImFileRename(tmp_filename.c_str(), filename);
+        if (!written)
+            remove(tmp_filename.c_str());
+    }
+    g.SettingsBinStoreSize = written ? (append ? g.SettingsBinStoreSize : 0) + (int)data_size : -1;
+}
+
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 {
     ImGuiContext& g = *GImGui;
@@ -14796,10 +15746,10 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
-static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather data from windows that were active during this session
+// (if a window wasn't opened in this session we preserve its settings)
+static void WindowSettingsHandler_UpdateAll(ImGuiContext* ctx)
 {
-    // Gather data from windows that were active during this session
-    // (if a window wasn't opened in this session we preserve its settings)
     ImGuiContext& g = *ctx;
     for (ImGuiWindow* window : g.Windows)
     {
@@ -14825,6 +15775,12 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
         settings->IsChild = (window->RootWindow != window); // Cannot rely on ImGuiWindowFlags_ChildWindow here as docked windows have this set.
         settings->WantDelete = false;
     }
+}
+
+static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_UpdateAll(ctx);
 
     // Write to text buffer
     buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
@@ -14866,6 +15822,70 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
     }
 }
 
+// Binary record: same data as the text entry (fields which aren't written as text are written with their default value), followed by the name.
+static void WindowSettingsHandler_WriteBin(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiSettingsBinWriter* out)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_UpdateAll(ctx);
+
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    {
+        if (settings->WantDelete)
+            continue;
+        const bool is_child = settings->IsChild;
+        const bool is_docked = !is_child && settings->DockId != 0;
+        out->BeginRecord(settings->ID);
+        out->WriteValue<ImVec2ih>(is_child ? ImVec2ih() : settings->Pos);
+        out->WriteValue<ImVec2ih>(settings->Size);
+        out->WriteValue<ImVec2ih>(is_child ? ImVec2ih() : settings->ViewportPos);
+        out->WriteValue<ImU32>(is_child ? 0 : settings->ViewportId);
+        out->WriteValue<ImU32>(is_docked ? settings->DockId : 0);
+        out->WriteValue<ImU32>(is_docked ? settings->ClassId : 0);
+        out->WriteValue<ImS16>(is_docked ? settings->DockOrder : -1);
+        out->WriteValue<ImU8>((ImU8)((settings->Collapsed && !is_child ? 1 : 0) | (is_child ? 2 : 0)));
+        const char* name = settings->GetName();
+        out->Write(name, strlen(name));
+        out->EndRecord();
+    }
+}
+
+static void WindowSettingsHandler_ReadBin(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const void* data, int data_size)
+{
+    const int header_size = 3 * sizeof(ImVec2ih) + 3 * 4 + 2 + 1;
+    if (data_size < header_size)
+        return;
+    const char* p = (const char*)data;
+    ImGuiWindowSettings read;
+    memcpy(&read.Pos, p, sizeof(ImVec2ih)); p += sizeof(ImVec2ih);
+    memcpy(&read.Size, p, sizeof(ImVec2ih)); p += sizeof(ImVec2ih);
+    memcpy(&read.ViewportPos, p, sizeof(ImVec2ih)); p += sizeof(ImVec2ih);
+    memcpy(&read.ViewportId, p, 4);         p += 4;
+    memcpy(&read.DockId, p, 4);             p += 4;
+    memcpy(&read.ClassId, p, 4);            p += 4;
+    memcpy(&read.DockOrder, p, 2);          p += 2;
+    read.Collapsed = (*p & 1) != 0;
+    read.IsChild = (*p & 2) != 0;
+    p++;
+
+    // Recycle or create the entry like WindowSettingsHandler_ReadOpen() does, with a zero-terminated copy of the name
+    ImGuiContext& g = *ctx;
+    ImVector<char>& name = g.SettingsBinData.TextBuf.Buf;
+    const int name_len = data_size - header_size;
+    name.resize(name_len + 1);
+    memcpy(name.Data, p, (size_t)name_len);
+    name.Data[name_len] = 0;
+    ImGuiWindowSettings* settings = (ImGuiWindowSettings*)WindowSettingsHandler_ReadOpen(ctx, handler, name.Data);
+    settings->Pos = read.Pos;
+    settings->Size = read.Size;
+    settings->ViewportPos = read.ViewportPos;
+    settings->ViewportId = read.ViewportId;
+    settings->DockId = read.DockId;
+    settings->ClassId = read.ClassId;
+    settings->DockOrder = read.DockOrder;
+    settings->Collapsed = read.Collapsed;
+    settings->IsChild = read.IsChild;
+}
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] LOCALIZATION
@@ -15074,6 +16094,7 @@ static void ImGui::UpdateViewportsNewFrame()
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.PlatformIO.Viewports.Size <= g.Viewports.Size);
+    IMGUI_PROFILER_SCOPE("UpdateViewportsNewFrame");
 
     // Update Minimized status (we need it first in order to decide if we'll apply Pos/Size of the main viewport)
     // Update Focused status
@@ -20427,14 +21448,14 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         if (TreeNode("By submission order (begin stack)"))
         {
             // Here we display windows in their submitted order/hierarchy, however note that the Begin stack doesn't constitute a Parent<>Child relationship!
-            ImVector<ImGuiWindow*>& temp_buffer = g.WindowsTempSortBuffer;
-            temp_buffer.resize(0);
+            ImGuiWindow** temp_buffer = (ImGuiWindow**)MemAllocFrame(sizeof(ImGuiWindow*) * g.Windows.Size);
+            int temp_buffer_size = 0;
             for (ImGuiWindow* window : g.Windows)
                 if (window->LastFrameActive + 1 >= g.FrameCount)
-                    temp_buffer.push_back(window);
+                    temp_buffer[temp_buffer_size++] = window;
             struct Func { static int IMGUI_CDECL WindowComparerByBeginOrder(const void* lhs, const void* rhs) { return ((int)(*(const ImGuiWindow* const *)lhs)->BeginOrderWithinContext - (*(const ImGuiWindow* const*)rhs)->BeginOrderWithinContext); } };
-            ImQsort(temp_buffer.Data, (size_t)temp_buffer.Size, sizeof(ImGuiWindow*), Func::WindowComparerByBeginOrder);
-            DebugNodeWindowsListByBeginStackParent(temp_buffer.Data, temp_buffer.Size, NULL);
+            ImQsort(temp_buffer, (size_t)temp_buffer_size, sizeof(ImGuiWindow*), Func::WindowComparerByBeginOrder);
+            DebugNodeWindowsListByBeginStackParent(temp_buffer, temp_buffer_size, NULL);
             TreePop();
         }
 
@@ -20664,6 +21685,111 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             InputTextMultiline("##Ini", (char*)(void*)g.SettingsIniData.c_str(), g.SettingsIniData.Buf.Size, ImVec2(-FLT_MIN, GetTextLineHeight() * 20), ImGuiInputTextFlags_ReadOnly);
             TreePop();
         }
+        Text("Binary store: \"%s\", %d records, %d bytes live, %d bytes on disk, last segment %d bytes", g.IO.IniBinaryFilename ? g.IO.IniBinaryFilename : "<NULL>",
+            g.SettingsBinHashes.Data.Size, g.SettingsBinData.LiveSize, g.SettingsBinStoreSize, g.SettingsBinData.Buf.Size);
+        TreePop();
+    }
+
+    // Profiler
+    if (TreeNode("Profiler"))
+    {
+        ImGuiProfiler* profiler = &g.DebugProfiler;
+        BeginDisabled(profiler->HookCallback != NULL);
+        Checkbox("Enabled", &profiler->Enabled);
+        EndDisabled();
+        SameLine();
+        Checkbox("Paused", &profiler->Paused);
+        SameLine();
+        MetricsHelpMarker("Times scopes submitted with DebugProfilerScopeBegin()/DebugProfilerScopeEnd(), which dear imgui uses for its own hot paths.\nA frame spans from NewFrame() to the next NewFrame(): time outside of depth 0 scopes is spent in your application, renderer or waiting for vsync.");
+        if (profiler->HookCallback)
+        {
+            SameLine();
+            TextDisabled("(hook set)");
+        }
+
+        const int frames_count = profiler->FramesCount;
+        if (profiler->Enabled && frames_count > 0)
+        {
+            const ImGuiProfilerFrame* last_frame = &profiler->Frames[(profiler->FramesIdx - 1 + IMGUI_PROFILER_FRAMES) % IMGUI_PROFILER_FRAMES];
+            float frame_avg = 0.0f, frame_max = 0.0f, top_avg = 0.0f, top_max = 0.0f;
+            for (int frame_n = 0; frame_n < frames_count; frame_n++)
+            {
+                const ImGuiProfilerFrame* frame = &profiler->Frames[frame_n];
+                frame_avg += frame->DurationMs / frames_count;
+                frame_max = ImMax(frame_max, frame->DurationMs);
+                top_avg += frame->TopLevelMs / frames_count;
+                top_max = ImMax(top_max, frame->TopLevelMs);
+            }
+            Text("Frame: %.3f ms avg, %.3f ms max (%d frames)", frame_avg, frame_max, frames_count);
+            Text("Timed scopes: %.3f ms avg, %.3f ms max (%.1f%% of frame)", top_avg, top_max, frame_avg > 0.0f ? top_avg * 100.0f / frame_avg : 0.0f);
+            struct ProfilerFuncs { static float GetTopLevelMs(void* data, int idx) { return ((ImGuiProfilerFrame*)data)[idx].TopLevelMs; } };
+            PlotHistogram("##TopLevelMs", &ProfilerFuncs::GetTopLevelMs, profiler->Frames, frames_count, (frames_count == IMGUI_PROFILER_FRAMES) ? profiler->FramesIdx : 0, "Timed scopes (ms)", 0.0f, top_max, ImVec2(-FLT_MIN, GetTextLineHeight() * 3));
+
+            if (BeginTable("##Scopes", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+            {
+                TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+                TableSetupColumn("Calls");
+                TableSetupColumn("Last (ms)");
+                TableSetupColumn("Avg (ms)");
+                TableSetupColumn("Max (ms)");
+                TableSetupColumn("% of frame");
+                TableHeadersRow();
+                for (int scope_n = 0; scope_n < profiler->ScopeNamesCount; scope_n++)
+                {
+                    float scope_avg = 0.0f, scope_max = 0.0f;
+                    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+                    {
+                        scope_avg += profiler->Frames[frame_n].ScopeTimesMs[scope_n] / frames_count;
+                        scope_max = ImMax(scope_max, profiler->Frames[frame_n].ScopeTimesMs[scope_n]);
+                    }
+                    TableNextColumn(); TextUnformatted(profiler->ScopeNames[scope_n]);
+                    TableNextColumn(); Text("%d", last_frame->ScopeCalls[scope_n]);
+                    TableNextColumn(); Text("%.3f", last_frame->ScopeTimesMs[scope_n]);
+                    TableNextColumn(); Text("%.3f", scope_avg);
+                    TableNextColumn(); Text("%.3f", scope_max);
+                    TableNextColumn(); Text("%.1f%%", frame_avg > 0.0f ? scope_avg * 100.0f / frame_avg : 0.0f);
+                }
+                EndTable();
+            }
+
+            if (TreeNode("Timeline", "Last frame timeline (%d scopes)", profiler->EventsLastFrame.Size))
+            {
+                SetNextItemWidth(GetFontSize() * 12);
+                SliderFloat("Zoom", &profiler->TimelineZoom, 1.0f, 200.0f, "%.1fx", ImGuiSliderFlags_Logarithmic);
+                int max_depth = 0;
+                for (const ImGuiProfilerEvent& ev : profiler->EventsLastFrame)
+                    max_depth = ImMax(max_depth, ev.Depth);
+                const float row_height = GetFrameHeight();
+                const float timeline_height = row_height * (max_depth + 1);
+                if (BeginChild("##Timeline", ImVec2(-FLT_MIN, timeline_height + g.Style.ScrollbarSize + g.Style.WindowPadding.y * 2.0f), ImGuiChildFlags_Border, ImGuiWindowFlags_HorizontalScrollbar))
+                {
+                    ImGuiWindow* timeline_window = GetCurrentWindow();
+                    ImDrawList* draw_list = timeline_window->DrawList;
+                    const ImVec2 origin = GetCursorScreenPos();
+                    const float timeline_width = GetContentRegionAvail().x * profiler->TimelineZoom;
+                    const double px_per_ns = timeline_width / ImMax((double)profiler->EventsLastFrameDurationMs * 1000000.0, 1.0);
+                    for (const ImGuiProfilerEvent& ev : profiler->EventsLastFrame)
+                    {
+                        ImRect bb;
+                        bb.Min.x = origin.x + (float)((ev.StartNs - profiler->EventsLastFrameStartNs) * px_per_ns);
+                        bb.Max.x = ImMax(origin.x + (float)((ev.EndNs - profiler->EventsLastFrameStartNs) * px_per_ns), bb.Min.x + 1.0f);
+                        bb.Min.y = origin.y + row_height * ev.Depth;
+                        bb.Max.y = bb.Min.y + row_height - 1.0f;
+                        if (!bb.Overlaps(timeline_window->ClipRect))
+                            continue;
+                        const ImGuiID name_hash = ImHashStr(ev.Name);
+                        draw_list->AddRectFilled(bb.Min, bb.Max, ImColor::HSV((name_hash & 0xFF) / 255.0f, 0.5f, 0.6f));
+                        if (bb.GetWidth() > GetFontSize() * 2)
+                            RenderTextClipped(bb.Min + ImVec2(g.Style.FramePadding.x, 0.0f), bb.Max, ev.Name, NULL, NULL, ImVec2(0.0f, 0.5f), &bb);
+                        if (IsWindowHovered() && IsMouseHoveringRect(bb.Min, bb.Max))
+                            SetTooltip("%s: %.3f ms (starts at +%.3f ms)", ev.Name, (ev.EndNs - ev.StartNs) / 1000000.0, (ev.StartNs - profiler->EventsLastFrameStartNs) / 1000000.0);
+                    }
+                    Dummy(ImVec2(timeline_width, timeline_height));
+                }
+                EndChild();
+                TreePop();
+            }
+        }
         TreePop();
     }
 
@@ -20673,6 +21799,13 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
         Text("%d current allocations", info->TotalAllocCount - info->TotalFreeCount);
         if (SmallButton("GC now")) { g.GcCompactAll = true; }
+        Text("%d consecutive frames without allocations", info->NoAllocFramesCount);
+        bool assert_steady_state = info->AssertAllocAfterFrames > 0;
+        if (Checkbox("Assert on allocation in steady state", &assert_steady_state))
+            info->AssertAllocAfterFrames = assert_steady_state ? 60 : 0;
+        SameLine();
+        MetricsHelpMarker("Assert in MemAlloc() once 60 consecutive frames were allocation-free, to catch the call-stack of allocations happening on idle/repeating frames.");
+        Text("Frame arena: %d KB capacity, %d KB used last frame, %d KB peak", (int)(g.FrameArena.GetCapacity() / 1024), (int)(g.FrameArena.UsedBytes[g.FrameArena.CurrIdx ^ 1] / 1024), (int)(g.FrameArena.PeakBytes / 1024));
         Text("Recent frames with allocations:");
         int buf_size = IM_ARRAYSIZE(info->LastEntriesBuf);
         for (int n = buf_size - 1; n >= 0; n--)
@@ -21100,6 +22233,11 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
 
     for (const ImDrawCmd* pcmd = draw_list->CmdBuffer.Data; pcmd < draw_list->CmdBuffer.Data + cmd_count; pcmd++)
     {
+        if (pcmd->UserCallback == ImDrawCallback_GpuLines)
+        {
+            BulletText("GpuLines: %4d vtx, clip_rect (%4.0f,%4.0f)-(%4.0f,%4.0f)", pcmd->ElemCount, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+            continue;
+        }
         if (pcmd->UserCallback)
         {
             BulletText("Callback %p, user_data %p", pcmd->UserCallback, pcmd->UserCallbackData);
@@ -21149,7 +22287,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
                     triangle[n] = v.pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, (float)v.pos.x, (float)v.pos.y, (float)v.uv.x, (float)v.uv.y, v.col); // Casts needed with IMGUI_USE_COMPACT_DRAWVERT
                 }
 
                 Selectable(buf, false);
@@ -21718,6 +22856,120 @@ void ImGui::DebugStartItemPicker()
     g.DebugItemPickerActive = true;
 }
 
+// [DEBUG] Profiler - time scopes with DebugProfilerScopeBegin()/DebugProfilerScopeEnd() - see Metrics->Profiler.
+static ImU64 DebugProfilerGetTimeNs()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (ImU64)((counter.QuadPart / frequency.QuadPart) * 1000000000 + ((counter.QuadPart % frequency.QuadPart) * 1000000000) / frequency.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+#else
+    return (ImU64)(clock() * (1000000000.0 / CLOCKS_PER_SEC)); // Low resolution fallback
+#endif
+}
+
+static int DebugProfilerFindOrAddScope(ImGuiProfiler* profiler, const char* name)
+{
+    for (int n = 0; n < profiler->ScopeNamesCount; n++)
+        if (profiler->ScopeNames[n] == name || strcmp(profiler->ScopeNames[n], name) == 0)
+            return n;
+    if (profiler->ScopeNamesCount == IMGUI_PROFILER_MAX_SCOPES)
+        return -1;
+    profiler->ScopeNames[profiler->ScopeNamesCount] = name;
+    return profiler->ScopeNamesCount++;
+}
+
+void ImGui::DebugProfilerScopeBegin(const char* name)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.DebugProfiler;
+    if (!profiler->Enabled)
+        return;
+    ImGuiProfilerEvent ev;
+    ev.Name = name;
+    ev.StartNs = DebugProfilerGetTimeNs();
+    ev.EndNs = 0;
+    ev.Depth = profiler->Stack.Size;
+    profiler->Stack.push_back(ev);
+    if (profiler->HookCallback)
+        profiler->HookCallback(profiler->HookUserData, name, true, ev.StartNs);
+}
+
+void ImGui::DebugProfilerScopeEnd()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.DebugProfiler;
+    if (profiler->Stack.Size == 0) // Scopes still open on NewFrame() are discarded
+        return;
+    ImGuiProfilerEvent ev = profiler->Stack.back();
+    profiler->Stack.pop_back();
+    ev.EndNs = DebugProfilerGetTimeNs();
+    if (profiler->Events.Size < IMGUI_PROFILER_MAX_EVENTS)
+        profiler->Events.push_back(ev);
+
+    ImGuiProfilerFrame* frame = &profiler->CurrentFrame;
+    const float duration_ms = (float)((double)(ev.EndNs - ev.StartNs) / 1000000.0);
+    if (ev.Depth == 0)
+        frame->TopLevelMs += duration_ms;
+    const int scope_idx = DebugProfilerFindOrAddScope(profiler, ev.Name);
+    if (scope_idx != -1)
+    {
+        frame->ScopeTimesMs[scope_idx] += duration_ms;
+        frame->ScopeCalls[scope_idx]++;
+    }
+    if (profiler->HookCallback)
+        profiler->HookCallback(profiler->HookUserData, ev.Name, false, ev.EndNs);
+}
+
+void ImGui::DebugSetProfilerHook(ImGuiProfilerHookCallback callback, void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.DebugProfiler;
+    profiler->HookCallback = callback;
+    profiler->HookUserData = user_data;
+    if (callback)
+        profiler->Enabled = true;
+}
+
+// Called at the very beginning of NewFrame(): commit last frame to history
+void ImGui::UpdateDebugToolProfiler()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.DebugProfiler;
+    if (profiler->HookCallback)
+        profiler->Enabled = true;
+    profiler->Stack.resize(0);
+    if (!profiler->Enabled)
+    {
+        profiler->Events.resize(0);
+        profiler->CurrentFrame.StartNs = 0;
+        return;
+    }
+
+    ImGuiProfilerFrame* frame = &profiler->CurrentFrame;
+    const ImU64 now = DebugProfilerGetTimeNs();
+    if (frame->StartNs != 0 && !profiler->Paused)
+    {
+        frame->DurationMs = (float)((double)(now - frame->StartNs) / 1000000.0);
+        profiler->Frames[profiler->FramesIdx] = *frame;
+        profiler->FramesIdx = (profiler->FramesIdx + 1) % IMGUI_PROFILER_FRAMES;
+        profiler->FramesCount = ImMin(profiler->FramesCount + 1, IMGUI_PROFILER_FRAMES);
+        profiler->Events.swap(profiler->EventsLastFrame);
+        profiler->EventsLastFrameStartNs = frame->StartNs;
+        profiler->EventsLastFrameDurationMs = frame->DurationMs;
+    }
+    profiler->Events.resize(0);
+    memset(frame, 0, sizeof(*frame));
+    frame->StartNs = now;
+}
+
 // [DEBUG] Item picker tool - start with DebugStartItemPicker() - useful to visually select an item and break into its call-stack.
 void ImGui::UpdateDebugToolItemPicker()
 {
@@ -21954,6 +23206,9 @@ void ImGui::DebugLogV(const char*, va_list) {}
 void ImGui::ShowDebugLogWindow(bool*) {}
 void ImGui::ShowIDStackToolWindow(bool*) {}
 void ImGui::DebugStartItemPicker() {}
+void ImGui::DebugProfilerScopeBegin(const char*) {}
+void ImGui::DebugProfilerScopeEnd() {}
+void ImGui::DebugSetProfilerHook(ImGuiProfilerHookCallback, void*) {}
 void ImGui::DebugHookIdInfo(ImGuiID, ImGuiDataType, const void*, const void*) {}
 
 #endif // #ifndef IMGUI_DISABLE_DEBUG_TOOLS
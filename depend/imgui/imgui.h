@@ -45,7 +45,7 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiWindowClass, ImGuiPayload)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextBuffer, ImGuiStorage, ImGuiTextFilter, ImGuiListClipper, ImGuiTableSortIndex, Math Operators, ImColor)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -163,7 +163,8 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawTextLayout;            // Glyph quads of a string cached by ImDrawList::AddTextCached()
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
@@ -176,17 +177,20 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store per-item heights for ImGuiListClipper::BeginVariableHeight()
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformIO;             // Multi-viewport support: interface for Platform/Renderer backends + viewports to render
 struct ImGuiPlatformMonitor;        // Multi-viewport support: user-provided bounds for each connected monitor/display. Used when positioning popups and tooltips to avoid them straddling monitors
 struct ImGuiPlatformImeData;        // Platform IME data for io.SetPlatformImeDataFn() function.
+struct ImGuiPlotBuffer;             // Helper to hold a rolling series of values for PlotLines()/PlotHistogram(), plotted in O(pixels) with a min/max pyramid
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage (container sorted by key)
 struct ImGuiStoragePair;            // Helper for key->value storage (pair)
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
+struct ImGuiTableSortIndex;         // Helper to maintain a sorted permutation of table rows, sorting over several frames and/or in parallel
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
 struct ImGuiViewport;               // A Platform Window (always 1 unless multi-viewport are enabled. One per platform window to output to). In the future may represent Platform Monitor
@@ -270,8 +274,11 @@ typedef ImWchar16 ImWchar;
 // Callback and functions types
 typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);    // Callback function for ImGui::InputText()
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
+typedef void    (*ImGuiProfilerHookCallback)(void* user_data, const char* name, bool is_begin, ImU64 time_ns); // Callback function for ImGui::DebugSetProfilerHook()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef int     (*ImGuiTableSortCompareFunc)(void* user_data, const ImGuiTableSortSpecs* sort_specs, int lhs, int rhs); // Function signature for ImGuiTableSortIndex: return <0 if item 'lhs' sorts before item 'rhs'
+typedef void    (*ImGuiParallelForFunc)(void* user_data, int jobs_count, void (*job_func)(void* job_data, int job_index), void* job_data); // Run job_func() for job_index in [0..jobs_count), possibly concurrently, and return when all are done
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -686,6 +693,8 @@ namespace ImGui
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));         // Large series: one column per pixel, covering min/max of its values.
+    IMGUI_API void          PlotHistogram(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -944,7 +953,12 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API float         GetIdleWaitTime();                                                  // call after Render(): seconds until the UI may change without any new input (text cursor blink, hover delay, fading...). 0.0f if another frame is needed right away, FLT_MAX if nothing is pending. For event-driven main loops.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
+    IMGUI_API ImDrawListSharedData* CreateDrawListSharedData();                                 // create a copy of GetDrawListSharedData() (current font and size, tessellation settings, flags), for ImDrawList instances recorded on other threads. see comments above ImDrawList.
+    IMGUI_API void          UpdateDrawListSharedData(ImDrawListSharedData* shared_data);        // refresh a copy made by CreateDrawListSharedData() with the current state. call before handing it to another thread, e.g. every frame.
+    IMGUI_API void          DestroyDrawListSharedData(ImDrawListSharedData* shared_data);
+    IMGUI_API void          AddDrawListToWindow(ImDrawList* draw_list);                         // render 'draw_list' after the current window's own draw list (over its contents, under child windows). it is not copied and only read during Render(). see comments above ImDrawList.
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
     IMGUI_API ImGuiStorage* GetStateStorage();
@@ -1023,12 +1037,21 @@ namespace ImGui
     IMGUI_API void          LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size=0); // call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source.
     IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
     IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
+    // - Binary settings store: compact and incremental alternative to .ini text, automatically used if io.IniBinaryFilename != NULL. The text format stays available as an import/export format.
+    // - A store is made of segments which can be concatenated: with only_dirty=true, SaveIniSettingsToBinary() outputs a segment holding only the entries which changed since the previous
+    //   save (or load) of the store, to be appended to it. It outputs nothing when nothing changed. Otherwise it outputs a segment holding all entries, replacing the store.
+    // - To never stall on disk I/O, set io.IniFilename and io.IniBinaryFilename to NULL, call SaveIniSettingsToBinary(&size, true) when io.WantSaveIniSettings is set and hand over a copy of the data to a thread of yours to append it to the store.
+    IMGUI_API bool          LoadIniSettingsFromBinary(const void* data, size_t data_size, size_t* out_valid_size = NULL); // call after CreateContext() and before the first call to NewFrame() to provide binary settings from your own data source. Return false if the data isn't a binary settings store. A truncated or corrupt trailing segment (e.g. interrupted append) is ignored: when *out_valid_size < data_size, replace the store instead of appending to it, or later segments won't be read.
+    IMGUI_API const void*   SaveIniSettingsToBinary(size_t* out_size, bool only_dirty = false); // return binary settings data (valid until the next call) which you can save by your own mean: append it to the store loaded/saved before if only_dirty is set, otherwise replace the store with it.
 
     // Debug Utilities
     // - Your main debugging friend is the ShowMetricsWindow() function, which is also accessible from Demo->Tools->Metrics Debugger
     IMGUI_API void          DebugTextEncoding(const char* text);
     IMGUI_API void          DebugFlashStyleColor(ImGuiCol idx);
     IMGUI_API void          DebugStartItemPicker();
+    IMGUI_API void          DebugProfilerScopeBegin(const char* name);  // Time a scope into the profiler (Metrics/Debugger->Profiler), e.g. your own update or renderer code. 'name' must be a persistent string (e.g. a literal). No-op while the profiler is disabled.
+    IMGUI_API void          DebugProfilerScopeEnd();
+    IMGUI_API void          DebugSetProfilerHook(ImGuiProfilerHookCallback callback, void* user_data = NULL); // Forward every profiler scope begin/end to an external profiler (e.g. Tracy). Keeps the profiler enabled while set. Pass NULL to remove.
     IMGUI_API bool          DebugCheckVersionAndDataLayout(const char* version_str, size_t sz_io, size_t sz_style, size_t sz_vec2, size_t sz_vec4, size_t sz_drawvert, size_t sz_drawidx); // This is called by IMGUI_CHECKVERSION() macro.
 
     // Memory Allocators
@@ -1626,6 +1649,8 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasTexUpdates = 1 << 4,   // Backend Renderer supports uploading ImFontAtlas::TexDirtyRects[] and resizing the font texture after it has been created. Required by ImFontAtlasFlags_DynamicGlyphs.
+    ImGuiBackendFlags_RendererHasGpuLines   = 1 << 5,   // Backend Renderer supports ImDrawCallback_GpuLines commands, expanding line strips into anti-aliased quads on the GPU. Required by style.AntiAliasedLinesUseGpu.
 
     // [BETA] Viewports
     ImGuiBackendFlags_PlatformHasViewports  = 1 << 10,  // Backend Platform supports multiple viewports.
@@ -2186,6 +2211,7 @@ struct ImGuiStyle
     float       MouseCursorScale;           // Scale software rendered mouse cursor (when io.MouseDrawCursor is enabled). We apply per-monitor DPI scaling over this scale. May be removed later.
     bool        AntiAliasedLines;           // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedLinesUseTex;     // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering). Latched at the beginning of the frame (copied to ImDrawList).
+    bool        AntiAliasedLinesUseGpu;     // Enable anti-aliased lines/borders expanded by the renderer on the GPU (1 vertex per point instead of 3-4, no CPU tessellation). Require backend to support ImGuiBackendFlags_RendererHasGpuLines. Joints are not mitered. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedFill;            // Enable anti-aliased edges around filled shapes (rounded rectangles, circles, etc.). Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
     float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     float       CircleTessellationMaxError; // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
@@ -2235,6 +2261,7 @@ struct ImGuiIO
     float       DeltaTime;                      // = 1.0f/60.0f     // Time elapsed since last frame, in seconds. May change every frame.
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file (important: default "imgui.ini" is relative to current working dir!). Set NULL to disable automatic .ini loading/saving or if you want to manually call LoadIniSettingsXXX() / SaveIniSettingsXXX() functions.
+    const char* IniBinaryFilename;              // = NULL           // Path to binary settings store. When set, it is used instead of IniFilename for automatic loading/saving: each save appends the entries which changed (compacting the store once it gets twice as large as needed). IniFilename is only imported when the store doesn't exist yet.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
     void*       UserData;                       // = NULL           // Store your own data.
 
@@ -2361,7 +2388,7 @@ struct ImGuiIO
     bool        WantCaptureKeyboard;                // Set when Dear ImGui will use keyboard inputs, in this case do not dispatch them to your main game/application (either way, always pass keyboard inputs to imgui). (e.g. InputText active, or an imgui window is focused and navigation is enabled, etc.).
     bool        WantTextInput;                      // Mobile/console: when set, you may display an on-screen keyboard. This is set by Dear ImGui when it wants textual keyboard input to happen (e.g. when a InputText widget is active).
     bool        WantSetMousePos;                    // MousePos has been altered, backend should reposition mouse on next frame. Rarely used! Set only when ImGuiConfigFlags_NavEnableSetMousePos flag is enabled.
-    bool        WantSaveIniSettings;                // When manual .ini load/save is active (io.IniFilename == NULL), this will be set to notify your application that you can call SaveIniSettingsToMemory() and save yourself. Important: clear io.WantSaveIniSettings yourself after saving!
+    bool        WantSaveIniSettings;                // When manual .ini load/save is active (io.IniFilename == NULL && io.IniBinaryFilename == NULL), this will be set to notify your application that you can call SaveIniSettingsToMemory() or SaveIniSettingsToBinary() and save yourself. Important: clear io.WantSaveIniSettings yourself after saving!
     bool        NavActive;                          // Keyboard/Gamepad navigation is currently allowed (will handle ImGuiKey_NavXXX events) = a window is focused and it doesn't use the ImGuiWindowFlags_NoNavInputs flag.
     bool        NavVisible;                         // Keyboard/Gamepad navigation is visible and allowed (will handle ImGuiKey_NavXXX events).
     float       Framerate;                          // Estimate of application framerate (rolling average over 60 frames, based on io.DeltaTime), in frame per second. Solely for convenience. Slow applications may not want to use a moving average or may want to reset underlying buffers occasionally.
@@ -2456,7 +2483,7 @@ struct ImGuiInputTextCallbackData
     // - During Resize callback, Buf will be same as your input buffer.
     // - However, during Completion/History/Always callback, Buf always points to our own internal data (it is not the same as your buffer)! Changes to it will be reflected into your own buffer shortly after the callback.
     // - To modify the text buffer in a callback, prefer using the InsertChars() / DeleteChars() function. InsertChars() will take care of calling the resize callback if necessary.
-    // - If you know your edits are not going to resize the underlying buffer allocation, you may modify the contents of 'Buf[]' directly. You need to update 'BufTextLen' accordingly (0 <= BufTextLen < BufSize) and set 'BufDirty'' to true so InputText can update its internal state.
+    // - If you know your edits are not going to resize the underlying buffer allocation, you may modify the contents of 'Buf[]' directly. You need to update 'BufTextLen' accordingly (0 <= BufTextLen < BufSize) and set 'BufDirty'' to true so InputText can update its internal state. The undo history is then cleared, as only InsertChars()/DeleteChars() keep a copy of the previous text. Don't mix both ways in one callback.
     ImWchar             EventChar;      // Character input                      // Read-write   // [CharFilter] Replace character with another one, or set to zero to drop. return 1 is equivalent to setting EventChar=0;
     ImGuiKey            EventKey;       // Key pressed (Up/Down/TAB)            // Read-only    // [Completion,History]
     char*               Buf;            // Text buffer                          // Read-write   // [Resize] Can replace pointer / [Completion,History,Always] Only write to pointed data, don't replace the actual pointer!
@@ -2532,7 +2559,7 @@ struct ImGuiPayload
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextBuffer, ImGuiStorage, ImGuiTextFilter, ImGuiListClipper, ImGuiTableSortIndex, Math Operators, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2552,32 +2579,6 @@ struct ImGuiOnceUponAFrame
     operator bool() const { int current_frame = ImGui::GetFrameCount(); if (RefFrame == current_frame) return false; RefFrame = current_frame; return true; }
 };
 
-// Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
-struct ImGuiTextFilter
-{
-    IMGUI_API           ImGuiTextFilter(const char* default_filter = "");
-    IMGUI_API bool      Draw(const char* label = "Filter (inc,-exc)", float width = 0.0f);  // Helper calling InputText+Build
-    IMGUI_API bool      PassFilter(const char* text, const char* text_end = NULL) const;
-    IMGUI_API void      Build();
-    void                Clear()          { InputBuf[0] = 0; Build(); }
-    bool                IsActive() const { return !Filters.empty(); }
-
-    // [Internal]
-    struct ImGuiTextRange
-    {
-        const char*     b;
-        const char*     e;
-
-        ImGuiTextRange()                                { b = e = NULL; }
-        ImGuiTextRange(const char* _b, const char* _e)  { b = _b; e = _e; }
-        bool            empty() const                   { return b == e; }
-        IMGUI_API void  split(char separator, ImVector<ImGuiTextRange>* out) const;
-    };
-    char                    InputBuf[256];
-    ImVector<ImGuiTextRange>Filters;
-    int                     CountGrep;
-};
-
 // Helper: Growable text buffer for logging/accumulating text
 // (this could be called 'ImGuiTextBuilder' / 'ImGuiStringBuilder')
 struct ImGuiTextBuffer
@@ -2613,6 +2614,7 @@ struct ImGuiStoragePair
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
 // This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// For large storages with frequent insertion (e.g. thousands of tree nodes opened at once), use SetHashMapEnabled(true).
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -2621,11 +2623,15 @@ struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+    ImVector<int>                   HashTable;      // Open addressing index into Data[] when HashMapEnabled. Size is a power of two, -1 = empty slot.
+    bool                            HashMapEnabled;
+
+    ImGuiStorage()      { HashMapEnabled = false; }
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    void                Clear() { Data.clear(); HashTable.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2646,6 +2652,11 @@ struct ImGuiStorage
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
     IMGUI_API void      BuildSortByKey();
+    // Advanced: index pairs with a hash table, for O(1) average lookup and insertion. Cheap to call every frame, e.g. ImGui::GetStateStorage()->SetHashMapEnabled(true) after Begin().
+    // - Data[] is then kept in insertion order instead of being sorted: iteration order only depends on the sequence of insertions.
+    //   Call BuildSortByKey() to sort it by key again (e.g. before persisting it), which also rebuilds the hash table.
+    // - If you modify Data[] directly, call BuildSortByKey() before the next lookup.
+    IMGUI_API void      SetHashMapEnabled(bool enabled);
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
@@ -2654,6 +2665,72 @@ struct ImGuiStorage
 #endif
 };
 
+// Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
+struct ImGuiTextFilter
+{
+    IMGUI_API           ImGuiTextFilter(const char* default_filter = "");
+    IMGUI_API bool      Draw(const char* label = "Filter (inc,-exc)", float width = 0.0f);  // Helper calling InputText+Build
+    IMGUI_API bool      PassFilter(const char* text, const char* text_end = NULL) const;
+    IMGUI_API bool      PassFilterCached(ImGuiID key, const char* text, const char* text_end = NULL); // Cache result per item key until next Build(). Use a key that changes when the item text changes.
+    IMGUI_API void      Build();
+    void                Clear()          { InputBuf[0] = 0; Build(); }
+    void                ClearCache()     { Cache.Clear(); }
+    bool                IsActive() const { return !Filters.empty(); }
+
+    // [Internal]
+    struct ImGuiTextRange
+    {
+        const char*     b;
+        const char*     e;
+
+        ImGuiTextRange()                                { b = e = NULL; }
+        ImGuiTextRange(const char* _b, const char* _e)  { b = _b; e = _e; }
+        bool            empty() const                   { return b == e; }
+        IMGUI_API void  split(char separator, ImVector<ImGuiTextRange>* out) const;
+    };
+    char                    InputBuf[256];
+    ImVector<ImGuiTextRange>Filters;
+    int                     CountGrep;
+    char                    InputBufLower[256];     // Lowered copy of InputBuf made by Build(), Filters[] ranges map to it at the same offsets
+    int                     Generation;             // Incremented by Build(), invalidates Cache
+    ImGuiStorage            Cache;                  // PassFilterCached() results: key -> (Generation << 1) | pass
+};
+
+// Helper: Per-item heights for ImGuiListClipper::BeginVariableHeight(), when items are not evenly spaced.
+// Heights are indexed with a prefix-sum tree (Fenwick tree) so offset <-> item lookups and height updates are O(log N).
+// Keep one instance per list around (e.g. next to your data), size it with Resize() or Build(), then refine heights with
+// SetHeight() as you get to know them, typically after submitting an item (measure the cursor before/after).
+// The clipper records the first visible item: when the heights of items above it change, scrolling is adjusted on the
+// following frame so the visible items don't jump.
+// Usage:
+//   static ImGuiListClipperHeights heights;
+//   if (heights.GetCount() != items_count) heights.Resize(items_count, ImGui::GetTextLineHeightWithSpacing());
+//   ImGuiListClipper clipper;
+//   clipper.BeginVariableHeight(&heights);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//       {
+//           float y0 = ImGui::GetCursorPosY();
+//           DrawMyItem(i);
+//           heights.SetHeight(i, ImGui::GetCursorPosY() - y0);
+//       }
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     Heights;        // Height of each item, including item spacing
+    ImVector<double>    Tree;           // [Internal] Fenwick tree over Heights[], 1-based (Tree.Size == Heights.Size + 1)
+    int                 AnchorItem;     // [Internal] First visible item on last use, -1 if none
+    double              AnchorOffset;   // [Internal] Offset of AnchorItem on last use
+
+    ImGuiListClipperHeights()           { AnchorItem = -1; AnchorOffset = 0.0; }
+    int                 GetCount() const            { return Heights.Size; }
+    float               GetHeight(int n) const      { IM_ASSERT(n >= 0 && n < Heights.Size); return Heights.Data[n]; }
+    IMGUI_API void      Resize(int count, float default_height);                                    // Keep existing heights, new items are set to default_height. O(N).
+    IMGUI_API void      Build(int count, float (*height_func)(void* user_data, int n), void* user_data); // Query all heights from a callback. O(N).
+    IMGUI_API void      SetHeight(int n, float height);                                             // O(log N)
+    IMGUI_API double    GetOffset(int n) const;                                                     // Sum of heights of items [0..n). O(log N)
+    IMGUI_API int       FindItemAtOffset(double offset) const;                                      // Item containing 'offset', clamped to [0..count-1]. O(log N)
+};
+
 // Helper: Manually clip large list of items.
 // If you have lots evenly spaced items and you have random access to the list, you can perform coarse
 // clipping based on visibility to only submit items that are in view.
@@ -2682,6 +2759,7 @@ struct ImGuiListClipper
     int             ItemsCount;         // [Internal] Number of items
     float           ItemsHeight;        // [Internal] Height of item after a first step and item submission can calculate it
     float           StartPosY;          // [Internal] Cursor position at the time of Begin() or after table frozen rows are all processed
+    ImGuiListClipperHeights* VariableHeights; // [Internal] Per-item heights when using BeginVariableHeight(), NULL otherwise
     void*           TempData;           // [Internal] Internal data
 
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step)
@@ -2689,6 +2767,7 @@ struct ImGuiListClipper
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  BeginVariableHeight(ImGuiListClipperHeights* heights); // Items of different heights: 'heights' must stay valid until End() and is typically persistent (see ImGuiListClipperHeights).
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2704,6 +2783,75 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Maintain a sorted permutation of table rows without moving your data.
+// - Sorting is a stable merge sort over item indices, started when sort specs are dirty or the items count changed.
+// - Set MaxItemsPerFrame to spread the work over several frames: Order[] keeps the previous order until the new one is complete.
+// - Set ParallelFor to run each merge pass on your job system (CompareFunc will then be called concurrently).
+// - Combine with ImGuiListClipper so only visible rows are dereferenced.
+// Usage:
+//   static ImGuiTableSortIndex sort_index;   // Persistent, one per table
+//   sort_index.CompareFunc = MyCompare;      // int MyCompare(void* user_data, const ImGuiTableSortSpecs* sort_specs, int lhs, int rhs)
+//   sort_index.CompareUserData = &my_items;
+//   [...] TableHeadersRow();
+//   sort_index.Update(ImGui::TableGetSortSpecs(), my_items.Size);
+//   ImGuiListClipper clipper;
+//   clipper.Begin(my_items.Size);
+//   while (clipper.Step())
+//       for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+//           DrawRow(my_items[sort_index.Order[row_n]]);
+// The item data must not change while a sort is in progress (IsSorting()), call Invalidate() after modifying it.
+struct ImGuiTableSortIndex
+{
+    ImVector<int>               Order;              // Displayed order: Order[row_n] = item index. Kept sized to items count by Update().
+    ImGuiTableSortCompareFunc   CompareFunc;        // Compare two items. Receives a copy of the sort specs, valid for the duration of the sort.
+    void*                       CompareUserData;
+    ImGuiParallelForFunc        ParallelFor;        // Optional: dispatch independent jobs of a merge pass to worker threads.
+    void*                       ParallelForUserData;
+    int                         MaxItemsPerFrame;   // Sorting budget per Update() call, in items merged. 0: sort to completion in Update().
+    int                         Generation;         // Incremented every time a sort is started
+    int                         OrderGeneration;    // Generation of the sort which produced Order[], 0 if never sorted
+
+    // [Internal]
+    ImVector<ImGuiTableColumnSortSpecs> SpecsCopy;
+    ImGuiTableSortSpecs         Specs;              // Points to SpecsCopy
+    ImVector<int>               SortBuf;            // Sorted runs of SortWidth items
+    ImVector<int>               SortTmp;
+    int                         SortWidth;          // Width of sorted runs in SortBuf, 0 when not sorting
+    int                         SortBlock;          // Next block to process in current pass
+    bool                        WantSort;
+
+    ImGuiTableSortIndex()       { CompareFunc = NULL; CompareUserData = NULL; ParallelFor = NULL; ParallelForUserData = NULL; MaxItemsPerFrame = 0; Generation = OrderGeneration = 0; SortWidth = SortBlock = 0; WantSort = false; }
+    IMGUI_API bool              Update(ImGuiTableSortSpecs* sort_specs, int items_count);   // Call every frame after TableGetSortSpecs(). Clears sort_specs->SpecsDirty. Return true when Order[] changed.
+    void                        Invalidate()        { WantSort = true; }                   // Request a new sort on next Update(), e.g. after modifying sorted fields.
+    bool                        IsSorting() const   { return SortWidth != 0; }
+};
+
+// Helper: Rolling series of values for PlotLines()/PlotHistogram(), indexed with a min/max pyramid so large series are plotted in O(pixels).
+// - When there are more values than pixels, each column of the plot covers the min and max of all the values it spans: spikes never disappear.
+// - Adding or modifying a value is O(log N). Once Capacity values have been added, new values overwrite the oldest ones.
+// Usage:
+//   static ImGuiPlotBuffer frame_times(100000);
+//   frame_times.AddValue(ImGui::GetIO().DeltaTime * 1000.0f);
+//   ImGui::PlotLines("Frame times", &frame_times, NULL, 0.0f, 50.0f, ImVec2(0, 80));
+struct ImGuiPlotBuffer
+{
+    ImVector<float>     Values;         // Ring buffer of Capacity values. Values[Offset] is the oldest one.
+    ImVector<ImVec2>    Tree;           // [Internal] Min (x) and max (y) pyramid: node n covers nodes n*2 and n*2+1, node TreeSize+i is Values[i]. Only nodes [1..TreeSize-1] are stored.
+    int                 TreeSize;       // [Internal] Power of two >= Capacity
+    int                 Count;          // Number of values, <= Capacity
+    int                 Offset;         // Index of the oldest value in Values[]
+
+    ImGuiPlotBuffer(int capacity = 0)   { TreeSize = Count = Offset = 0; if (capacity > 0) SetCapacity(capacity); }
+    int                 GetCapacity() const         { return Values.Size; }
+    int                 GetCount() const            { return Count; }
+    float               GetValue(int n) const       { IM_ASSERT(n >= 0 && n < Count); n += Offset; return Values.Data[n < Values.Size ? n : n - Values.Size]; } // n = 0 is the oldest value
+    IMGUI_API void      SetCapacity(int capacity);                  // Clear and resize. O(N).
+    IMGUI_API void      Clear();                                    // O(N)
+    IMGUI_API void      AddValue(float v);                          // Append, overwriting the oldest value when full. O(log N).
+    IMGUI_API void      SetValue(int n, float v);                   // O(log N)
+    IMGUI_API ImVec2    GetMinMax(int n_begin, int n_end) const;    // Min (x) and max (y) of values [n_begin..n_end), ignoring NaN. (FLT_MAX,-FLT_MAX) when there are none. O(log N).
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2804,6 +2952,13 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // Render state is not reset by default because they are many perfectly useful way of altering render state (e.g. changing shader/blending settings before an Image call).
 #define ImDrawCallback_ResetRenderState     (ImDrawCallback)(-8)
 
+// Special Draw callback value marking a command made of anti-aliased line strips, to be expanded by the renderer backend. Only emitted with ImDrawListFlags_AntiAliasedLinesUseGpu.
+// - ElemCount indices refer to consecutive vertices. Each vertex N < ElemCount-1 is the start of a segment going to vertex N+1.
+// - For a segment starting at vertex N: pos = start point, uv.x = thickness (0.0f: no segment, ends a strip), uv.y = AA fringe size, col = color.
+//   With IMGUI_USE_COMPACT_DRAWVERT, uv values are scaled by IM_DRAWVERT_POS_SCALE/65535: read unnormalized, the 16-bit uv are in the same fixed-point units as pos.
+// - Expected output matches the CPU path: a quad of half width max(fringe, (thickness + fringe) * 0.5f) along the segment, alpha fading to 0 over 'fringe' pixels at the edges.
+#define ImDrawCallback_GpuLines             (ImDrawCallback)(-9)
+
 // Typically, 1 command = 1 GPU draw call (unless command is a callback)
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
@@ -2826,7 +2981,47 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Compact vertex layout (12 bytes instead of 20), enabled with IMGUI_USE_COMPACT_DRAWVERT in imconfig.h. Renderer backend needs to support it.
+// Components convert from/to float on access, so code reading or writing ImDrawVert doesn't need to know about the layout:
+// - pos: 16-bit signed fixed-point in 1/IM_DRAWVERT_POS_SCALE pixel steps: covers [-8192,+8192) with the default scale. Values outside are clamped.
+// - uv: 16-bit unsigned normalized, clamped to [0,1]. Textures can't be repeated by using uv outside of this range.
+#ifndef IM_DRAWVERT_POS_SCALE
+#define IM_DRAWVERT_POS_SCALE   4
+#endif
+struct ImDrawVertPosComponent
+{
+    ImS16   Value;
+    operator float() const                          { return Value * (1.0f / IM_DRAWVERT_POS_SCALE); }
+    ImDrawVertPosComponent& operator=(float f)      { f *= IM_DRAWVERT_POS_SCALE; f = (f < -32768.0f) ? -32768.0f : (f > 32767.0f) ? 32767.0f : f; Value = (ImS16)(int)(f + (f >= 0.0f ? 0.5f : -0.5f)); return *this; }
+    ImDrawVertPosComponent& operator+=(float f)     { return *this = (float)*this + f; }
+    ImDrawVertPosComponent& operator-=(float f)     { return *this = (float)*this - f; }
+};
+struct ImDrawVertUvComponent
+{
+    ImU16   Value;
+    operator float() const                          { return Value * (1.0f / 65535.0f); }
+    ImDrawVertUvComponent& operator=(float f)       { f *= 65535.0f; f = (f < 0.0f) ? 0.0f : (f > 65535.0f) ? 65535.0f : f; Value = (ImU16)(int)(f + 0.5f); return *this; }
+};
+struct ImDrawVertPos
+{
+    ImDrawVertPosComponent  x, y;
+    operator ImVec2() const                         { return ImVec2(x, y); }
+    ImDrawVertPos& operator=(const ImVec2& v)       { x = v.x; y = v.y; return *this; }
+};
+struct ImDrawVertUv
+{
+    ImDrawVertUvComponent   x, y;
+    operator ImVec2() const                         { return ImVec2(x, y); }
+    ImDrawVertUv& operator=(const ImVec2& v)        { x = v.x; y = v.y; return *this; }
+};
+struct ImDrawVert
+{
+    ImDrawVertPos   pos;    // 4
+    ImDrawVertUv    uv;     // 4
+    ImU32           col;    // 4
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -2859,21 +3054,43 @@ struct ImDrawChannel
 
 // Split/Merge functions are used to split the draw list into different layers which can be drawn into out of order.
 // This is used by the Columns/Tables API, so items of each column can be batched together in a same draw call.
+// SplitSharedIndices() is a variant where all channels write to the draw list index buffer directly and Merge() only reorders
+// draw commands: no index copy and no per-channel index storage, but neighboring commands from different channels can only be
+// fused when their indices are contiguous. Prefer it when channels are switched rarely (e.g. background/foreground layers).
 struct ImDrawListSplitter
 {
     int                         _Current;    // Current channel number (0)
     int                         _Count;      // Number of active channels (1+)
     ImVector<ImDrawChannel>     _Channels;   // Draw channels (not resized down so _Count might be < Channels.Size)
+    bool                        _SharedIdx;  // Channels use draw_list->IdxBuffer directly (SplitSharedIndices())
 
     inline ImDrawListSplitter()  { memset(this, 0, sizeof(*this)); }
     inline ~ImDrawListSplitter() { ClearFreeMemory(); }
-    inline void                 Clear() { _Current = 0; _Count = 1; } // Do not clear Channels[] so our allocations are reused next frame
+    inline void                 Clear() { _Current = 0; _Count = 1; _SharedIdx = false; } // Do not clear Channels[] so our allocations are reused next frame
     IMGUI_API void              ClearFreeMemory();
+    IMGUI_API void              ClearFreeMemoryUnusedChannels(int channels_keep); // Free memory of channels >= channels_keep. Call while not split.
     IMGUI_API void              Split(ImDrawList* draw_list, int count);
+    IMGUI_API void              SplitSharedIndices(ImDrawList* draw_list, int count);
     IMGUI_API void              Merge(ImDrawList* draw_list);
     IMGUI_API void              SetCurrentChannel(ImDrawList* draw_list, int channel_idx);
 };
 
+// [Internal] Glyph quads of a string laid out by ImDrawList::AddTextCached(), relative to the (truncated) text position.
+struct ImDrawTextLayout
+{
+    ImGuiID                 Key;            // Hash of layout id + font + font size + wrap width
+    const ImFont*           Font;
+    float                   FontSize;
+    float                   WrapWidth;
+    int                     TexGeneration;  // ImFontAtlas::TexGeneration when the quads were built
+    int                     LastUsedFrame;  // ImDrawList::_TextLayoutsFrame when last drawn, for LRU eviction
+    ImVec2                  BoundsMin;      // Bounding box of all quads
+    ImVec2                  BoundsMax;
+    ImVector<ImDrawVert>    VtxBuffer;      // 4 vertices per glyph quad. 'col' is 1 for colored glyphs (drawn untinted), 0 for tinted ones.
+
+    ImDrawTextLayout()      { memset(this, 0, sizeof(*this)); }
+};
+
 // Flags for ImDrawList functions
 // (Legacy: bit 0 must always correspond to ImDrawFlags_Closed to be backward compatible with old API using a bool. Bits 1..3 must be unused)
 enum ImDrawFlags_
@@ -2903,6 +3120,7 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AntiAliasedLinesUseGpu  = 1 << 4,  // Emit anti-aliased lines/borders as ImDrawCallback_GpuLines commands instead of triangles. Require 'ImGuiBackendFlags_RendererHasGpuLines'. Takes precedence over ImDrawListFlags_AntiAliasedLinesUseTex.
 };
 
 // Draw command list
@@ -2914,6 +3132,22 @@ enum ImDrawListFlags_
 // In single viewport mode, top-left is == GetMainViewport()->Pos (generally 0,0), bottom-right is == GetMainViewport()->Pos+Size (generally io.DisplaySize).
 // You are totally free to apply whatever transformation matrix to want to the data (depending on the use of the transformation you may want to apply it to ClipRect as well!)
 // Important: Primitives are always added to the list and not culled (culling is done at higher-level by ImGui:: functions), if you use this API a lot consider coarse culling your drawn objects.
+// Recording on other threads:
+// - ImDrawList functions don't access the ImGui context, so standalone instances may be recorded on worker threads while the main thread submits widgets.
+//   Each thread needs its own ImDrawListSharedData (it holds a temporary buffer): use ImGui::CreateDrawListSharedData() and refresh it with
+//   ImGui::UpdateDrawListSharedData() on the main thread before starting the worker, as the font or the display size may have changed.
+// - On the worker: call _ResetForNewFrame(), PushTextureID() (e.g. io.Fonts->TexID), PushClipRect(), then add primitives.
+// - Text: the font atlas is shared and read-only for workers. With ImFontAtlasFlags_DynamicGlyphs, glyphs which aren't rasterized yet are
+//   skipped rather than rasterized (ImDrawListSharedData::NoDynamicGlyphs). While any copy made by CreateDrawListSharedData() exists, the
+//   main thread doesn't write to the atlas either: glyphs first used by widgets (or passed to ImFont::PreloadGlyphs()) are rasterized by the
+//   next NewFrame(), so they show up one frame late. Call ImFont::PreloadGlyphs() on the main thread for text you will render on workers,
+//   don't record across NewFrame(), and don't rebuild the atlas while workers are recording.
+// - On the main thread, inside a Begin()/End() pair: ImGui::AddDrawListToWindow() renders the list right after the window's own draw list.
+//   Alternatively, after Render(), ImDrawData::AddDrawList() appends it to a viewport's draw data. In both cases the list is referenced, not copied.
+// - Ownership: you own the ImDrawList and its ImDrawListSharedData. Recording must be finished before Render() (which reads the list), and the
+//   list must be left untouched and alive until your renderer is done with the ImDrawData. Call AddDrawListToWindow() again every frame.
+// - Allocations made while recording go through ImGui::MemAlloc(). The context's debug allocation counters (Metrics->Memory allocations,
+//   ImGuiDebugAllocInfo::AssertAllocAfterFrames) only track the thread calling NewFrame(), so allocations made by workers are not counted.
 struct ImDrawList
 {
     // This is what you have to render
@@ -2934,6 +3168,9 @@ struct ImDrawList
     ImVector<ImTextureID>   _TextureIdStack;    // [Internal]
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
+    ImVector<ImDrawTextLayout> _TextLayouts;    // [Internal] cached layouts for AddTextCached()
+    ImGuiStorage            _TextLayoutsMap;    // [Internal] ImDrawTextLayout::Key -> index in _TextLayouts
+    int                     _TextLayoutsFrame;  // [Internal] incremented by _ResetForNewFrame()
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
     ImDrawList(ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); _Data = shared_data; }
@@ -2970,6 +3207,7 @@ struct ImDrawList
     IMGUI_API void  AddEllipseFilled(const ImVec2& center, const ImVec2& radius, ImU32 col, float rot = 0.0f, int num_segments = 0);
     IMGUI_API void  AddText(const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL);
     IMGUI_API void  AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL, float wrap_width = 0.0f, const ImVec4* cpu_fine_clip_rect = NULL);
+    IMGUI_API void  AddTextCached(ImGuiID layout_id, const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL, float wrap_width = 0.0f); // Same as AddText() but reuse the glyph quads laid out on previous frames. layout_id == 0: use ImHashStr() of the text. For static labels: every distinct string takes a cache slot.
     IMGUI_API void  AddBezierCubic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0); // Cubic Bezier (4 control points)
     IMGUI_API void  AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness, int num_segments = 0);               // Quadratic Bezier (3 control points)
 
@@ -2980,6 +3218,17 @@ struct ImDrawList
     IMGUI_API void  AddConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col);
     IMGUI_API void  AddConcavePolyFilled(const ImVec2* points, int num_points, ImU32 col);
 
+    // Bulk primitives
+    // - Draw 'count' primitives with a single call, e.g. map overlays made of many thousands of lines. Same output as calling AddLine(), AddRectFilled(), AddCircle(), AddCircleFilled() for each of them.
+    // - Input is struct-of-arrays: one array per attribute. 'cols' is optional: when not NULL, cols[n] is used instead of 'col' for primitive n.
+    // - Primitives entirely outside of the current clip rectangle are culled (4 coordinates at a time with SSE). Lines and rectangles reserve and tessellate in batches.
+    // - AddLinesIndexed(): draw lines between points[indices[n*2+0]] and points[indices[n*2+1]], so vertices shared by several lines are transformed once by the caller.
+    IMGUI_API void  AddLines(const ImVec2* p1, const ImVec2* p2, int count, ImU32 col, float thickness = 1.0f, const ImU32* cols = NULL);
+    IMGUI_API void  AddLinesIndexed(const ImVec2* points, const int* indices, int count, ImU32 col, float thickness = 1.0f, const ImU32* cols = NULL);
+    IMGUI_API void  AddRectsFilled(const ImVec2* p_min, const ImVec2* p_max, int count, ImU32 col, const ImU32* cols = NULL);
+    IMGUI_API void  AddCircles(const ImVec2* centers, const float* radii, int count, ImU32 col, int num_segments = 0, float thickness = 1.0f, const ImU32* cols = NULL);
+    IMGUI_API void  AddCirclesFilled(const ImVec2* centers, const float* radii, int count, ImU32 col, int num_segments = 0, const ImU32* cols = NULL);
+
     // Image primitives
     // - Read FAQ to understand what ImTextureID is.
     // - "p_min" and "p_max" represent the upper-left and lower-right corners of the rectangle.
@@ -3041,6 +3290,7 @@ struct ImDrawList
     // [Internal helpers]
     IMGUI_API void  _ResetForNewFrame();
     IMGUI_API void  _ClearFreeMemory();
+    IMGUI_API void  _ClearTextLayouts();
     IMGUI_API void  _PopUnusedDrawCmd();
     IMGUI_API void  _TryMergeDrawCmds();
     IMGUI_API void  _OnChangedClipRect();
@@ -3147,6 +3397,13 @@ struct ImFontAtlasCustomRect
     bool IsPacked() const           { return X != 0xFFFF; }
 };
 
+// Region of the font atlas texture which needs to be uploaded again, see ImFontAtlas::TexDirtyRects.
+struct ImFontAtlasTexRect
+{
+    unsigned short  X, Y;           // Upper-left corner, in pixels
+    unsigned short  Width, Height;  // Size, in pixels
+};
+
 // Flags for ImFontAtlas build
 enum ImFontAtlasFlags_
 {
@@ -3154,6 +3411,7 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 3,   // Only rasterize Basic Latin + Latin-1 glyphs in Build(), other glyphs are rasterized the first time they are rendered. Requires the stb_truetype builder and a backend with ImGuiBackendFlags_RendererHasTexUpdates. Don't call ClearTexData() after upload!
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3261,10 +3519,14 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVector<ImFontAtlasTexRect> TexDirtyRects;     // Regions of TexPixelsAlpha8/TexPixelsRGBA32 modified since the texture was last uploaded (ImFontAtlasFlags_DynamicGlyphs). Backend uploads them then clears the list. TexWidth/TexHeight may also have grown, in which case the whole texture needs to be uploaded again.
+    int                         TexGeneration;      // Incremented every time glyph UVs may have changed (Build(), texture growth, queued glyphs rasterized). Invalidates ImDrawList::AddTextCached() layouts.
+    bool                        DynamicGlyphsQueued; // Set while draw lists may be recorded on other threads (see ImGui::CreateDrawListSharedData()): glyphs are then rasterized by the next ImGui::NewFrame() rather than on first use.
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
     unsigned int                FontBuilderFlags;   // Shared flags (for all fonts) for custom font builder. THIS IS BUILD IMPLEMENTATION DEPENDENT. Per-font override is also available in ImFontConfig.
+    void*                       FontBuilderDynamicData; // Retained packing/rasterizing state for ImFontAtlasFlags_DynamicGlyphs (NULL otherwise).
 
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
@@ -3303,6 +3565,7 @@ struct ImFont
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
+    const ImFontGlyph*          AsciiGlyphs[128];   // 512-1024 // out // = FindGlyph(c) for c < 128. Dense table used by the ASCII fast path of RenderText().
 
     // Methods
     IMGUI_API ImFont();
@@ -3319,6 +3582,7 @@ struct ImFont
     IMGUI_API const char*       CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const;
     IMGUI_API void              RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c) const;
     IMGUI_API void              RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width = 0.0f, bool cpu_fine_clip = false) const;
+    IMGUI_API void              PreloadGlyphs(const char* text_begin, const char* text_end = NULL); // With ImFontAtlasFlags_DynamicGlyphs: rasterize the glyphs of a string (now, or by next NewFrame() if ImFontAtlas::DynamicGlyphsQueued is set). Call on the main thread for text rendered by draw lists recorded on other threads.
 
     // [Internal] Don't use!
     IMGUI_API void              BuildLookupTable();
@@ -0,0 +1,150 @@
+// dear imgui: ImHashStr()/ImHashData() micro-benchmark
+// Compares the compiled implementation (lookup table, ARMv8 CRC32, or CRC32C with IMGUI_USE_CRC32C) against a
+// reference lookup table implementation of the same polynomial, and verifies they produce the same IDs.
+// Build and run with 'zig build bench-imhash'. Output is one 'name value unit' line per measurement.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#if defined(IMGUI_USE_CRC32C)
+static const ImU32 REF_POLYNOMIAL = 0x82F63B78; // CRC32C (Castagnoli), reflected
+#else
+static const ImU32 REF_POLYNOMIAL = 0xEDB88320; // CRC32, reflected
+#endif
+
+static ImU32 RefLookupTable[256];
+
+static void RefBuildLookupTable()
+{
+    for (ImU32 i = 0; i < 256; i++)
+    {
+        ImU32 crc = i;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (REF_POLYNOMIAL & (0u - (crc & 1)));
+        RefLookupTable[i] = crc;
+    }
+}
+
+// Same algorithm as the lookup table versions in imgui.cpp
+static ImGuiID RefHashData(const void* data_p, size_t data_size, ImGuiID seed)
+{
+    ImU32 crc = ~seed;
+    const unsigned char* data = (const unsigned char*)data_p;
+    while (data_size-- != 0)
+        crc = (crc >> 8) ^ RefLookupTable[(crc & 0xFF) ^ *data++];
+    return ~crc;
+}
+
+static ImGuiID RefHashStr(const char* data_p, size_t data_size, ImGuiID seed)
+{
+    seed = ~seed;
+    ImU32 crc = seed;
+    const unsigned char* data = (const unsigned char*)data_p;
+    if (data_size != 0)
+    {
+        while (data_size-- != 0)
+        {
+            unsigned char c = *data++;
+            if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
+                crc = seed;
+            crc = (crc >> 8) ^ RefLookupTable[(crc & 0xFF) ^ c];
+        }
+    }
+    else
+    {
+        while (unsigned char c = *data++)
+        {
+            if (c == '#' && data[0] == '#' && data[1] == '#')
+                crc = seed;
+            crc = (crc >> 8) ^ RefLookupTable[(crc & 0xFF) ^ c];
+        }
+    }
+    return ~crc;
+}
+
+// Typical widget labels/IDs: short labels, hidden labels, "###" overrides, formatted table cells and long paths
+static const char* const BenchLabels[] =
+{
+    "OK", "Cancel", "##hidden", "Enabled", "Open file...", "Label###StableId", "##Table", "Column 3",
+    "Properties", "Transform###transform", "textures/flats/FLOOR4_8", "maps/MAP01/THINGS", "Row 1024 Cell 7",
+    "A fairly long label that could be a tooltip or a menu item with a shortcut",
+    "####", "#", "##", "a###b###c", "sprites/monsters/imp/TROOA1", "Look at this very long path/to/some/lump/inside/a/pk3/file.zs",
+};
+static const int BenchIterations = 2000000;
+
+template<typename FUNC>
+static double BenchNanosecondsPerCall(FUNC func, ImGuiID* out_acc)
+{
+    const int labels_count = IM_ARRAYSIZE(BenchLabels);
+    ImGuiID acc = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < BenchIterations; n++)
+        acc = func(BenchLabels[n % labels_count], acc);
+    const auto t1 = std::chrono::steady_clock::now();
+    *out_acc = acc; // Chain results so calls can't be elided
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / BenchIterations;
+}
+
+int main(int, char**)
+{
+#if defined(IMGUI_ENABLE_SSE4_2_CRC32)
+    const char* impl_name = "sse42_crc32c";
+#elif defined(IMGUI_ENABLE_ARM_CRC32) && defined(IMGUI_USE_CRC32C)
+    const char* impl_name = "armv8_crc32c";
+#elif defined(IMGUI_ENABLE_ARM_CRC32)
+    const char* impl_name = "armv8_crc32";
+#else
+    const char* impl_name = "table_crc32";
+#endif
+    RefBuildLookupTable();
+
+    // Verify
+    int errors = 0;
+    for (const char* label : BenchLabels)
+    {
+        const size_t len = strlen(label);
+        for (ImGuiID seed : { 0u, 0x12345678u })
+        {
+            errors += (ImHashStr(label, 0, seed) != RefHashStr(label, 0, seed));
+            errors += (ImHashStr(label, len, seed) != RefHashStr(label, len, seed));
+            for (size_t sub_len = 1; sub_len <= len; sub_len++)
+                errors += (ImHashData(label, sub_len, seed) != RefHashData(label, sub_len, seed));
+        }
+    }
+    printf("imhash.impl %s\n", impl_name);
+    printf("imhash.mismatches %d count\n", errors);
+
+    // Measure
+    ImGuiID acc_ref, acc_impl;
+    const double str_ref = BenchNanosecondsPerCall([](const char* s, ImGuiID seed) { return RefHashStr(s, 0, seed); }, &acc_ref);
+    const double str_impl = BenchNanosecondsPerCall([](const char* s, ImGuiID seed) { return ImHashStr(s, 0, seed); }, &acc_impl);
+    errors += (acc_ref != acc_impl);
+    printf("imhash.str.reference %.2f ns\n", str_ref);
+    printf("imhash.str.%s %.2f ns\n", impl_name, str_impl);
+
+    const double data_ref = BenchNanosecondsPerCall([](const char* s, ImGuiID seed) { return RefHashData(s, strlen(s), seed); }, &acc_ref);
+    const double data_impl = BenchNanosecondsPerCall([](const char* s, ImGuiID seed) { return ImHashData(s, strlen(s), seed); }, &acc_impl);
+    errors += (acc_ref != acc_impl);
+    printf("imhash.data.reference %.2f ns\n", data_ref);
+    printf("imhash.data.%s %.2f ns\n", impl_name, data_impl);
+
+    const int int_count = BenchIterations;
+    ImGuiID acc = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < int_count; n++)
+        acc = RefHashData(&n, sizeof(n), acc);
+    auto t1 = std::chrono::steady_clock::now();
+    printf("imhash.int.reference %.2f ns\n", std::chrono::duration<double, std::nano>(t1 - t0).count() / int_count);
+    ImGuiID acc2 = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < int_count; n++)
+        acc2 = ImHashData(&n, sizeof(n), acc2);
+    t1 = std::chrono::steady_clock::now();
+    printf("imhash.int.%s %.2f ns\n", impl_name, std::chrono::duration<double, std::nano>(t1 - t0).count() / int_count);
+    errors += (acc != acc2);
+
+    return errors == 0 ? 0 : 1;
+}
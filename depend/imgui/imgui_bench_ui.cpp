@@ -0,0 +1,257 @@
+// dear imgui: UI workload benchmark
+// Runs fixed workloads headless (no platform or renderer backend: draw data is generated but not drawn) and reports per frame averages
+// of NewFrame(), widget submission and Render() timings, vertex/index/command counts and heap allocations.
+// Build and run with 'zig build bench-imgui'. Output is one 'name value unit' line per measurement.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+static const int BenchWarmupFrames = 10;
+static const int BenchFrames = 100;
+
+//-----------------------------------------------------------------------------
+// Allocation counting
+//-----------------------------------------------------------------------------
+
+struct BenchAllocCounters
+{
+    ImU64   AllocCount;
+    ImU64   AllocBytes;
+};
+
+static void* BenchMemAlloc(size_t size, void* user_data)
+{
+    BenchAllocCounters* counters = (BenchAllocCounters*)user_data;
+    counters->AllocCount++;
+    counters->AllocBytes += size;
+    return malloc(size);
+}
+
+static void BenchMemFree(void* ptr, void*)
+{
+    free(ptr);
+}
+
+//-----------------------------------------------------------------------------
+// Workloads
+//-----------------------------------------------------------------------------
+
+// Each workload submits one full-screen window worth of widgets per frame.
+static void BeginBenchWindow(const char* name)
+{
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(viewport->Pos);
+    ImGui::SetNextWindowSize(viewport->Size);
+    ImGui::Begin(name, NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+}
+
+// 100k rows x 6 columns, clipped: cost should be independent of the row count.
+static void WorkloadTable100k()
+{
+    BeginBenchWindow("Table");
+    const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Sortable;
+    if (ImGui::BeginTable("table", 6, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Type");
+        ImGui::TableSetupColumn("Size");
+        ImGui::TableSetupColumn("Offset");
+        ImGui::TableSetupColumn("Flags");
+        ImGui::TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(100000);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%d", row);
+                ImGui::TableNextColumn(); ImGui::Text("LUMP%05d", row);
+                ImGui::TableNextColumn(); ImGui::TextUnformatted((row % 3) == 0 ? "Flat" : (row % 3) == 1 ? "Sprite" : "Sound");
+                ImGui::TableNextColumn(); ImGui::Text("%d", (row * 7919) % 65536);
+                ImGui::TableNextColumn(); ImGui::Text("0x%08X", row * 16);
+                ImGui::TableNextColumn(); ImGui::Text("%c%c", (row & 1) ? 'C' : '-', (row & 2) ? 'M' : '-');
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// 10k tree nodes, every 50th one open with 4 leaves, unclipped by the caller: most are culled by the window.
+static void WorkloadTree10k()
+{
+    BeginBenchWindow("Tree");
+    for (int n = 0; n < 10000; n++)
+    {
+        ImGui::SetNextItemOpen((n % 50) == 0, ImGuiCond_Always);
+        if (ImGui::TreeNode((void*)(intptr_t)n, "Node %d", n))
+        {
+            for (int leaf = 0; leaf < 4; leaf++)
+                ImGui::TreeNodeEx((void*)(intptr_t)leaf, ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen, "Leaf %d", leaf);
+            ImGui::TreePop();
+        }
+    }
+    ImGui::End();
+}
+
+// ~1.4 MB multi-line text (20k lines), being edited: the active InputText path is the expensive one.
+static char* LargeTextBuf = NULL;
+static const size_t LargeTextBufSize = 2 * 1024 * 1024;
+
+static void WorkloadInputTextLarge()
+{
+    if (LargeTextBuf == NULL)
+    {
+        LargeTextBuf = (char*)malloc(LargeTextBufSize);
+        char* p = LargeTextBuf;
+        for (int line = 0; line < 20000; line++)
+            p += sprintf(p, "%05d: actor DoomImp : Actor replaces DoomImp { Health %d; Speed 8; }\n", line, line % 200);
+    }
+    BeginBenchWindow("InputText");
+    if (ImGui::GetFrameCount() <= 1)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##text", LargeTextBuf, LargeTextBufSize, ImVec2(-FLT_MIN, -FLT_MIN));
+    ImGui::End();
+}
+
+// Dense wall of unclipped text: one TextUnformatted() call per line, every glyph visible.
+static void WorkloadTextWall()
+{
+    BeginBenchWindow("TextWall");
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0.0f, 0.0f));
+    const char* line = "The quick brown fox jumps over the lazy dog. 0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~ THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG.";
+    const int lines_count = (int)(ImGui::GetContentRegionAvail().y / ImGui::GetTextLineHeight());
+    for (int n = 0; n < lines_count; n++)
+        ImGui::TextUnformatted(line);
+    ImGui::PopStyleVar();
+    ImGui::End();
+}
+
+// Line-heavy canvas: 20k individual AddLine() calls plus a 20k points polyline.
+static void WorkloadCanvasLines()
+{
+    BeginBenchWindow("Canvas");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const ImVec2 size = ImGui::GetContentRegionAvail();
+    for (int n = 0; n < 20000; n++)
+    {
+        const float t = (float)n / 20000.0f;
+        const ImVec2 p1(origin.x + size.x * t, origin.y + size.y * 0.25f);
+        const ImVec2 p2(origin.x + size.x * (1.0f - t), origin.y + size.y * 0.75f);
+        draw_list->AddLine(p1, p2, IM_COL32(255, (n * 13) & 255, 64, 255), 1.0f + (n % 3));
+    }
+    static ImVec2 points[20000];
+    for (int n = 0; n < IM_ARRAYSIZE(points); n++)
+        points[n] = ImVec2(origin.x + size.x * n / IM_ARRAYSIZE(points), origin.y + size.y * (0.5f + 0.4f * ImSin(n * 0.05f)));
+    draw_list->AddPolyline(points, IM_ARRAYSIZE(points), IM_COL32(64, 255, 128, 255), ImDrawFlags_None, 2.0f);
+    ImGui::Dummy(size);
+    ImGui::End();
+}
+
+//-----------------------------------------------------------------------------
+// Runner
+//-----------------------------------------------------------------------------
+
+struct BenchWorkload
+{
+    const char* Name;
+    void        (*Func)();
+};
+
+static double BenchMicroseconds(std::chrono::steady_clock::time_point t0, std::chrono::steady_clock::time_point t1)
+{
+    return std::chrono::duration<double, std::micro>(t1 - t0).count();
+}
+
+// Every workload runs in a fresh context, so they don't share windows, settings or allocations.
+static void RunWorkload(const BenchWorkload& workload, BenchAllocCounters* counters)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendRendererName = "imgui_bench_ui (null)";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+    unsigned char* tex_pixels;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    io.Fonts->SetTexID((ImTextureID)(intptr_t)1);
+    io.AddMousePosEvent(-FLT_MAX, -FLT_MAX);
+
+    double newframe_us = 0.0, submit_us = 0.0, render_us = 0.0;
+    ImU64 vtx_count = 0, idx_count = 0, cmd_count = 0, alloc_count = 0, alloc_bytes = 0;
+    for (int frame = 0; frame < BenchWarmupFrames + BenchFrames; frame++)
+    {
+        const BenchAllocCounters counters_start = *counters;
+        const auto t0 = std::chrono::steady_clock::now();
+        ImGui::NewFrame();
+        const auto t1 = std::chrono::steady_clock::now();
+        workload.Func();
+        const auto t2 = std::chrono::steady_clock::now();
+        ImGui::Render();
+        const auto t3 = std::chrono::steady_clock::now();
+        if (frame < BenchWarmupFrames)
+            continue;
+
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        newframe_us += BenchMicroseconds(t0, t1);
+        submit_us += BenchMicroseconds(t1, t2);
+        render_us += BenchMicroseconds(t2, t3);
+        vtx_count += (ImU64)draw_data->TotalVtxCount;
+        idx_count += (ImU64)draw_data->TotalIdxCount;
+        for (ImDrawList* draw_list : draw_data->CmdLists)
+            cmd_count += (ImU64)draw_list->CmdBuffer.Size;
+        alloc_count += counters->AllocCount - counters_start.AllocCount;
+        alloc_bytes += counters->AllocBytes - counters_start.AllocBytes;
+    }
+    ImGui::DestroyContext();
+
+    const double frames = (double)BenchFrames;
+    printf("imgui.%s.newframe %.2f us\n", workload.Name, newframe_us / frames);
+    printf("imgui.%s.submit %.2f us\n", workload.Name, submit_us / frames);
+    printf("imgui.%s.render %.2f us\n", workload.Name, render_us / frames);
+    printf("imgui.%s.frame %.2f us\n", workload.Name, (newframe_us + submit_us + render_us) / frames);
+    printf("imgui.%s.vertices %.0f count\n", workload.Name, vtx_count / frames);
+    printf("imgui.%s.indices %.0f count\n", workload.Name, idx_count / frames);
+    printf("imgui.%s.draw_cmds %.0f count\n", workload.Name, cmd_count / frames);
+    printf("imgui.%s.allocs %.2f count\n", workload.Name, alloc_count / frames);
+    printf("imgui.%s.alloc_bytes %.0f bytes\n", workload.Name, alloc_bytes / frames);
+}
+
+int main(int argc, char** argv)
+{
+    static const BenchWorkload workloads[] =
+    {
+        { "table_100k",     WorkloadTable100k },
+        { "tree_10k",       WorkloadTree10k },
+        { "input_text_1mb", WorkloadInputTextLarge },
+        { "text_wall",      WorkloadTextWall },
+        { "canvas_lines",   WorkloadCanvasLines },
+    };
+
+    // Optional arguments: names of the workloads to run (default: all).
+    BenchAllocCounters counters = {};
+    ImGui::SetAllocatorFunctions(BenchMemAlloc, BenchMemFree, &counters);
+    printf("imgui.version %s\n", IMGUI_VERSION);
+    int ran = 0;
+    for (const BenchWorkload& workload : workloads)
+    {
+        bool selected = (argc <= 1);
+        for (int n = 1; n < argc && !selected; n++)
+            selected = (strcmp(argv[n], workload.Name) == 0);
+        if (!selected)
+            continue;
+        RunWorkload(workload, &counters);
+        ran++;
+    }
+    free(LargeTextBuf);
+    return ran > 0 ? 0 : 1;
+}
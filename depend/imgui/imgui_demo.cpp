@@ -590,6 +590,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: PlatformHasViewports",   &io.BackendFlags, ImGuiBackendFlags_PlatformHasViewports);
             ImGui::CheckboxFlags("io.BackendFlags: HasMouseHoveredViewport",&io.BackendFlags, ImGuiBackendFlags_HasMouseHoveredViewport);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset",   &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasGpuLines",    &io.BackendFlags, ImGuiBackendFlags_RendererHasGpuLines);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasViewports",   &io.BackendFlags, ImGuiBackendFlags_RendererHasViewports);
             ImGui::EndDisabled();
             ImGui::TreePop();
@@ -1965,6 +1966,23 @@ static void ShowDemoWindowWidgets()
         float (*func)(void*, int) = (func_type == 0) ? Funcs::Sin : Funcs::Saw;
         ImGui::PlotLines("Lines", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::PlotHistogram("Histogram", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
+
+        // Large series: ImGuiPlotBuffer indexes its values with a min/max pyramid.
+        // Each column of the plot covers the min and max of all its values: cost is O(pixels) and single-value spikes stay visible.
+        ImGui::SeparatorText("Large series");
+        static ImGuiPlotBuffer large_series(200000);
+        static unsigned int large_series_seed = 1;
+        const int large_series_add = large_series.GetCount() < large_series.GetCapacity() ? large_series.GetCapacity() : animate ? 500 : 0;
+        for (int n = 0; n < large_series_add; n++)
+        {
+            large_series_seed = large_series_seed * 1664525u + 1013904223u;
+            const float noise = (float)(large_series_seed >> 16) / 65536.0f;
+            large_series.AddValue((large_series_seed % 50000 == 0) ? 4.0f : 1.0f + noise * 0.5f); // Rare single-value spikes
+        }
+        char large_overlay[32];
+        sprintf(large_overlay, "%d values", large_series.GetCount());
+        ImGui::PlotLines("Lines##large", &large_series, large_overlay, 0.0f, 4.5f, ImVec2(0, 80.0f));
+        ImGui::PlotHistogram("Histogram##large", &large_series, NULL, 0.0f, 4.5f, ImVec2(0, 80.0f));
         ImGui::Separator();
 
         ImGui::TreePop();
@@ -3615,6 +3633,38 @@ static void ShowDemoWindowLayout()
         ImGui::TreePop();
     }
 
+    IMGUI_DEMO_MARKER("Layout/Variable height clipping");
+    if (ImGui::TreeNode("Variable height clipping"))
+    {
+        HelpMarker(
+            "ImGuiListClipper::BeginVariableHeight() clips lists of items with different heights.\n"
+            "Heights start as an estimate of one line and are refined with SetHeight() after each visible item is submitted.");
+        static int items_count = 10000;
+        static ImGuiListClipperHeights heights;
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+        ImGui::DragInt("Items", &items_count, 100.0f, 0, 1000000);
+        if (heights.GetCount() != items_count)
+            heights.Resize(items_count, ImGui::GetTextLineHeightWithSpacing());
+        ImGui::Text("Estimated total height: %.0f", heights.GetOffset(heights.GetCount()));
+        if (ImGui::BeginChild("##variable", ImVec2(0, ImGui::GetFontSize() * 20), ImGuiChildFlags_Border))
+        {
+            ImGuiListClipper clipper;
+            clipper.BeginVariableHeight(&heights);
+            while (clipper.Step())
+                for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                {
+                    const float y0 = ImGui::GetCursorPosY();
+                    const int lines = 1 + (n * 7) % 5;
+                    ImGui::Text("Item %d (%d lines)", n, lines);
+                    for (int line = 1; line < lines; line++)
+                        ImGui::BulletText("Line %d", line);
+                    heights.SetHeight(n, ImGui::GetCursorPosY() - y0);
+                }
+        }
+        ImGui::EndChild();
+        ImGui::TreePop();
+    }
+
     IMGUI_DEMO_MARKER("Layout/Clipping");
     if (ImGui::TreeNode("Clipping"))
     {
@@ -4053,13 +4103,23 @@ struct MyItem
     // Compare function to be used by qsort()
     static int IMGUI_CDECL CompareWithSortSpecs(const void* lhs, const void* rhs)
     {
-        const MyItem* a = (const MyItem*)lhs;
-        const MyItem* b = (const MyItem*)rhs;
-        for (int n = 0; n < s_current_sort_specs->SpecsCount; n++)
+        return CompareItems((const MyItem*)lhs, (const MyItem*)rhs, s_current_sort_specs);
+    }
+
+    // Compare function to be used by ImGuiTableSortIndex: receives item indices and the sort specs, so no global is needed.
+    static int CompareIndices(void* user_data, const ImGuiTableSortSpecs* sort_specs, int lhs, int rhs)
+    {
+        const MyItem* items = (const MyItem*)user_data;
+        return CompareItems(&items[lhs], &items[rhs], sort_specs);
+    }
+
+    static int CompareItems(const MyItem* a, const MyItem* b, const ImGuiTableSortSpecs* sort_specs)
+    {
+        for (int n = 0; n < sort_specs->SpecsCount; n++)
         {
             // Here we identify columns using the ColumnUserID value that we ourselves passed to TableSetupColumn()
             // We could also choose to identify columns based on their index (sort_spec->ColumnIndex), which is simpler!
-            const ImGuiTableColumnSortSpecs* sort_spec = &s_current_sort_specs->Specs[n];
+            const ImGuiTableColumnSortSpecs* sort_spec = &sort_specs->Specs[n];
             int delta = 0;
             switch (sort_spec->ColumnUserID)
             {
@@ -5733,6 +5793,69 @@ static void ShowDemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Sorting with index");
+    if (ImGui::TreeNode("Sorting with index"))
+    {
+        HelpMarker(
+            "ImGuiTableSortIndex sorts item indices instead of moving items. "
+            "With a budget, sorting is spread over several frames and the previous order is displayed meanwhile. "
+            "Set ParallelFor to run merge passes on your own job system.");
+
+        // Create item list
+        static ImVector<MyItem> items;
+        static ImGuiTableSortIndex sort_index;
+        if (items.Size == 0)
+        {
+            items.resize(100000, MyItem());
+            for (int n = 0; n < items.Size; n++)
+            {
+                const int template_n = (n * 7) % IM_ARRAYSIZE(template_items_names);
+                MyItem& item = items[n];
+                item.ID = n;
+                item.Name = template_items_names[template_n];
+                item.Quantity = (n * n - n) % 20;
+            }
+            sort_index.CompareFunc = MyItem::CompareIndices;
+            sort_index.CompareUserData = items.Data;
+        }
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 10);
+        ImGui::SliderInt("Max items per frame", &sort_index.MaxItemsPerFrame, 0, 200000, sort_index.MaxItemsPerFrame == 0 ? "Unlimited" : "%d");
+
+        const ImGuiTableFlags flags = ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY;
+        if (ImGui::BeginTable("table_sorting_index", 3, flags, ImVec2(0.0f, TEXT_BASE_HEIGHT * 15), 0.0f))
+        {
+            ImGui::TableSetupColumn("ID",       ImGuiTableColumnFlags_DefaultSort          | ImGuiTableColumnFlags_WidthFixed,   0.0f, MyItemColumnID_ID);
+            ImGui::TableSetupColumn("Name",                                                  ImGuiTableColumnFlags_WidthFixed,   0.0f, MyItemColumnID_Name);
+            ImGui::TableSetupColumn("Quantity", ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthStretch, 0.0f, MyItemColumnID_Quantity);
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableHeadersRow();
+
+            // Start sorting when specs changed, and continue any sorting in progress
+            sort_index.Update(ImGui::TableGetSortSpecs(), items.Size);
+
+            // Only visible rows are dereferenced
+            ImGuiListClipper clipper;
+            clipper.Begin(sort_index.Order.Size);
+            while (clipper.Step())
+                for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                {
+                    const MyItem* item = &items[sort_index.Order[row_n]];
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%06d", item->ID);
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(item->Name);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d", item->Quantity);
+                }
+            ImGui::EndTable();
+        }
+        ImGui::Text("Generation %d, displaying order from generation %d%s", sort_index.Generation, sort_index.OrderGeneration, sort_index.IsSorting() ? " (sorting...)" : "");
+        ImGui::TreePop();
+    }
+
     // In this example we'll expose most table flags and settings.
     // For specific flags and settings refer to the corresponding section for more detailed explanation.
     // This section is mostly useful to experiment with combining certain flags or settings with each others.
@@ -6719,6 +6842,7 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.BackendFlags & ImGuiBackendFlags_PlatformHasViewports)   ImGui::Text(" PlatformHasViewports");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseHoveredViewport)ImGui::Text(" HasMouseHoveredViewport");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasGpuLines)    ImGui::Text(" RendererHasGpuLines");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasViewports)   ImGui::Text(" RendererHasViewports");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight);
@@ -7022,6 +7146,10 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
             ImGui::SameLine();
             HelpMarker("Faster lines using texture data. Require backend to render with bilinear filtering (not point/nearest filtering).");
 
+            ImGui::Checkbox("Anti-aliased lines use GPU", &style.AntiAliasedLinesUseGpu);
+            ImGui::SameLine();
+            HelpMarker("Lines are expanded into quads by the renderer instead of being tessellated on the CPU. Require backend to support ImGuiBackendFlags_RendererHasGpuLines, ignored otherwise.");
+
             ImGui::Checkbox("Anti-aliased fill", &style.AntiAliasedFill);
             ImGui::PushItemWidth(ImGui::GetFontSize() * 8);
             ImGui::DragFloat("Curve Tessellation Tolerance", &style.CurveTessellationTol, 0.02f, 0.10f, 10.0f, "%.2f");
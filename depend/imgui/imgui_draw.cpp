@@ -9,6 +9,7 @@ Index of this file:
 // [SECTION] Style functions
 // [SECTION] ImDrawList
 // [SECTION] ImTriangulator, ImDrawList concave polygon fill
+// [SECTION] ImDrawList bulk primitives
 // [SECTION] ImDrawListSplitter
 // [SECTION] ImDrawData
 // [SECTION] Helpers ShadeVertsXXX functions
@@ -421,6 +422,29 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = 1.0f;
+
+    // Release text layouts which haven't been used for a while
+    _TextLayoutsFrame++;
+    if (_TextLayouts.Size > 0)
+    {
+        for (int n = 0; n < _TextLayouts.Size; n++)
+            if (_TextLayoutsFrame - _TextLayouts[n].LastUsedFrame > IM_DRAWLIST_TEXT_LAYOUT_MAX_AGE)
+            {
+                _TextLayouts[n].VtxBuffer.clear();
+                if (n < _TextLayouts.Size - 1)
+                    memcpy((void*)&_TextLayouts[n], (void*)&_TextLayouts.back(), sizeof(ImDrawTextLayout)); // Move, VtxBuffer ownership is transferred
+                _TextLayouts.pop_back();
+                n--;
+            }
+        // Rebuild map when entries moved or were evicted by AddTextCached()
+        if (_TextLayoutsMap.Data.Size != _TextLayouts.Size)
+        {
+            _TextLayoutsMap.Data.resize(0);
+            for (int n = 0; n < _TextLayouts.Size; n++)
+                _TextLayoutsMap.Data.push_back(ImGuiStoragePair(_TextLayouts[n].Key, n));
+            _TextLayoutsMap.BuildSortByKey();
+        }
+    }
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -436,6 +460,15 @@ void ImDrawList::_ClearFreeMemory()
     _TextureIdStack.clear();
     _Path.clear();
     _Splitter.ClearFreeMemory();
+    _ClearTextLayouts();
+}
+
+void ImDrawList::_ClearTextLayouts()
+{
+    for (ImDrawTextLayout& layout : _TextLayouts)
+        layout.VtxBuffer.clear();
+    _TextLayouts.clear();
+    _TextLayoutsMap.Clear();
 }
 
 ImDrawList* ImDrawList::CloneOutput() const
@@ -719,6 +752,84 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Make the last command a ImDrawCallback_GpuLines command with room for 'vtx_count' vertices and indices.
+// The previous ImDrawCallback_GpuLines command is reopened if nothing was submitted since and settings are the same, so neighboring strips/lines end up in a single command.
+static void ImDrawList_PrimReserveGpuLines(ImDrawList* draw_list, int vtx_count)
+{
+    ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
+    if (curr_cmd->ElemCount != 0)
+    {
+        draw_list->AddDrawCmd();
+    }
+    else if (draw_list->CmdBuffer.Size > 1 && (sizeof(ImDrawIdx) != 2 || draw_list->_VtxCurrentIdx + vtx_count < (1 << 16)))
+    {
+        // (PrimReserve() may not switch to a new VtxOffset while the reopened command is current, hence the 16-bit indices check)
+        ImDrawCmd* prev_cmd = curr_cmd - 1;
+        if (prev_cmd->UserCallback == ImDrawCallback_GpuLines && ImDrawCmd_HeaderCompare(prev_cmd, curr_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) &&
+            draw_list->IdxBuffer.Data[prev_cmd->IdxOffset + prev_cmd->ElemCount - 1] + 1u == draw_list->_VtxCurrentIdx)
+            draw_list->CmdBuffer.pop_back();
+    }
+    draw_list->PrimReserve(vtx_count, vtx_count);
+    draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1].UserCallback = ImDrawCallback_GpuLines;
+}
+
+// Close the ImDrawCallback_GpuLines command opened by ImDrawList_PrimReserveGpuLines(), after an optional PrimUnreserve().
+static void ImDrawList_PrimCloseGpuLines(ImDrawList* draw_list)
+{
+    ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
+    if (curr_cmd->ElemCount == 0)
+        curr_cmd->UserCallback = NULL; // Nothing was written, keep using it as a regular command
+    else
+        draw_list->AddDrawCmd(); // Force a new command after us, like AddCallback()
+}
+
+// Thickness value stored for ImDrawCallback_GpuLines, to match the CPU paths of AddPolyline(): any value <= AA_SIZE gives a thin line.
+static inline float ImDrawList_GetGpuLinesThickness(const ImDrawList* draw_list, float thickness)
+{
+    return (thickness > draw_list->_FringeScale) ? ImMax(thickness, 1.0f) : draw_list->_FringeScale;
+}
+
+// Parameters stored in uv for ImDrawCallback_GpuLines. Compact vertices can't hold values > 1.0f in uv: store them in the units of pos (see ImDrawCallback_GpuLines).
+static inline ImVec2 ImDrawList_GetGpuLinesParams(float thickness, float fringe)
+{
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    return ImVec2(thickness * (IM_DRAWVERT_POS_SCALE / 65535.0f), fringe * (IM_DRAWVERT_POS_SCALE / 65535.0f));
+#else
+    return ImVec2(thickness, fringe);
+#endif
+}
+
+// Output a polyline as a ImDrawCallback_GpuLines strip: 1 vertex per point (+1 when closed), no CPU tessellation.
+static void ImDrawList_AddGpuLineStrip(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
+{
+    const ImVec2 params = ImDrawList_GetGpuLinesParams(ImDrawList_GetGpuLinesThickness(draw_list, thickness), draw_list->_FringeScale);
+    const int strip_count = closed ? points_count + 1 : points_count;
+
+    // Long strips are split in chunks sharing their end point, so each fit within 16-bit indices
+    const int CHUNK_MAX = 1 << 14;
+    for (int chunk_start = 0; chunk_start < strip_count - 1; chunk_start += CHUNK_MAX - 1)
+    {
+        const int chunk_count = ImMin(strip_count - chunk_start, CHUNK_MAX);
+        ImDrawList_PrimReserveGpuLines(draw_list, chunk_count);
+        ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+        ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+        unsigned int vtx_idx = draw_list->_VtxCurrentIdx;
+        for (int n = chunk_start; n < chunk_start + chunk_count; n++)
+        {
+            vtx_write->pos = points[n == points_count ? 0 : n];
+            vtx_write->uv = params;
+            vtx_write->col = col;
+            vtx_write++;
+            *idx_write++ = (ImDrawIdx)vtx_idx++;
+        }
+        vtx_write[-1].uv.x = 0.0f; // End of strip
+        draw_list->_VtxWritePtr = vtx_write;
+        draw_list->_IdxWritePtr = idx_write;
+        draw_list->_VtxCurrentIdx = vtx_idx;
+        ImDrawList_PrimCloseGpuLines(draw_list);
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -727,6 +838,13 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         return;
 
     const bool closed = (flags & ImDrawFlags_Closed) != 0;
+    if ((Flags & ImDrawListFlags_AntiAliasedLines) && (Flags & ImDrawListFlags_AntiAliasedLinesUseGpu))
+    {
+        // Anti-aliased stroke expanded by the renderer backend
+        ImDrawList_AddGpuLineStrip(this, points, points_count, col, closed, thickness);
+        return;
+    }
+
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
     const int count = closed ? points_count : points_count - 1; // The number of line segments we need to draw
     const bool thick_line = (thickness > _FringeScale);
@@ -1657,6 +1775,128 @@ void ImDrawList::AddText(const ImVec2& pos, ImU32 col, const char* text_begin, c
     AddText(NULL, 0.0f, pos, col, text_begin, text_end);
 }
 
+// Same output as AddText(), but the glyph quads are laid out once and copied on subsequent calls, translated and recolored.
+// - Layouts are looked up by (layout_id, font, font_size, wrap_width). If you pass your own layout_id, change it when the text changes.
+// - Not culled against the clip rectangle glyph by glyph like AddText(), only as a whole.
+// - Layouts are rebuilt when the font atlas is rebuilt or grown. They are released after IM_DRAWLIST_TEXT_LAYOUT_MAX_AGE frames without use,
+//   when more than IM_DRAWLIST_TEXT_LAYOUT_CACHE_MAX are needed (least recently used first), or when the owner window is garbage collected.
+void ImDrawList::AddTextCached(ImGuiID layout_id, const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width)
+{
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+
+    // Accept null ranges
+    if (text_begin == text_end || text_begin[0] == 0)
+        return;
+    if (text_end == NULL)
+        text_end = text_begin + strlen(text_begin);
+
+    // Pull default font/size from the shared ImDrawListSharedData instance
+    if (font == NULL)
+        font = _Data->Font;
+    if (font_size == 0.0f)
+        font_size = _Data->FontSize;
+
+    IM_ASSERT(font->ContainerAtlas->TexID == _CmdHeader.TextureId);  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
+
+    // Without rasterization, glyphs still pending would stay missing from the layout: don't cache
+    if (_Data->NoDynamicGlyphs && font->ContainerAtlas->FontBuilderDynamicData != NULL)
+    {
+        font->RenderText(this, font_size, pos, col, _CmdHeader.ClipRect, text_begin, text_end, wrap_width, false);
+        return;
+    }
+
+    if (layout_id == 0)
+        layout_id = ImHashStr(text_begin, (size_t)(text_end - text_begin));
+    ImGuiID key = ImHashData(&font, sizeof(font), layout_id);
+    key = ImHashData(&font_size, sizeof(font_size), key);
+    key = ImHashData(&wrap_width, sizeof(wrap_width), key);
+
+    const ImVec2 origin(IM_TRUNC(pos.x), IM_TRUNC(pos.y));
+    const int tex_generation = font->ContainerAtlas->TexGeneration;
+    const int layout_idx = _TextLayoutsMap.GetInt(key, -1);
+    ImDrawTextLayout* layout = (layout_idx >= 0) ? &_TextLayouts[layout_idx] : NULL;
+    if (layout != NULL && layout->Font == font && layout->FontSize == font_size && layout->WrapWidth == wrap_width && layout->TexGeneration == tex_generation)
+    {
+        layout->LastUsedFrame = _TextLayoutsFrame;
+        const ImVec4& clip_rect = _CmdHeader.ClipRect;
+        const int vtx_count = layout->VtxBuffer.Size;
+        if (vtx_count == 0 || origin.x + layout->BoundsMin.x > clip_rect.z || origin.y + layout->BoundsMin.y > clip_rect.w || origin.x + layout->BoundsMax.x < clip_rect.x || origin.y + layout->BoundsMax.y < clip_rect.y)
+            return;
+
+        const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+        PrimReserve(vtx_count / 4 * 6, vtx_count);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int vtx_index = _VtxCurrentIdx;
+        const ImDrawVert* vtx_read = layout->VtxBuffer.Data;
+        for (int n = 0; n < vtx_count; n += 4, vtx_read += 4, vtx_write += 4, idx_write += 6, vtx_index += 4)
+        {
+            idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+            idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+            for (int k = 0; k < 4; k++)
+            {
+                vtx_write[k].pos.x = vtx_read[k].pos.x + origin.x;
+                vtx_write[k].pos.y = vtx_read[k].pos.y + origin.y;
+                vtx_write[k].uv = vtx_read[k].uv;
+                vtx_write[k].col = vtx_read[k].col ? col_untinted : col; // Colored glyphs ignore tinting, same as ImFont::RenderText()
+            }
+        }
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = vtx_index;
+        return;
+    }
+
+    // Build layout: find a slot (reuse existing entry on collision or stale texture, else append, else evict least recently used)
+    if (layout == NULL)
+    {
+        if (_TextLayouts.Size < IM_DRAWLIST_TEXT_LAYOUT_CACHE_MAX)
+        {
+            _TextLayouts.resize(_TextLayouts.Size + 1);
+            layout = IM_PLACEMENT_NEW(&_TextLayouts.back()) ImDrawTextLayout();
+        }
+        else
+        {
+            layout = &_TextLayouts[0];
+            for (ImDrawTextLayout& other : _TextLayouts)
+                if (other.LastUsedFrame < layout->LastUsedFrame)
+                    layout = &other;
+            _TextLayoutsMap.SetInt(layout->Key, -1); // Map is compacted by _ResetForNewFrame()
+        }
+        _TextLayoutsMap.SetInt(key, _TextLayouts.index_from_ptr(layout));
+    }
+    layout->Key = key;
+    layout->Font = font;
+    layout->FontSize = font_size;
+    layout->WrapWidth = wrap_width;
+    layout->TexGeneration = tex_generation;
+    layout->LastUsedFrame = _TextLayoutsFrame;
+
+    // Render unclipped at (0,0) in opaque black, so colored glyphs (output untinted, i.e. white) can be told apart whatever 'col' is.
+    // Save the quads, then move the output into place and give it its actual colors.
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+    const int vtx_begin = VtxBuffer.Size;
+    font->RenderText(this, font_size, ImVec2(0.0f, 0.0f), IM_COL32_BLACK, ImVec4(-FLT_MAX, -FLT_MAX, FLT_MAX, FLT_MAX), text_begin, text_end, wrap_width, false);
+    const int vtx_count = VtxBuffer.Size - vtx_begin;
+    IM_ASSERT((vtx_count % 4) == 0);
+    layout->VtxBuffer.resize(vtx_count);
+    layout->BoundsMin = ImVec2(FLT_MAX, FLT_MAX);
+    layout->BoundsMax = ImVec2(-FLT_MAX, -FLT_MAX);
+    ImDrawVert* vtx = VtxBuffer.Data + vtx_begin;
+    for (int n = 0; n < vtx_count; n++, vtx++)
+    {
+        const bool colored = (vtx->col != IM_COL32_BLACK);
+        layout->VtxBuffer.Data[n] = *vtx;
+        layout->VtxBuffer.Data[n].col = colored ? 1 : 0;
+        layout->BoundsMin = ImMin(layout->BoundsMin, vtx->pos);
+        layout->BoundsMax = ImMax(layout->BoundsMax, vtx->pos);
+        vtx->pos.x += origin.x;
+        vtx->pos.y += origin.y;
+        vtx->col = colored ? col_untinted : col;
+    }
+}
+
 void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col)
 {
     if ((col & IM_COL32_A_MASK) == 0)
@@ -2026,6 +2266,400 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
     }
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawList bulk primitives
+//-----------------------------------------------------------------------------
+// - AddLines()
+// - AddLinesIndexed()
+// - AddRectsFilled()
+// - AddCircles()
+// - AddCirclesFilled()
+//-----------------------------------------------------------------------------
+// Primitives are emitted in batches of at most IM_DRAWLIST_BULK_BATCH_VTX_MAX vertices: each batch is reserved for the worst case,
+// visible primitives are written and the unused part is released with PrimUnreserve(). Keeping a batch under 64k vertices lets
+// PrimReserve() move to a new VtxOffset in between batches when using 16-bit indices.
+//-----------------------------------------------------------------------------
+
+#define IM_DRAWLIST_BULK_BATCH_VTX_MAX      65535
+
+// Lines tessellation matches AddPolyline() for an open 2-points polyline
+enum ImDrawListBulkLineMode
+{
+    ImDrawListBulkLineMode_Gpu,             // 2 vertices, 2 indices (ImDrawCallback_GpuLines)
+    ImDrawListBulkLineMode_Textured,        // 4 vertices, 6 indices
+    ImDrawListBulkLineMode_AntiAliased,     // 6 vertices, 12 indices
+    ImDrawListBulkLineMode_AntiAliasedThick,// 8 vertices, 18 indices
+    ImDrawListBulkLineMode_NoAntiAliasing,  // 4 vertices, 6 indices
+};
+
+struct ImDrawListBulkLineSetup
+{
+    ImDrawListBulkLineMode  Mode;
+    int                     VtxPerLine;
+    int                     IdxPerLine;
+    float                   HalfDrawSize;   // Textured, AntiAliased: offset to outer edge. AntiAliasedThick: offset to inner edge. NoAntiAliasing: half thickness.
+    float                   HalfOuterSize;  // AntiAliasedThick: offset to outer edge
+    ImVec2                  TexUv0, TexUv1; // Textured: uv of outer edges. Gpu: uv of start and end vertices.
+    float                   CullPadding;
+};
+
+static void ImDrawListBulkLineSetupInit(ImDrawListBulkLineSetup* setup, const ImDrawList* draw_list, float thickness)
+{
+    const float AA_SIZE = draw_list->_FringeScale;
+    const bool thick_line = (thickness > AA_SIZE);
+    memset(setup, 0, sizeof(*setup));
+    if ((draw_list->Flags & ImDrawListFlags_AntiAliasedLines) && (draw_list->Flags & ImDrawListFlags_AntiAliasedLinesUseGpu))
+    {
+        setup->Mode = ImDrawListBulkLineMode_Gpu;
+        setup->VtxPerLine = 2;
+        setup->IdxPerLine = 2;
+        setup->TexUv0 = ImDrawList_GetGpuLinesParams(ImDrawList_GetGpuLinesThickness(draw_list, thickness), AA_SIZE);
+        setup->TexUv1 = ImDrawList_GetGpuLinesParams(0.0f, AA_SIZE);
+        thickness = ImMax(thickness, 1.0f);
+    }
+    else if (draw_list->Flags & ImDrawListFlags_AntiAliasedLines)
+    {
+        thickness = ImMax(thickness, 1.0f);
+        const int integer_thickness = (int)thickness;
+        const float fractional_thickness = thickness - integer_thickness;
+        const bool use_texture = (draw_list->Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+        if (use_texture)
+        {
+            const ImVec4 tex_uvs = draw_list->_Data->TexUvLines[integer_thickness];
+            setup->Mode = ImDrawListBulkLineMode_Textured;
+            setup->VtxPerLine = 4;
+            setup->IdxPerLine = 6;
+            setup->HalfDrawSize = (thickness * 0.5f) + 1;
+            setup->TexUv0 = ImVec2(tex_uvs.x, tex_uvs.y);
+            setup->TexUv1 = ImVec2(tex_uvs.z, tex_uvs.w);
+        }
+        else if (!thick_line)
+        {
+            setup->Mode = ImDrawListBulkLineMode_AntiAliased;
+            setup->VtxPerLine = 6;
+            setup->IdxPerLine = 12;
+            setup->HalfDrawSize = AA_SIZE;
+        }
+        else
+        {
+            setup->Mode = ImDrawListBulkLineMode_AntiAliasedThick;
+            setup->VtxPerLine = 8;
+            setup->IdxPerLine = 18;
+            setup->HalfDrawSize = (thickness - AA_SIZE) * 0.5f;
+            setup->HalfOuterSize = setup->HalfDrawSize + AA_SIZE;
+        }
+    }
+    else
+    {
+        setup->Mode = ImDrawListBulkLineMode_NoAntiAliasing;
+        setup->VtxPerLine = 4;
+        setup->IdxPerLine = 6;
+        setup->HalfDrawSize = thickness * 0.5f;
+    }
+    setup->CullPadding = thickness * 0.5f + AA_SIZE + 1.0f; // Conservative: includes AA fringe and AddLine() half-pixel offset
+}
+
+// Write one line at _VtxWritePtr/_IdxWritePtr. Space must have been reserved.
+static inline void ImDrawListBulkWriteLine(ImDrawList* draw_list, const ImDrawListBulkLineSetup& setup, ImVec2 p1, ImVec2 p2, ImU32 col)
+{
+    p1.x += 0.5f; p1.y += 0.5f; // Same as AddLine()
+    p2.x += 0.5f; p2.y += 0.5f;
+    const ImVec2 opaque_uv = draw_list->_Data->TexUvWhitePixel;
+    const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+    const unsigned int idx = draw_list->_VtxCurrentIdx;
+    ImDrawVert* vtx = draw_list->_VtxWritePtr;
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+
+    if (setup.Mode == ImDrawListBulkLineMode_Gpu)
+    {
+        vtx[0].pos = p1; vtx[0].uv = setup.TexUv0; vtx[0].col = col;
+        vtx[1].pos = p2; vtx[1].uv = setup.TexUv1; vtx[1].col = col;
+        idx_write[0] = (ImDrawIdx)(idx); idx_write[1] = (ImDrawIdx)(idx + 1);
+        draw_list->_VtxWritePtr += 2;
+        draw_list->_IdxWritePtr += 2;
+        draw_list->_VtxCurrentIdx += 2;
+        return;
+    }
+
+    float dx = p2.x - p1.x;
+    float dy = p2.y - p1.y;
+    IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+    if (setup.Mode == ImDrawListBulkLineMode_NoAntiAliasing)
+    {
+        dx *= setup.HalfDrawSize;
+        dy *= setup.HalfDrawSize;
+        vtx[0].pos.x = p1.x + dy; vtx[0].pos.y = p1.y - dx; vtx[0].uv = opaque_uv; vtx[0].col = col;
+        vtx[1].pos.x = p2.x + dy; vtx[1].pos.y = p2.y - dx; vtx[1].uv = opaque_uv; vtx[1].col = col;
+        vtx[2].pos.x = p2.x - dy; vtx[2].pos.y = p2.y + dx; vtx[2].uv = opaque_uv; vtx[2].col = col;
+        vtx[3].pos.x = p1.x - dy; vtx[3].pos.y = p1.y + dx; vtx[3].uv = opaque_uv; vtx[3].col = col;
+        idx_write[0] = (ImDrawIdx)(idx); idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+        idx_write[3] = (ImDrawIdx)(idx); idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+    }
+    else
+    {
+        // Normal at start point is used as is, end point uses the averaged/fixed normal like AddPolyline()
+        const float n1_x = dy, n1_y = -dx;
+        float n2_x = n1_x, n2_y = n1_y;
+        IM_FIXNORMAL2F(n2_x, n2_y);
+        if (setup.Mode == ImDrawListBulkLineMode_Textured)
+        {
+            const float h = setup.HalfDrawSize;
+            vtx[0].pos.x = p1.x + n1_x * h; vtx[0].pos.y = p1.y + n1_y * h; vtx[0].uv = setup.TexUv0; vtx[0].col = col;
+            vtx[1].pos.x = p1.x - n1_x * h; vtx[1].pos.y = p1.y - n1_y * h; vtx[1].uv = setup.TexUv1; vtx[1].col = col;
+            vtx[2].pos.x = p2.x + n2_x * h; vtx[2].pos.y = p2.y + n2_y * h; vtx[2].uv = setup.TexUv0; vtx[2].col = col;
+            vtx[3].pos.x = p2.x - n2_x * h; vtx[3].pos.y = p2.y - n2_y * h; vtx[3].uv = setup.TexUv1; vtx[3].col = col;
+            idx_write[0] = (ImDrawIdx)(idx + 2); idx_write[1] = (ImDrawIdx)(idx + 0); idx_write[2] = (ImDrawIdx)(idx + 1);
+            idx_write[3] = (ImDrawIdx)(idx + 3); idx_write[4] = (ImDrawIdx)(idx + 1); idx_write[5] = (ImDrawIdx)(idx + 2);
+        }
+        else if (setup.Mode == ImDrawListBulkLineMode_AntiAliased)
+        {
+            const float h = setup.HalfDrawSize;
+            vtx[0].pos = p1;                                                  vtx[0].uv = opaque_uv; vtx[0].col = col;
+            vtx[1].pos.x = p1.x + n1_x * h; vtx[1].pos.y = p1.y + n1_y * h; vtx[1].uv = opaque_uv; vtx[1].col = col_trans;
+            vtx[2].pos.x = p1.x - n1_x * h; vtx[2].pos.y = p1.y - n1_y * h; vtx[2].uv = opaque_uv; vtx[2].col = col_trans;
+            vtx[3].pos = p2;                                                  vtx[3].uv = opaque_uv; vtx[3].col = col;
+            vtx[4].pos.x = p2.x + n2_x * h; vtx[4].pos.y = p2.y + n2_y * h; vtx[4].uv = opaque_uv; vtx[4].col = col_trans;
+            vtx[5].pos.x = p2.x - n2_x * h; vtx[5].pos.y = p2.y - n2_y * h; vtx[5].uv = opaque_uv; vtx[5].col = col_trans;
+            idx_write[0] = (ImDrawIdx)(idx + 3); idx_write[1]  = (ImDrawIdx)(idx + 0); idx_write[2]  = (ImDrawIdx)(idx + 2);
+            idx_write[3] = (ImDrawIdx)(idx + 2); idx_write[4]  = (ImDrawIdx)(idx + 5); idx_write[5]  = (ImDrawIdx)(idx + 3);
+            idx_write[6] = (ImDrawIdx)(idx + 4); idx_write[7]  = (ImDrawIdx)(idx + 1); idx_write[8]  = (ImDrawIdx)(idx + 0);
+            idx_write[9] = (ImDrawIdx)(idx + 0); idx_write[10] = (ImDrawIdx)(idx + 3); idx_write[11] = (ImDrawIdx)(idx + 4);
+        }
+        else
+        {
+            const float h_in = setup.HalfDrawSize;
+            const float h_out = setup.HalfOuterSize;
+            vtx[0].pos.x = p1.x + n1_x * h_out; vtx[0].pos.y = p1.y + n1_y * h_out; vtx[0].uv = opaque_uv; vtx[0].col = col_trans;
+            vtx[1].pos.x = p1.x + n1_x * h_in;  vtx[1].pos.y = p1.y + n1_y * h_in;  vtx[1].uv = opaque_uv; vtx[1].col = col;
+            vtx[2].pos.x = p1.x - n1_x * h_in;  vtx[2].pos.y = p1.y - n1_y * h_in;  vtx[2].uv = opaque_uv; vtx[2].col = col;
+            vtx[3].pos.x = p1.x - n1_x * h_out; vtx[3].pos.y = p1.y - n1_y * h_out; vtx[3].uv = opaque_uv; vtx[3].col = col_trans;
+            vtx[4].pos.x = p2.x + n2_x * h_out; vtx[4].pos.y = p2.y + n2_y * h_out; vtx[4].uv = opaque_uv; vtx[4].col = col_trans;
+            vtx[5].pos.x = p2.x + n2_x * h_in;  vtx[5].pos.y = p2.y + n2_y * h_in;  vtx[5].uv = opaque_uv; vtx[5].col = col;
+            vtx[6].pos.x = p2.x - n2_x * h_in;  vtx[6].pos.y = p2.y - n2_y * h_in;  vtx[6].uv = opaque_uv; vtx[6].col = col;
+            vtx[7].pos.x = p2.x - n2_x * h_out; vtx[7].pos.y = p2.y - n2_y * h_out; vtx[7].uv = opaque_uv; vtx[7].col = col_trans;
+            idx_write[0]  = (ImDrawIdx)(idx + 5); idx_write[1]  = (ImDrawIdx)(idx + 1); idx_write[2]  = (ImDrawIdx)(idx + 2);
+            idx_write[3]  = (ImDrawIdx)(idx + 2); idx_write[4]  = (ImDrawIdx)(idx + 6); idx_write[5]  = (ImDrawIdx)(idx + 5);
+            idx_write[6]  = (ImDrawIdx)(idx + 5); idx_write[7]  = (ImDrawIdx)(idx + 1); idx_write[8]  = (ImDrawIdx)(idx + 0);
+            idx_write[9]  = (ImDrawIdx)(idx + 0); idx_write[10] = (ImDrawIdx)(idx + 4); idx_write[11] = (ImDrawIdx)(idx + 5);
+            idx_write[12] = (ImDrawIdx)(idx + 6); idx_write[13] = (ImDrawIdx)(idx + 2); idx_write[14] = (ImDrawIdx)(idx + 3);
+            idx_write[15] = (ImDrawIdx)(idx + 3); idx_write[16] = (ImDrawIdx)(idx + 7); idx_write[17] = (ImDrawIdx)(idx + 6);
+        }
+    }
+    draw_list->_VtxWritePtr += setup.VtxPerLine;
+    draw_list->_IdxWritePtr += setup.IdxPerLine;
+    draw_list->_VtxCurrentIdx += setup.VtxPerLine;
+}
+
+// Test 2 primitives at a time against the clip rectangle: bit 0 set if primitive 0 overlaps, bit 1 set if primitive 1 overlaps.
+// 'a' and 'b' are any 2 corners of each bounding box, e.g. line end points or rectangle min/max.
+#ifdef IMGUI_ENABLE_SSE
+static inline int ImDrawListBulkCullPair(__m128 a, __m128 b, __m128 clip_min, __m128 clip_max)
+{
+    const __m128 visible = _mm_and_ps(_mm_cmpge_ps(_mm_max_ps(a, b), clip_min), _mm_cmple_ps(_mm_min_ps(a, b), clip_max));
+    const int mask = _mm_movemask_ps(visible);
+    return ((mask & 0x03) == 0x03 ? 1 : 0) | ((mask & 0x0C) == 0x0C ? 2 : 0);
+}
+#endif
+
+static inline bool ImDrawListBulkCullOne(const ImVec2& a, const ImVec2& b, const ImVec4& clip_min_max)
+{
+    return ImMax(a.x, b.x) >= clip_min_max.x && ImMax(a.y, b.y) >= clip_min_max.y && ImMin(a.x, b.x) <= clip_min_max.z && ImMin(a.y, b.y) <= clip_min_max.w;
+}
+
+// Shared by AddLines() and AddLinesIndexed(): either p1/p2 or points/indices are set.
+static void ImDrawList_AddLinesEx(ImDrawList* draw_list, const ImVec2* p1, const ImVec2* p2, const ImVec2* points, const int* indices, int count, ImU32 col, float thickness, const ImU32* cols)
+{
+    if (count <= 0 || (cols == NULL && (col & IM_COL32_A_MASK) == 0))
+        return;
+    ImDrawListBulkLineSetup setup;
+    ImDrawListBulkLineSetupInit(&setup, draw_list, thickness);
+    const ImVec4 clip_rect = draw_list->_CmdHeader.ClipRect;
+    const ImVec4 clip_min_max(clip_rect.x - setup.CullPadding, clip_rect.y - setup.CullPadding, clip_rect.z + setup.CullPadding, clip_rect.w + setup.CullPadding);
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 clip_min = _mm_setr_ps(clip_min_max.x, clip_min_max.y, clip_min_max.x, clip_min_max.y);
+    const __m128 clip_max = _mm_setr_ps(clip_min_max.z, clip_min_max.w, clip_min_max.z, clip_min_max.w);
+#endif
+
+    const int batch_max = IM_DRAWLIST_BULK_BATCH_VTX_MAX / setup.VtxPerLine;
+    for (int batch_start = 0; batch_start < count; batch_start += batch_max)
+    {
+        const int batch_end = ImMin(batch_start + batch_max, count);
+        const int batch_count = batch_end - batch_start;
+        if (setup.Mode == ImDrawListBulkLineMode_Gpu)
+            ImDrawList_PrimReserveGpuLines(draw_list, batch_count * setup.VtxPerLine);
+        else
+            draw_list->PrimReserve(batch_count * setup.IdxPerLine, batch_count * setup.VtxPerLine);
+        int written = 0;
+        int n = batch_start;
+#ifdef IMGUI_ENABLE_SSE
+        for (; n + 1 < batch_end; n += 2)
+        {
+            __m128 a, b;
+            if (indices)
+            {
+                const ImVec2& a0 = points[indices[n * 2 + 0]]; const ImVec2& b0 = points[indices[n * 2 + 1]];
+                const ImVec2& a1 = points[indices[n * 2 + 2]]; const ImVec2& b1 = points[indices[n * 2 + 3]];
+                a = _mm_setr_ps(a0.x, a0.y, a1.x, a1.y);
+                b = _mm_setr_ps(b0.x, b0.y, b1.x, b1.y);
+            }
+            else
+            {
+                a = _mm_loadu_ps(&p1[n].x);
+                b = _mm_loadu_ps(&p2[n].x);
+            }
+            const int visible = ImDrawListBulkCullPair(a, b, clip_min, clip_max);
+            if (visible == 0)
+                continue;
+            for (int pair_n = 0; pair_n < 2; pair_n++)
+            {
+                const ImU32 line_col = cols ? cols[n + pair_n] : col;
+                if (!(visible & (1 << pair_n)) || (line_col & IM_COL32_A_MASK) == 0)
+                    continue;
+                if (indices)
+                    ImDrawListBulkWriteLine(draw_list, setup, points[indices[(n + pair_n) * 2 + 0]], points[indices[(n + pair_n) * 2 + 1]], line_col);
+                else
+                    ImDrawListBulkWriteLine(draw_list, setup, p1[n + pair_n], p2[n + pair_n], line_col);
+                written++;
+            }
+        }
+#endif
+        for (; n < batch_end; n++)
+        {
+            const ImVec2& a = indices ? points[indices[n * 2 + 0]] : p1[n];
+            const ImVec2& b = indices ? points[indices[n * 2 + 1]] : p2[n];
+            const ImU32 line_col = cols ? cols[n] : col;
+            if ((line_col & IM_COL32_A_MASK) == 0 || !ImDrawListBulkCullOne(a, b, clip_min_max))
+                continue;
+            ImDrawListBulkWriteLine(draw_list, setup, a, b, line_col);
+            written++;
+        }
+        draw_list->PrimUnreserve((batch_count - written) * setup.IdxPerLine, (batch_count - written) * setup.VtxPerLine);
+        if (setup.Mode == ImDrawListBulkLineMode_Gpu)
+            ImDrawList_PrimCloseGpuLines(draw_list);
+    }
+}
+
+void ImDrawList::AddLines(const ImVec2* p1, const ImVec2* p2, int count, ImU32 col, float thickness, const ImU32* cols)
+{
+    ImDrawList_AddLinesEx(this, p1, p2, NULL, NULL, count, col, thickness, cols);
+}
+
+void ImDrawList::AddLinesIndexed(const ImVec2* points, const int* indices, int count, ImU32 col, float thickness, const ImU32* cols)
+{
+    ImDrawList_AddLinesEx(this, NULL, NULL, points, indices, count, col, thickness, cols);
+}
+
+void ImDrawList::AddRectsFilled(const ImVec2* p_min, const ImVec2* p_max, int count, ImU32 col, const ImU32* cols)
+{
+    if (count <= 0 || (cols == NULL && (col & IM_COL32_A_MASK) == 0))
+        return;
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 clip_min = _mm_setr_ps(clip_rect.x, clip_rect.y, clip_rect.x, clip_rect.y);
+    const __m128 clip_max = _mm_setr_ps(clip_rect.z, clip_rect.w, clip_rect.z, clip_rect.w);
+#endif
+
+    const int batch_max = IM_DRAWLIST_BULK_BATCH_VTX_MAX / 4;
+    for (int batch_start = 0; batch_start < count; batch_start += batch_max)
+    {
+        const int batch_end = ImMin(batch_start + batch_max, count);
+        const int batch_count = batch_end - batch_start;
+        PrimReserve(batch_count * 6, batch_count * 4);
+        int written = 0;
+        int n = batch_start;
+#ifdef IMGUI_ENABLE_SSE
+        for (; n + 1 < batch_end; n += 2)
+        {
+            const int visible = ImDrawListBulkCullPair(_mm_loadu_ps(&p_min[n].x), _mm_loadu_ps(&p_max[n].x), clip_min, clip_max);
+            for (int pair_n = 0; pair_n < 2; pair_n++)
+            {
+                const ImU32 rect_col = cols ? cols[n + pair_n] : col;
+                if (!(visible & (1 << pair_n)) || (rect_col & IM_COL32_A_MASK) == 0)
+                    continue;
+                PrimRect(p_min[n + pair_n], p_max[n + pair_n], rect_col);
+                written++;
+            }
+        }
+#endif
+        for (; n < batch_end; n++)
+        {
+            const ImU32 rect_col = cols ? cols[n] : col;
+            if ((rect_col & IM_COL32_A_MASK) == 0 || !ImDrawListBulkCullOne(p_min[n], p_max[n], clip_rect))
+                continue;
+            PrimRect(p_min[n], p_max[n], rect_col);
+            written++;
+        }
+        PrimUnreserve((batch_count - written) * 6, (batch_count - written) * 4);
+    }
+}
+
+// Circles are culled here then tessellated by AddPolyline()/AddConvexPolyFilled() like AddCircle()/AddCircleFilled().
+// With an explicit segment count the unit circle is computed once per call instead of once per circle.
+static void ImDrawList_AddCirclesEx(ImDrawList* draw_list, const ImVec2* centers, const float* radii, int count, ImU32 col, int num_segments, float thickness, const ImU32* cols, bool filled)
+{
+    if (count <= 0 || (cols == NULL && (col & IM_COL32_A_MASK) == 0))
+        return;
+
+    ImVec2 unit_circle[IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX];
+    if (num_segments > 0)
+    {
+        // Same angles as AddCircle() -> PathArcTo()
+        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
+        for (int i = 0; i < num_segments; i++)
+        {
+            const float a = 0.0f + ((float)i / (float)(num_segments - 1)) * (a_max - 0.0f);
+            unit_circle[i] = ImVec2(ImCos(a), ImSin(a));
+        }
+    }
+
+    const float radius_offset = filled ? 0.0f : -0.5f;
+    const float cull_padding = filled ? draw_list->_FringeScale : thickness * 0.5f + draw_list->_FringeScale;
+    const ImVec4 clip_rect = draw_list->_CmdHeader.ClipRect;
+    for (int n = 0; n < count; n++)
+    {
+        const ImU32 circle_col = cols ? cols[n] : col;
+        const float radius = radii[n];
+        if ((circle_col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
+            continue;
+        const ImVec2 center = centers[n];
+        const float extent = radius + cull_padding;
+        if (center.x + extent < clip_rect.x || center.y + extent < clip_rect.y || center.x - extent > clip_rect.z || center.y - extent > clip_rect.w)
+            continue;
+
+        const float r = radius + radius_offset;
+        if (r < 0.5f) // Would collapse to a single point, see _PathArcToN()
+            continue;
+        if (num_segments > 0)
+        {
+            draw_list->_Path.resize(num_segments);
+            ImVec2* out = draw_list->_Path.Data;
+            for (int i = 0; i < num_segments; i++)
+                out[i] = ImVec2(center.x + unit_circle[i].x * r, center.y + unit_circle[i].y * r);
+        }
+        else
+        {
+            draw_list->_PathArcToFastEx(center, r, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, 0);
+            draw_list->_Path.Size--;
+        }
+        if (filled)
+            draw_list->AddConvexPolyFilled(draw_list->_Path.Data, draw_list->_Path.Size, circle_col);
+        else
+            draw_list->AddPolyline(draw_list->_Path.Data, draw_list->_Path.Size, circle_col, ImDrawFlags_Closed, thickness);
+        draw_list->_Path.Size = 0;
+    }
+}
+
+void ImDrawList::AddCircles(const ImVec2* centers, const float* radii, int count, ImU32 col, int num_segments, float thickness, const ImU32* cols)
+{
+    ImDrawList_AddCirclesEx(this, centers, radii, count, col, num_segments, thickness, cols, false);
+}
+
+void ImDrawList::AddCirclesFilled(const ImVec2* centers, const float* radii, int count, ImU32 col, int num_segments, const ImU32* cols)
+{
+    ImDrawList_AddCirclesEx(this, centers, radii, count, col, num_segments, 0.0f, cols, true);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawListSplitter
 //-----------------------------------------------------------------------------
@@ -2046,10 +2680,24 @@ void ImDrawListSplitter::ClearFreeMemory()
     _Channels.clear();
 }
 
+void ImDrawListSplitter::ClearFreeMemoryUnusedChannels(int channels_keep)
+{
+    IM_ASSERT(_Current == 0 && _Count <= 1 && channels_keep >= 1);
+    if (channels_keep >= _Channels.Size)
+        return;
+    for (int i = channels_keep; i < _Channels.Size; i++)
+    {
+        _Channels[i]._CmdBuffer.clear();
+        _Channels[i]._IdxBuffer.clear();
+    }
+    _Channels.shrink(channels_keep); // Next Split() will reconstruct them
+}
+
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
     IM_UNUSED(draw_list);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
+    _SharedIdx = false;
     int old_channels_count = _Channels.Size;
     if (old_channels_count < channels_count)
     {
@@ -2076,75 +2724,98 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
     }
 }
 
-void ImDrawListSplitter::Merge(ImDrawList* draw_list)
+void ImDrawListSplitter::SplitSharedIndices(ImDrawList* draw_list, int channels_count)
 {
-    // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
-    if (_Count <= 1)
-        return;
+    Split(draw_list, channels_count);
+    _SharedIdx = true;
+    for (int i = 1; i < channels_count; i++)
+        _Channels[i]._IdxBuffer.clear(); // Not used in this mode
+}
 
-    SetCurrentChannel(draw_list, 0);
-    draw_list->_PopUnusedDrawCmd();
+// Append commands of channels 1+ after those of channel 0, fusing neighbors with matching header.
+// - Default mode: copy indices of each channel after those of channel 0 and rebuild IdxOffset values. Channel boundaries can always be fused.
+// - Shared indices mode: indices are already in place, only commands are reordered. Fuse only if contiguous in the index buffer.
+// Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
+static void ImDrawListSplitter_MergeCommands(ImDrawListSplitter* splitter, ImDrawList* draw_list)
+{
+    const bool shared_idx = splitter->_SharedIdx;
 
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // Calculate our final buffer sizes (upper bound for commands, as some may be fused)
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
-    ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
-    for (int i = 1; i < _Count; i++)
+    for (int i = 1; i < splitter->_Count; i++)
     {
-        ImDrawChannel& ch = _Channels[i];
+        ImDrawChannel& ch = splitter->_Channels[i];
         if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
             ch._CmdBuffer.pop_back();
-
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
-        {
-            // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
-            // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
-            {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
-            }
-        }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
         new_cmd_buffer_count += ch._CmdBuffer.Size;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
-        {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
-        }
     }
-    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
-    draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+    const int cmd_base = draw_list->CmdBuffer.Size;
+    draw_list->CmdBuffer.resize(cmd_base + new_cmd_buffer_count);
+    if (new_idx_buffer_count > 0)
+        draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
 
     // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
-    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
+    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + cmd_base;
+    ImDrawCmd* last_cmd = (cmd_base > 0) ? cmd_write - 1 : NULL;
+    unsigned int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
-    for (int i = 1; i < _Count; i++)
+    for (int i = 1; i < splitter->_Count; i++)
     {
-        ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        ImDrawChannel& ch = splitter->_Channels[i];
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+        for (const ImDrawCmd* cmd_src = ch._CmdBuffer.Data; cmd_src < ch._CmdBuffer.Data + ch._CmdBuffer.Size; cmd_src++)
+        {
+            if (shared_idx || cmd_src == ch._CmdBuffer.Data)
+                if (last_cmd != NULL && ImDrawCmd_HeaderCompare(last_cmd, cmd_src) == 0 && last_cmd->UserCallback == NULL && cmd_src->UserCallback == NULL)
+                    if (!shared_idx || ImDrawCmd_AreSequentialIdxOffset(last_cmd, cmd_src))
+                    {
+                        // Merge with previous command
+                        last_cmd->ElemCount += cmd_src->ElemCount;
+                        idx_offset += cmd_src->ElemCount;
+                        continue;
+                    }
+            *cmd_write = *cmd_src;
+            if (!shared_idx)
+                cmd_write->IdxOffset = idx_offset;
+            idx_offset += cmd_src->ElemCount;
+            last_cmd = cmd_write++;
+        }
     }
-    draw_list->_IdxWritePtr = idx_write;
+    draw_list->CmdBuffer.shrink((int)(cmd_write - draw_list->CmdBuffer.Data));
+    draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+}
+
+void ImDrawListSplitter::Merge(ImDrawList* draw_list)
+{
+    // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
+    if (_Count <= 1)
+        return;
+
+    SetCurrentChannel(draw_list, 0);
+    draw_list->_PopUnusedDrawCmd();
+    ImDrawListSplitter_MergeCommands(this, draw_list);
 
     // Ensure there's always a non-callback draw command trailing the command-buffer
     if (draw_list->CmdBuffer.Size == 0 || draw_list->CmdBuffer.back().UserCallback != NULL)
         draw_list->AddDrawCmd();
 
     // If current command is used with different settings we need to add a new command
+    // (with shared indices, the last command may also come from a channel which doesn't end at the end of the index buffer)
     ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
     if (curr_cmd->ElemCount == 0)
+    {
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
-    else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
+        curr_cmd->IdxOffset = draw_list->IdxBuffer.Size;
+    }
+    else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0 || curr_cmd->IdxOffset + curr_cmd->ElemCount != (unsigned int)draw_list->IdxBuffer.Size)
+    {
         draw_list->AddDrawCmd();
+    }
 
     _Count = 1;
+    _SharedIdx = false;
 }
 
 void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
@@ -2154,21 +2825,33 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
         return;
 
     // Overwrite ImVector (12/16 bytes), four times. This is merely a silly optimization instead of doing .swap()
+    // With shared indices, only the command buffer is swapped.
     memcpy(&_Channels.Data[_Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
-    memcpy(&_Channels.Data[_Current]._IdxBuffer, &draw_list->IdxBuffer, sizeof(draw_list->IdxBuffer));
+    if (!_SharedIdx)
+        memcpy(&_Channels.Data[_Current]._IdxBuffer, &draw_list->IdxBuffer, sizeof(draw_list->IdxBuffer));
     _Current = idx;
     memcpy(&draw_list->CmdBuffer, &_Channels.Data[idx]._CmdBuffer, sizeof(draw_list->CmdBuffer));
-    memcpy(&draw_list->IdxBuffer, &_Channels.Data[idx]._IdxBuffer, sizeof(draw_list->IdxBuffer));
-    draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+    if (!_SharedIdx)
+    {
+        memcpy(&draw_list->IdxBuffer, &_Channels.Data[idx]._IdxBuffer, sizeof(draw_list->IdxBuffer));
+        draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+    }
 
     // If current command is used with different settings we need to add a new command
+    // With shared indices, also add one if the channel's last command isn't at the end of the index buffer anymore.
     ImDrawCmd* curr_cmd = (draw_list->CmdBuffer.Size == 0) ? NULL : &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
     if (curr_cmd == NULL)
         draw_list->AddDrawCmd();
     else if (curr_cmd->ElemCount == 0)
+    {
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
-    else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
+        if (_SharedIdx)
+            curr_cmd->IdxOffset = draw_list->IdxBuffer.Size;
+    }
+    else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0 || (_SharedIdx && curr_cmd->IdxOffset + curr_cmd->ElemCount != (unsigned int)draw_list->IdxBuffer.Size))
+    {
         draw_list->AddDrawCmd();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -2425,6 +3108,7 @@ void    ImFontAtlas::ClearInputData()
     ConfigData.clear();
     CustomRects.clear();
     PackIdMouseCursors = PackIdLines = -1;
+    ImFontAtlasBuildDynamicDestroy(this);
     // Important: we leave TexReady untouched
 }
 
@@ -2438,12 +3122,15 @@ void    ImFontAtlas::ClearTexData()
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
     TexPixelsUseColors = false;
+    TexDirtyRects.clear();
+    ImFontAtlasBuildDynamicDestroy(this); // Without pixels we cannot rasterize glyphs anymore
     // Important: we leave TexReady untouched
 }
 
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuildDynamicDestroy(this);
     Fonts.clear_delete();
     TexReady = false;
 }
@@ -2753,6 +3440,47 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// Retained data for one source font when using ImFontAtlasFlags_DynamicGlyphs (atlas->ConfigData[] and FontData need to stay valid)
+struct ImFontBuildDynamicSrcData
+{
+    stbtt_fontinfo      FontInfo;
+    float               Scale;              // Rasterization scale (including RasterizerDensity)
+    int                 GlyphsPendingCount;
+    ImBitVector         GlyphsPending;      // Glyphs registered by Build() but not rasterized yet (1-bit per codepoint)
+};
+
+// Glyph which was packed beyond current texture height; rasterized by ImFontAtlasBuildDynamicNewFrame() after growing the texture
+struct ImFontBuildDynamicDeferredGlyph
+{
+    int                 SrcIndex;
+    ImWchar             Codepoint;
+    stbrp_rect          Rect;
+};
+
+// Glyph requested while atlas->DynamicGlyphsQueued was set; packed and rasterized by ImFontAtlasBuildDynamicNewFrame()
+struct ImFontBuildDynamicQueuedGlyph
+{
+    int                 SrcIndex;
+    ImWchar             Codepoint;
+};
+
+// Stored in atlas->FontBuilderDynamicData
+struct ImFontBuildDynamicData
+{
+    stbrp_context*      PackContext;        // Packing state at the end of Build(), taken over from stbtt_pack_context
+    void*               PackNodes;
+    int                 TexHeightRequired;
+    ImVector<ImFontBuildDynamicSrcData>         Srcs;       // Same indices as atlas->ConfigData[]
+    ImVector<ImFontBuildDynamicDeferredGlyph>   Deferred;
+    ImVector<ImFontBuildDynamicQueuedGlyph>     Queued;
+};
+
+// Only rasterize those in Build(): Basic Latin + Latin-1 Supplement, and the glyphs BuildLookupTable() needs metrics from (fallback & ellipsis).
+static bool ImFontAtlasBuildIsDynamicGlyphEager(const ImFontConfig& cfg, ImWchar codepoint)
+{
+    return codepoint < 0x100 || codepoint == IM_UNICODE_CODEPOINT_INVALID || codepoint == 0x2026 || codepoint == 0xFF0E || codepoint == cfg.EllipsisChar;
+}
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2786,6 +3514,19 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     memset(src_tmp_array.Data, 0, (size_t)src_tmp_array.size_in_bytes());
     memset(dst_tmp_array.Data, 0, (size_t)dst_tmp_array.size_in_bytes());
 
+    // Retained storage for rasterizing glyphs on demand
+    ImFontBuildDynamicData* dyn_data = NULL;
+    if (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs)
+    {
+        dyn_data = IM_NEW(ImFontBuildDynamicData)();
+        dyn_data->PackContext = NULL;
+        dyn_data->PackNodes = NULL;
+        dyn_data->TexHeightRequired = 0;
+        dyn_data->Srcs.resize(atlas->ConfigData.Size);
+        memset(dyn_data->Srcs.Data, 0, (size_t)dyn_data->Srcs.size_in_bytes());
+        atlas->FontBuilderDynamicData = dyn_data;
+    }
+
     // 1. Initialize font loading structure, check font data validity
     for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
     {
@@ -2861,6 +3602,27 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         UnpackBitVectorToFlatIndexList(&src_tmp.GlyphsSet, &src_tmp.GlyphsList);
         src_tmp.GlyphsSet.Clear();
         IM_ASSERT(src_tmp.GlyphsList.Size == src_tmp.GlyphsCount);
+
+        // With ImFontAtlasFlags_DynamicGlyphs, only keep a few glyphs for immediate rasterization and flag the rest as pending.
+        if (dyn_data != NULL)
+        {
+            ImFontBuildDynamicSrcData& src_dyn = dyn_data->Srcs[src_i];
+            src_dyn.FontInfo = src_tmp.FontInfo;
+            src_dyn.GlyphsPending.Create(src_tmp.GlyphsHighest + 1);
+            int eager_count = 0;
+            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
+            {
+                const int codepoint = src_tmp.GlyphsList[glyph_i];
+                if (ImFontAtlasBuildIsDynamicGlyphEager(atlas->ConfigData[src_i], (ImWchar)codepoint))
+                    src_tmp.GlyphsList[eager_count++] = codepoint;
+                else
+                    src_dyn.GlyphsPending.SetBit(codepoint);
+            }
+            src_dyn.GlyphsPendingCount = src_tmp.GlyphsCount - eager_count;
+            total_glyphs_count -= src_dyn.GlyphsPendingCount;
+            src_tmp.GlyphsList.resize(eager_count);
+            src_tmp.GlyphsCount = eager_count;
+        }
     }
     for (int dst_i = 0; dst_i < dst_tmp_array.Size; dst_i++)
         dst_tmp_array[dst_i].GlyphsSet.Clear();
@@ -2915,6 +3677,17 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         }
     }
 
+    // Account for pending glyphs (roughly, as if they were all full-sized) so the texture width is chosen as if we baked everything.
+    if (dyn_data != NULL)
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        {
+            ImFontConfig& cfg = atlas->ConfigData[src_i];
+            ImFontBuildDynamicSrcData& src_dyn = dyn_data->Srcs[src_i];
+            src_dyn.Scale = (cfg.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_dyn.FontInfo, cfg.SizePixels * cfg.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_dyn.FontInfo, -cfg.SizePixels * cfg.RasterizerDensity);
+            const int glyph_size = (int)(cfg.SizePixels * cfg.RasterizerDensity);
+            total_surface += src_dyn.GlyphsPendingCount * (glyph_size * cfg.OversampleH + atlas->TexGlyphPadding) * (glyph_size * cfg.OversampleV + atlas->TexGlyphPadding);
+        }
+
     // We need a width for the skyline algorithm, any width!
     // The exact width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
     // User can override TexDesiredWidth and TexGlyphPadding if they wish, otherwise we use a simple heuristic to select the width based on expected surface.
@@ -2980,6 +3753,14 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // End packing
+    // (with ImFontAtlasFlags_DynamicGlyphs we keep the packer state around to allocate more rectangles later)
+    if (dyn_data != NULL)
+    {
+        dyn_data->PackContext = (stbrp_context*)spc.pack_info;
+        dyn_data->PackNodes = spc.nodes;
+        spc.pack_info = NULL;
+        spc.nodes = NULL;
+    }
     stbtt_PackEnd(&spc);
     buf_rects.clear();
 
@@ -3019,6 +3800,21 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             float y1 = q.y1 * inv_rasterization_scale + font_off_y;
             dst_font->AddGlyph(&cfg, (ImWchar)codepoint, x0, y0, x1, y1, q.s0, q.t0, q.s1, q.t1, pc.xadvance * inv_rasterization_scale);
         }
+
+        // Register pending glyphs with their final advance but no quad (so they are invisible until ImFontAtlasBuildDynamicGlyph() is called).
+        // This way CalcTextSize() and layout are unaffected by whether a glyph has been rasterized yet.
+        if (dyn_data != NULL)
+        {
+            ImFontBuildDynamicSrcData& src_dyn = dyn_data->Srcs[src_i];
+            src_tmp.GlyphsList.resize(0);
+            UnpackBitVectorToFlatIndexList(&src_dyn.GlyphsPending, &src_tmp.GlyphsList);
+            for (int codepoint : src_tmp.GlyphsList)
+            {
+                int advance, lsb;
+                stbtt_GetCodepointHMetrics(&src_dyn.FontInfo, codepoint, &advance, &lsb);
+                dst_font->AddGlyph(&cfg, (ImWchar)codepoint, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, src_dyn.Scale * advance * inv_rasterization_scale);
+            }
+        }
     }
 
     // Cleanup
@@ -3035,8 +3831,235 @@ const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
     return &io;
 }
 
+// Rasterize one pending glyph into an already packed rectangle, then patch its ImFontGlyph in place.
+// (we never add/remove glyphs here: pointers like FallbackGlyph and glyphs already looked up by the caller need to stay valid)
+static void ImFontAtlasBuildDynamicRenderGlyph(ImFontAtlas* atlas, ImFontBuildDynamicData* dyn_data, int src_i, ImFontGlyph* glyph, stbrp_rect* r)
+{
+    ImFontBuildDynamicSrcData& src_dyn = dyn_data->Srcs[src_i];
+    ImFontConfig& cfg = atlas->ConfigData[src_i];
+    ImFontAtlasTexRect dirty_rect = { (unsigned short)r->x, (unsigned short)r->y, (unsigned short)r->w, (unsigned short)r->h };
+
+    int codepoint = (int)glyph->Codepoint;
+    stbtt_packedchar pc = {};
+    stbtt_pack_range range = {};
+    range.font_size = cfg.SizePixels * cfg.RasterizerDensity;
+    range.array_of_unicode_codepoints = &codepoint;
+    range.num_chars = 1;
+    range.chardata_for_range = &pc;
+    range.h_oversample = (unsigned char)cfg.OversampleH;
+    range.v_oversample = (unsigned char)cfg.OversampleV;
+
+    stbtt_pack_context spc = {};
+    spc.pack_info = dyn_data->PackContext;
+    spc.width = atlas->TexWidth;
+    spc.height = atlas->TexHeight;
+    spc.stride_in_bytes = atlas->TexWidth;
+    spc.padding = atlas->TexGlyphPadding;
+    spc.h_oversample = spc.v_oversample = 1;
+    spc.pixels = atlas->TexPixelsAlpha8;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &src_dyn.FontInfo, &range, 1, r);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+    }
+
+    // Keep RGBA32 copy in sync if it was requested
+    if (atlas->TexPixelsRGBA32 != NULL)
+        for (int y = dirty_rect.Y; y < dirty_rect.Y + dirty_rect.Height; y++)
+        {
+            const unsigned char* src = &atlas->TexPixelsAlpha8[dirty_rect.X + y * atlas->TexWidth];
+            unsigned int* dst = &atlas->TexPixelsRGBA32[dirty_rect.X + y * atlas->TexWidth];
+            for (int n = dirty_rect.Width; n > 0; n--)
+                *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+        }
+    atlas->TexDirtyRects.push_back(dirty_rect);
+
+    // Same as ImFontAtlasBuildWithStbTruetype() + ImFont::AddGlyph(), minus AdvanceX which has already been set by Build()
+    stbtt_aligned_quad q;
+    float unused_x = 0.0f, unused_y = 0.0f;
+    stbtt_GetPackedQuad(&pc, atlas->TexWidth, atlas->TexHeight, 0, &unused_x, &unused_y, &q, 0);
+    const float inv_rasterization_scale = 1.0f / cfg.RasterizerDensity;
+    float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(cfg.DstFont->Ascent);
+    const float advance_x_original = pc.xadvance * inv_rasterization_scale;
+    const float advance_x = ImClamp(advance_x_original, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX);
+    if (advance_x != advance_x_original)
+        font_off_x += cfg.PixelSnapH ? ImTrunc((advance_x - advance_x_original) * 0.5f) : (advance_x - advance_x_original) * 0.5f;
+    glyph->X0 = q.x0 * inv_rasterization_scale + font_off_x;
+    glyph->Y0 = q.y0 * inv_rasterization_scale + font_off_y;
+    glyph->X1 = q.x1 * inv_rasterization_scale + font_off_x;
+    glyph->Y1 = q.y1 * inv_rasterization_scale + font_off_y;
+    glyph->U0 = q.s0;
+    glyph->V0 = q.t0;
+    glyph->U1 = q.s1;
+    glyph->V1 = q.t1;
+    glyph->Visible = (glyph->X0 != glyph->X1) && (glyph->Y0 != glyph->Y1);
+}
+
+// Pack and rasterize a glyph whose pending bit was cleared by ImFontAtlasBuildDynamicGlyph().
+static void ImFontAtlasBuildDynamicPackGlyph(ImFontAtlas* atlas, ImFontBuildDynamicData* dyn_data, int src_i, ImFontGlyph* glyph)
+{
+    // Allocate rectangle (same as the gathering loop in ImFontAtlasBuildWithStbTruetype())
+    ImFontBuildDynamicSrcData& src_dyn = dyn_data->Srcs[src_i];
+    const int codepoint = (int)glyph->Codepoint;
+    const ImFontConfig& cfg = atlas->ConfigData[src_i];
+    const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_dyn.FontInfo, codepoint);
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBoxSubpixel(&src_dyn.FontInfo, glyph_index_in_font, src_dyn.Scale * cfg.OversampleH, src_dyn.Scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    stbrp_rect r = {};
+    r.w = (stbrp_coord)(x1 - x0 + atlas->TexGlyphPadding + cfg.OversampleH - 1);
+    r.h = (stbrp_coord)(y1 - y0 + atlas->TexGlyphPadding + cfg.OversampleV - 1);
+    stbrp_pack_rects(dyn_data->PackContext, &r, 1);
+    if (!r.was_packed)
+        return; // Out of space: glyph will stay invisible
+
+    // Vertices using current UVs may already have been emitted this frame, so we can only grow the texture at the beginning of next frame.
+    if (r.y + r.h > atlas->TexHeight)
+    {
+        ImFontBuildDynamicDeferredGlyph deferred = { src_i, (ImWchar)codepoint, r };
+        dyn_data->Deferred.push_back(deferred);
+        dyn_data->TexHeightRequired = ImMax(dyn_data->TexHeightRequired, r.y + r.h);
+        return;
+    }
+    ImFontAtlasBuildDynamicRenderGlyph(atlas, dyn_data, src_i, glyph, &r);
+}
+
 #endif // IMGUI_ENABLE_STB_TRUETYPE
 
+void ImFontAtlasBuildDynamicGlyph(ImFontAtlas* atlas, ImFont* font, ImFontGlyph* glyph)
+{
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    ImFontBuildDynamicData* dyn_data = (ImFontBuildDynamicData*)atlas->FontBuilderDynamicData;
+    if (dyn_data == NULL || glyph->Visible)
+        return;
+
+    // Find which source font provides this glyph. Invisible glyphs which are not pending (e.g. space) are rejected here.
+    const int codepoint = (int)glyph->Codepoint;
+    int src_i = -1;
+    for (int n = 0; n < dyn_data->Srcs.Size && src_i == -1; n++)
+    {
+        const ImBitVector& pending = dyn_data->Srcs[n].GlyphsPending;
+        if (atlas->ConfigData[n].DstFont == font && codepoint < (pending.Storage.Size << 5) && pending.TestBit(codepoint))
+            src_i = n;
+    }
+    if (src_i == -1)
+        return;
+    ImFontBuildDynamicSrcData& src_dyn = dyn_data->Srcs[src_i];
+    src_dyn.GlyphsPending.ClearBit(codepoint);
+    src_dyn.GlyphsPendingCount--;
+
+    // Other threads may be reading glyphs and texture pixels while recording draw lists: leave them untouched until the next NewFrame()
+    if (atlas->DynamicGlyphsQueued)
+    {
+        ImFontBuildDynamicQueuedGlyph queued = { src_i, (ImWchar)codepoint };
+        dyn_data->Queued.push_back(queued);
+        return;
+    }
+    ImFontAtlasBuildDynamicPackGlyph(atlas, dyn_data, src_i, glyph);
+#else
+    IM_UNUSED(atlas);
+    IM_UNUSED(font);
+    IM_UNUSED(glyph);
+#endif
+}
+
+void ImFontAtlasBuildDynamicNewFrame(ImFontAtlas* atlas)
+{
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    ImFontBuildDynamicData* dyn_data = (ImFontBuildDynamicData*)atlas->FontBuilderDynamicData;
+    if (dyn_data == NULL)
+        return;
+
+    // Rasterize glyphs queued during last frame. Layouts cached by ImDrawList::AddTextCached() without them need to be rebuilt.
+    if (dyn_data->Queued.Size > 0)
+    {
+        for (ImFontBuildDynamicQueuedGlyph& queued : dyn_data->Queued)
+        {
+            ImFont* font = atlas->ConfigData[queued.SrcIndex].DstFont;
+            if (ImFontGlyph* glyph = (ImFontGlyph*)(void*)font->FindGlyphNoFallback(queued.Codepoint))
+                ImFontAtlasBuildDynamicPackGlyph(atlas, dyn_data, queued.SrcIndex, glyph);
+        }
+        dyn_data->Queued.resize(0);
+        atlas->TexGeneration++;
+    }
+    if (dyn_data->Deferred.Size == 0)
+        return;
+
+    // Grow texture height, preserving existing pixels
+    const int old_height = atlas->TexHeight;
+    const int new_height = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? ImMax(dyn_data->TexHeightRequired + 1, old_height + old_height / 2) : ImUpperPowerOfTwo(dyn_data->TexHeightRequired);
+    const size_t old_size = (size_t)atlas->TexWidth * (size_t)old_height;
+    const size_t new_size = (size_t)atlas->TexWidth * (size_t)new_height;
+    unsigned char* new_pixels_alpha8 = (unsigned char*)IM_ALLOC(new_size);
+    memcpy(new_pixels_alpha8, atlas->TexPixelsAlpha8, old_size);
+    memset(new_pixels_alpha8 + old_size, 0, new_size - old_size);
+    IM_FREE(atlas->TexPixelsAlpha8);
+    atlas->TexPixelsAlpha8 = new_pixels_alpha8;
+    if (atlas->TexPixelsRGBA32 != NULL)
+    {
+        unsigned int* new_pixels_rgba32 = (unsigned int*)IM_ALLOC(new_size * 4);
+        memcpy(new_pixels_rgba32, atlas->TexPixelsRGBA32, old_size * 4);
+        for (size_t n = old_size; n < new_size; n++)
+            new_pixels_rgba32[n] = IM_COL32(255, 255, 255, 0);
+        IM_FREE(atlas->TexPixelsRGBA32);
+        atlas->TexPixelsRGBA32 = new_pixels_rgba32;
+    }
+    atlas->TexHeight = new_height;
+
+    // Rescale all V coordinates
+    const float v_scale = (float)old_height / (float)new_height;
+    atlas->TexUvScale.y = 1.0f / atlas->TexHeight;
+    atlas->TexUvWhitePixel.y *= v_scale;
+    for (ImVec4& uv_lines : atlas->TexUvLines)
+    {
+        uv_lines.y *= v_scale;
+        uv_lines.w *= v_scale;
+    }
+    for (ImFont* font : atlas->Fonts)
+        for (ImFontGlyph& glyph : font->Glyphs)
+        {
+            glyph.V0 *= v_scale;
+            glyph.V1 *= v_scale;
+        }
+
+    // Rasterize deferred glyphs
+    for (ImFontBuildDynamicDeferredGlyph& deferred : dyn_data->Deferred)
+    {
+        ImFont* font = atlas->ConfigData[deferred.SrcIndex].DstFont;
+        if (ImFontGlyph* glyph = (ImFontGlyph*)(void*)font->FindGlyphNoFallback(deferred.Codepoint))
+            ImFontAtlasBuildDynamicRenderGlyph(atlas, dyn_data, deferred.SrcIndex, glyph, &deferred.Rect);
+    }
+    dyn_data->Deferred.resize(0);
+
+    atlas->TexGeneration++;
+
+    // Whole texture needs to be uploaded again
+    atlas->TexDirtyRects.resize(0);
+    ImFontAtlasTexRect full_rect = { 0, 0, (unsigned short)atlas->TexWidth, (unsigned short)atlas->TexHeight };
+    atlas->TexDirtyRects.push_back(full_rect);
+#else
+    IM_UNUSED(atlas);
+#endif
+}
+
+void ImFontAtlasBuildDynamicDestroy(ImFontAtlas* atlas)
+{
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    ImFontBuildDynamicData* dyn_data = (ImFontBuildDynamicData*)atlas->FontBuilderDynamicData;
+    if (dyn_data == NULL)
+        return;
+    IM_FREE(dyn_data->PackContext);
+    IM_FREE(dyn_data->PackNodes);
+    dyn_data->Srcs.clear_destruct();
+    IM_DELETE(dyn_data);
+#endif
+    atlas->FontBuilderDynamicData = NULL;
+}
+
 void ImFontAtlasUpdateConfigDataPointers(ImFontAtlas* atlas)
 {
     for (ImFontConfig& font_cfg : atlas->ConfigData)
@@ -3261,6 +4284,7 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
             font->BuildLookupTable();
 
     atlas->TexReady = true;
+    atlas->TexGeneration++;
 }
 
 // Retrieve list of range (2 int per range, values are inclusive)
@@ -3587,6 +4611,7 @@ ImFont::ImFont()
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
+    memset(AsciiGlyphs, 0, sizeof(AsciiGlyphs));
 }
 
 ImFont::~ImFont()
@@ -3606,6 +4631,7 @@ void    ImFont::ClearOutputData()
     DirtyLookupTables = true;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
+    memset(AsciiGlyphs, 0, sizeof(AsciiGlyphs));
 }
 
 static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_chars, int candidate_chars_count)
@@ -3676,6 +4702,8 @@ void ImFont::BuildLookupTable()
     for (int i = 0; i < max_codepoint + 1; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
+    for (int c = 0; c < IM_ARRAYSIZE(AsciiGlyphs); c++)
+        AsciiGlyphs[c] = FindGlyph((ImWchar)c);
 
     // Setup Ellipsis character. It is required for rendering elided text. We prefer using U+2026 (horizontal ellipsis).
     // However some old fonts may contain ellipsis at U+0085. Here we auto-detect most suitable ellipsis character.
@@ -3788,6 +4816,8 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
     GrowIndex(dst + 1);
     IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
     IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    if (dst < IM_ARRAYSIZE(AsciiGlyphs))
+        AsciiGlyphs[dst] = FindGlyph(dst);
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
@@ -3810,6 +4840,28 @@ const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
     return &Glyphs.Data[i];
 }
 
+// Return the end of the run of printable ASCII characters (0x20..0x7E) starting at 'text'.
+// Those need no UTF-8 decoding nor control character handling, allowing RenderText()/CalcTextSizeA() to process them in a tighter loop.
+static inline const char* CalcPrintableAsciiRunEndA(const char* text, const char* text_end)
+{
+#ifdef IMGUI_ENABLE_SSE
+    // Test 16 bytes at a time: characters >= 0x80 are negative when compared as signed bytes.
+    const __m128i min_excl = _mm_set1_epi8(0x1F);
+    const __m128i max_excl = _mm_set1_epi8(0x7F);
+    while (text_end - text >= 16)
+    {
+        const __m128i chars = _mm_loadu_si128((const __m128i*)(const void*)text);
+        const __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(chars, min_excl), _mm_cmplt_epi8(chars, max_excl));
+        if (_mm_movemask_epi8(printable) != 0xFFFF)
+            break;
+        text += 16;
+    }
+#endif
+    while (text < text_end && (unsigned int)((unsigned char)*text - 0x20) < 0x5F)
+        text++;
+    return text;
+}
+
 // Wrapping skips upcoming blanks
 static inline const char* CalcWordWrapNextLineStartA(const char* text, const char* text_end)
 {
@@ -3934,6 +4986,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
 
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
+    const bool ascii_fast_path = !word_wrap_enabled && IndexAdvanceX.Size >= 0x80;
 
     const char* s = text_begin;
     while (s < text_end)
@@ -3955,6 +5008,22 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 continue;
             }
         }
+        else if (ascii_fast_path && (unsigned int)((unsigned char)*s - 0x20) < 0x5F)
+        {
+            // Fast path for runs of printable ASCII characters
+            const char* run_end = CalcPrintableAsciiRunEndA(s, text_end);
+            const float* advance_x = IndexAdvanceX.Data;
+            for (; s < run_end; s++)
+            {
+                const float char_width = advance_x[(unsigned char)*s] * scale;
+                if (line_width + char_width >= max_width)
+                    break;
+                line_width += char_width;
+            }
+            if (s < run_end)
+                break;
+            continue;
+        }
 
         // Decode and advance source
         const char* prev_s = s;
@@ -3999,10 +5068,33 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     return text_size;
 }
 
+// Draw lists recorded on other threads never rasterize glyphs (see ImDrawListSharedData::NoDynamicGlyphs), so their text is preloaded from the main thread.
+// While such draw lists may be recording, glyphs are only queued here (see ImFontAtlas::DynamicGlyphsQueued).
+void ImFont::PreloadGlyphs(const char* text_begin, const char* text_end)
+{
+    if (ContainerAtlas->FontBuilderDynamicData == NULL)
+        return;
+    if (text_end == NULL)
+        text_end = text_begin + strlen(text_begin);
+    for (const char* s = text_begin; s < text_end; )
+    {
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+        const ImFontGlyph* glyph = FindGlyph((ImWchar)c);
+        if (glyph && !glyph->Visible)
+            ImFontAtlasBuildDynamicGlyph(ContainerAtlas, this, (ImFontGlyph*)glyph);
+    }
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c) const
 {
     const ImFontGlyph* glyph = FindGlyph(c);
+    if (glyph && !glyph->Visible && ContainerAtlas->FontBuilderDynamicData != NULL && !draw_list->_Data->NoDynamicGlyphs)
+        ImFontAtlasBuildDynamicGlyph(ContainerAtlas, (ImFont*)this, (ImFontGlyph*)glyph);
     if (!glyph || !glyph->Visible)
         return;
     if (glyph->Colored)
@@ -4080,6 +5172,8 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
+    const bool dynamic_glyphs = (ContainerAtlas->FontBuilderDynamicData != NULL && !draw_list->_Data->NoDynamicGlyphs);
+    const bool ascii_fast_path = !word_wrap_enabled && !cpu_fine_clip;
 
     while (s < text_end)
     {
@@ -4100,6 +5194,44 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                 continue;
             }
         }
+        else if (ascii_fast_path && (unsigned int)((unsigned char)*s - 0x20) < 0x5F)
+        {
+            // Fast path for runs of printable ASCII characters: no decoding, no control characters, glyphs from dense table.
+            // Output is identical to the generic path below (Basic Latin glyphs are never rasterized on demand).
+            const char* run_end = CalcPrintableAsciiRunEndA(s, text_end);
+            for (; s < run_end; s++)
+            {
+                const ImFontGlyph* glyph = AsciiGlyphs[(unsigned char)*s];
+                if (glyph == NULL)
+                    continue;
+                if (glyph->Visible)
+                {
+                    const float x1 = x + glyph->X0 * scale;
+                    const float x2 = x + glyph->X1 * scale;
+                    if (x1 <= clip_rect.z && x2 >= clip_rect.x)
+                    {
+                        const float y1 = y + glyph->Y0 * scale;
+                        const float y2 = y + glyph->Y1 * scale;
+                        const float u1 = glyph->U0;
+                        const float v1 = glyph->V0;
+                        const float u2 = glyph->U1;
+                        const float v2 = glyph->V1;
+                        const ImU32 glyph_col = glyph->Colored ? col_untinted : col;
+                        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
+                        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
+                        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
+                        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+                        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+                        vtx_write += 4;
+                        vtx_index += 4;
+                        idx_write += 6;
+                    }
+                }
+                x += glyph->AdvanceX * scale;
+            }
+            continue;
+        }
 
         // Decode and advance source
         unsigned int c = (unsigned int)*s;
@@ -4125,6 +5257,8 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         const ImFontGlyph* glyph = FindGlyph((ImWchar)c);
         if (glyph == NULL)
             continue;
+        if (!glyph->Visible && dynamic_glyphs)
+            ImFontAtlasBuildDynamicGlyph(ContainerAtlas, (ImFont*)this, (ImFontGlyph*)glyph); // Rasterize on first use
 
         float char_width = glyph->AdvanceX * scale;
         if (glyph->Visible)
@@ -5,7 +5,16 @@
 
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Multi-viewport support (multiple windows). Enable with 'io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable'.
 //  [x] Renderer: Large meshes support (64k+ vertices) with 16-bit indices (Desktop OpenGL only).
+//  [x] Renderer: Optional streaming of vertex/index data through a persistently mapped ring buffer (Desktop OpenGL 4.4+ or GL_ARB_buffer_storage). See ImGui_ImplOpenGL3_SetFlags().
+//  [x] Renderer: Optional single upload of all draw lists per frame, with multi-draw batching of commands sharing texture and clip rectangle (Desktop OpenGL 3.2+).
+//  [x] Renderer: Incremental font atlas updates (ImGuiBackendFlags_RendererHasTexUpdates), for use with ImFontAtlasFlags_DynamicGlyphs.
+//  [x] Renderer: Single-channel GL_R8 font texture (Desktop OpenGL 3.3+, OpenGL ES 3.0+). Atlas with colored content use RGBA32.
+//  [x] Renderer: Optional retained per-draw-list buffers, only re-uploading draw lists whose contents changed, and detection of unchanged frames. See ImGui_ImplOpenGL3_HasDrawDataChanged().
+//  [x] Renderer: Compact 12-bytes vertices (IMGUI_USE_COMPACT_DRAWVERT).
+//  [x] Renderer: Optional image atlas packing many small images into shared textures, so consecutive ImGui::Image() calls merge into one draw call. See ImGui_ImplOpenGL3_AddAtlasImage().
+//  [x] Renderer: Anti-aliased lines expanded on the GPU with instancing (ImGuiBackendFlags_RendererHasGpuLines), for use with style.AntiAliasedLinesUseGpu (Desktop OpenGL 3.3+, OpenGL ES 3.0+).
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -22,6 +31,16 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-14: OpenGL: Added support for multiple viewports (Renderer_CreateWindow/Renderer_DestroyWindow/Renderer_RenderWindow), sharing program, buffers and stream ring between viewport contexts and keeping one VAO per viewport. Added ImGui_ImplOpenGL3_Flags_NoStateBackup to skip GL state backup/restore.
+//  2026-10-14: OpenGL: Added ImGui_ImplOpenGL3_AddAtlasImage()/ImGui_ImplOpenGL3_RemoveAtlasImage() to pack small RGBA images into shared IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE^2 textures with a shelf allocator, so images are drawn without a texture change between them.
+//  2026-10-14: OpenGL: Added support for IMGUI_USE_COMPACT_DRAWVERT: 16-bit fixed-point positions are scaled by the projection matrix, 16-bit UV are read normalized.
+//  2026-10-14: OpenGL: Added support for ImGuiBackendFlags_RendererHasGpuLines: ImDrawCallback_GpuLines commands are drawn with an instanced shader building one anti-aliased quad per segment.
+//  2026-10-14: OpenGL: Time ImGui_ImplOpenGL3_RenderDrawData() with the Metrics->Profiler when enabled.
+//  2026-10-14: OpenGL: Added ImGui_ImplOpenGL3_Flags_RetainBuffers to keep one buffer pair per draw list and skip uploading lists whose fingerprint didn't change. Added ImGui_ImplOpenGL3_HasDrawDataChanged() to detect frames identical to the last rendered one.
+//  2026-10-14: OpenGL: Upload font atlas as a single-channel GL_R8 texture swizzled to (1,1,1,R) when supported, instead of expanding it to RGBA32. Atlas with TexPixelsUseColors set or already converted to RGBA32 (e.g. by the app to write colored custom rects), contexts without texture swizzle or ImGui_ImplOpenGL3_Flags_FontTextureRGBA32 keep using RGBA32.
+//  2026-10-14: OpenGL: Added support for ImGuiBackendFlags_RendererHasTexUpdates: upload ImFontAtlas::TexDirtyRects[] with glTexSubImage2D() and reallocate the font texture when a dynamic atlas grows.
+//  2026-10-14: OpenGL: Added ImGui_ImplOpenGL3_Flags_SingleUpload to upload all draw lists into one vertex/index buffer pair per frame. Consecutive commands sharing texture and clip rectangle are submitted with glMultiDrawElementsBaseVertex().
+//  2026-10-14: OpenGL: Added ImGui_ImplOpenGL3_SetFlags() and ImGui_ImplOpenGL3_Flags_BufferStorage to stream all vertex/index data of a frame into a persistently mapped, fenced ring buffer. Falls back to glBufferData() when unsupported.
 //  2024-01-09: OpenGL: Update GL3W based imgui_impl_opengl3_loader.h to load "libGL.so" and variants, fixing regression on distros missing a symlink.
 //  2023-11-08: OpenGL: Update GL3W based imgui_impl_opengl3_loader.h to load "libGL.so" instead of "libGL.so.1", accommodating for NetBSD systems having only "libGL.so.3" available. (#6983)
 //  2023-10-05: OpenGL: Rename symbols in our internal loader so that LTO compilation with another copy of gl3w is possible. (#6875, #6668, #4445)
@@ -202,6 +221,26 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0+ have GL_TEXTURE_SWIZZLE_XXX, which WebGL doesn't have.
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(__EMSCRIPTEN__) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+#endif
+
+// Desktop GL 3.3+ and GL ES 3.0+ have glDrawArraysInstanced() + glVertexAttribDivisor()
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+#endif
+
+// Desktop GL 4.4+ has glBufferStorage() which GL ES and WebGL don't have. Also exposed by GL_ARB_buffer_storage on older contexts.
+#if defined(IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET) && (defined(GL_VERSION_4_4) || defined(GL_ARB_buffer_storage))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+#endif
+
+// Number of frames the persistently mapped stream buffer can hold before the CPU has to wait on the GPU.
+#ifndef IMGUI_IMPL_OPENGL_STREAM_FRAMES
+#define IMGUI_IMPL_OPENGL_STREAM_FRAMES 3
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -211,6 +250,67 @@
 #define GL_CALL(_CALL)      _CALL   // Call without error check
 #endif
 
+// Number of frames a draw list can go without being rendered before we release its retained buffers.
+#ifndef IMGUI_IMPL_OPENGL_RETAIN_FRAMES
+#define IMGUI_IMPL_OPENGL_RETAIN_FRAMES 60
+#endif
+
+// Vertex attribute formats (type, normalized) for ImDrawVert.
+// With IMGUI_USE_COMPACT_DRAWVERT, positions are read as 16-bit integers and scaled back to pixels by the projection matrix.
+// ImDrawCallback_GpuLines parameters stored in uv are then read unnormalized, which gives them the same units as positions.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#define IMGUI_IMPL_OPENGL_VTX_POS_FORMAT        GL_SHORT, GL_FALSE
+#define IMGUI_IMPL_OPENGL_VTX_UV_FORMAT         GL_UNSIGNED_SHORT, GL_TRUE
+#define IMGUI_IMPL_OPENGL_LINES_PARAMS_FORMAT   GL_UNSIGNED_SHORT, GL_FALSE
+#define IMGUI_IMPL_OPENGL_VTX_POS_SCALE         (1.0f / IM_DRAWVERT_POS_SCALE)
+#else
+#define IMGUI_IMPL_OPENGL_VTX_POS_FORMAT        GL_FLOAT, GL_FALSE
+#define IMGUI_IMPL_OPENGL_VTX_UV_FORMAT         GL_FLOAT, GL_FALSE
+#define IMGUI_IMPL_OPENGL_LINES_PARAMS_FORMAT   GL_FLOAT, GL_FALSE
+#define IMGUI_IMPL_OPENGL_VTX_POS_SCALE         1.0f
+#endif
+
+// Buffers kept for one ImDrawList with ImGui_ImplOpenGL3_Flags_RetainBuffers
+struct ImGui_ImplOpenGL3_RetainedList
+{
+    const ImDrawList*   List;           // Only used as a lookup key, never dereferenced out of the frame it was submitted in. A recycled address simply fails the hash compare.
+    ImU64               UploadedHash;   // Fingerprint of the contents of VboHandle/ElementsHandle
+    ImU64               PendingHash;    // Fingerprint of List, computed during PendingFrame
+    int                 PendingFrame;
+    int                 LastUsedFrame;
+    GLuint              VboHandle, ElementsHandle;
+    bool                Uploaded;
+    bool                HasCallbacks;   // Contains user callbacks other than ImDrawCallback_ResetRenderState
+};
+
+// Width and height of image atlas pages, in texels (4 MB per page)
+#ifndef IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE
+#define IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE 1024
+#endif
+
+// Image atlas pages are split into horizontal shelves, each shelf tracking its free horizontal spans
+struct ImGui_ImplOpenGL3_AtlasSpan
+{
+    int                 X, Width;
+};
+struct ImGui_ImplOpenGL3_AtlasShelf
+{
+    int                 Y, Height;
+    ImVector<ImGui_ImplOpenGL3_AtlasSpan> FreeSpans; // Sorted by X, never adjacent
+};
+struct ImGui_ImplOpenGL3_AtlasPage
+{
+    GLuint              Texture;        // 0 when the page was released and its slot can be reused
+    int                 ShelvesHeight;  // Texels below this are not used by any shelf
+    int                 ImagesCount;
+    unsigned int        Generation;     // Unique to each page created, 0 when released
+    ImVector<ImGui_ImplOpenGL3_AtlasShelf> Shelves;
+    ImGui_ImplOpenGL3_AtlasPage() { Texture = 0; ShelvesHeight = ImagesCount = 0; Generation = 0; }
+};
+
+// Last page generation handed out. Not stored in the backend data so that images outliving a Shutdown()/Init() cycle are still detected as stale.
+static unsigned int g_AtlasPageGeneration = 0;
+
 // OpenGL Data
 struct ImGui_ImplOpenGL3_Data
 {
@@ -221,17 +321,58 @@ struct ImGui_ImplOpenGL3_Data
     bool            GlProfileIsCompat;
     GLint           GlProfileMask;
     GLuint          FontTexture;
+    GLint           FontTextureInternalFormat; // GL_R8 (single channel, swizzled to white + alpha) or GL_RGBA.
+    GLenum          FontTextureFormat;       // GL_RED or GL_RGBA.
+    int             FontTextureWidth;        // Size of FontTexture storage, to detect growth of a dynamic atlas.
+    int             FontTextureHeight;
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
+    GLuint          LinesShaderHandle;       // Program for ImDrawCallback_GpuLines commands, 0 when unsupported
+    GLint           LinesAttribLocationProjMtx;
+    GLuint          LinesAttribLocationPos0; // Per instance vertex attributes for one segment: ImDrawVert N (pos, uv, col) and ImDrawVert N+1 (pos)
+    GLuint          LinesAttribLocationParams;
+    GLuint          LinesAttribLocationColor;
+    GLuint          LinesAttribLocationPos1;
     unsigned int    VboHandle, ElementsHandle;
     GLsizeiptr      VertexBufferSize;
     GLsizeiptr      IndexBufferSize;
     bool            HasClipOrigin;
+    bool            HasBufferStorage;
     bool            UseBufferSubData;
+    bool            UseBufferStorage;        // Updated every frame from Flags & HasBufferStorage.
+    ImGui_ImplOpenGL3_Flags Flags;
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    // Persistently mapped stream buffers, split in IMGUI_IMPL_OPENGL_STREAM_FRAMES regions each guarded by a fence.
+    GLuint          StreamVboHandle, StreamElementsHandle;
+    ImDrawVert*     StreamVtxMapped;
+    ImDrawIdx*      StreamIdxMapped;
+    int             StreamVtxCapacity;       // Per-region capacity, in vertices
+    int             StreamIdxCapacity;       // Per-region capacity, in indices
+    int             StreamRegion;
+    int             StreamRegionFrame;       // Frame which last started writing to StreamRegion
+    int             StreamRegionVtxUsed;     // Vertices/indices written to StreamRegion by this frame, in case of multiple viewports
+    int             StreamRegionIdxUsed;
+    ImVector<GLsync> StreamFences[IMGUI_IMPL_OPENGL_STREAM_FRAMES]; // One per draw data rendered into the region: each viewport renders with its own GL context, and a fence only covers commands of its context.
+#endif
+
+    // Pending run of draw commands sharing texture and clip rectangle, submitted as a single multi-draw.
+    ImVector<GLsizei>       BatchCounts;
+    ImVector<const void*>   BatchIndices;
+    ImVector<GLint>         BatchBaseVertices;
+
+    // Retained per draw list buffers, and fingerprint of the last frame rendered with them.
+    ImVector<ImGui_ImplOpenGL3_RetainedList> RetainedLists;
+    int                     RetainedListsCursor;    // Lists are generally submitted in the same order every frame: start searching from there.
+    ImU64                   RenderedFrameHash;      // 0 when unknown, or when the frame had user callbacks. Only used for draw data without ImGui_ImplOpenGL3_ViewportData, see ImGui_ImplOpenGL3_GetRenderedFrameHash().
+
+    // Image atlas pages, see ImGui_ImplOpenGL3_AddAtlasImage().
+    ImVector<ImGui_ImplOpenGL3_AtlasPage> AtlasPages;
+    ImVector<ImU32>         AtlasUploadBuffer;      // Image with its borders, staged for glTexSubImage2D()
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -267,6 +408,178 @@ struct ImGui_ImplOpenGL3_VtxAttribState
 };
 #endif
 
+// Backup of the GL state modified by ImGui_ImplOpenGL3_RenderDrawData(). Skipped with ImGui_ImplOpenGL3_Flags_NoStateBackup.
+struct ImGui_ImplOpenGL3_StateBackup
+{
+    GLenum      ActiveTexture;
+    GLuint      Program;
+    GLuint      Texture;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
+    GLuint      Sampler;
+#endif
+    GLuint      ArrayBuffer;
+#ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    // This is part of VAO on OpenGL 3.0+ and OpenGL ES 3.0+.
+    GLint       ElementArrayBuffer;
+    ImGui_ImplOpenGL3_VtxAttribState VtxAttribStatePos;
+    ImGui_ImplOpenGL3_VtxAttribState VtxAttribStateUV;
+    ImGui_ImplOpenGL3_VtxAttribState VtxAttribStateColor;
+#endif
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    GLuint      VertexArrayObject;
+#endif
+#ifdef IMGUI_IMPL_OPENGL_HAS_POLYGON_MODE
+    GLint       PolygonMode[2];
+#endif
+    GLint       Viewport[4];
+    GLint       ScissorBox[4];
+    GLenum      BlendSrcRgb, BlendDstRgb, BlendSrcAlpha, BlendDstAlpha;
+    GLenum      BlendEquationRgb, BlendEquationAlpha;
+    GLboolean   EnableBlend, EnableCullFace, EnableDepthTest, EnableStencilTest, EnableScissorTest;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
+    GLboolean   EnablePrimitiveRestart;
+#endif
+
+    // Also selects texture unit 0, which the texture binding we save and restore belongs to.
+    void Backup()
+    {
+        ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+        glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&ActiveTexture);
+        glActiveTexture(GL_TEXTURE0);
+        glGetIntegerv(GL_CURRENT_PROGRAM, (GLint*)&Program);
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&Texture);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
+        if (bd->GlVersion >= 330 || bd->GlProfileIsES3) { glGetIntegerv(GL_SAMPLER_BINDING, (GLint*)&Sampler); } else { Sampler = 0; }
+#endif
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, (GLint*)&ArrayBuffer);
+#ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+        glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &ElementArrayBuffer);
+        VtxAttribStatePos.GetState(bd->AttribLocationVtxPos);
+        VtxAttribStateUV.GetState(bd->AttribLocationVtxUV);
+        VtxAttribStateColor.GetState(bd->AttribLocationVtxColor);
+#endif
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, (GLint*)&VertexArrayObject);
+#endif
+#ifdef IMGUI_IMPL_OPENGL_HAS_POLYGON_MODE
+        glGetIntegerv(GL_POLYGON_MODE, PolygonMode);
+#endif
+        glGetIntegerv(GL_VIEWPORT, Viewport);
+        glGetIntegerv(GL_SCISSOR_BOX, ScissorBox);
+        glGetIntegerv(GL_BLEND_SRC_RGB, (GLint*)&BlendSrcRgb);
+        glGetIntegerv(GL_BLEND_DST_RGB, (GLint*)&BlendDstRgb);
+        glGetIntegerv(GL_BLEND_SRC_ALPHA, (GLint*)&BlendSrcAlpha);
+        glGetIntegerv(GL_BLEND_DST_ALPHA, (GLint*)&BlendDstAlpha);
+        glGetIntegerv(GL_BLEND_EQUATION_RGB, (GLint*)&BlendEquationRgb);
+        glGetIntegerv(GL_BLEND_EQUATION_ALPHA, (GLint*)&BlendEquationAlpha);
+        EnableBlend = glIsEnabled(GL_BLEND);
+        EnableCullFace = glIsEnabled(GL_CULL_FACE);
+        EnableDepthTest = glIsEnabled(GL_DEPTH_TEST);
+        EnableStencilTest = glIsEnabled(GL_STENCIL_TEST);
+        EnableScissorTest = glIsEnabled(GL_SCISSOR_TEST);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
+        EnablePrimitiveRestart = (bd->GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
+#endif
+        (void)bd; // Not all compilation paths use this
+    }
+
+    void Restore()
+    {
+        ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+        // This "glIsProgram()" check is required because if the program is "pending deletion" at the time of binding backup, it will have been deleted by now and will cause an OpenGL error. See #6220.
+        if (Program == 0 || glIsProgram(Program)) glUseProgram(Program);
+        glBindTexture(GL_TEXTURE_2D, Texture);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
+        if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
+            glBindSampler(0, Sampler);
+#endif
+        glActiveTexture(ActiveTexture);
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+        glBindVertexArray(VertexArrayObject);
+#endif
+        glBindBuffer(GL_ARRAY_BUFFER, ArrayBuffer);
+#ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ElementArrayBuffer);
+        VtxAttribStatePos.SetState(bd->AttribLocationVtxPos);
+        VtxAttribStateUV.SetState(bd->AttribLocationVtxUV);
+        VtxAttribStateColor.SetState(bd->AttribLocationVtxColor);
+#endif
+        glBlendEquationSeparate(BlendEquationRgb, BlendEquationAlpha);
+        glBlendFuncSeparate(BlendSrcRgb, BlendDstRgb, BlendSrcAlpha, BlendDstAlpha);
+        if (EnableBlend) glEnable(GL_BLEND); else glDisable(GL_BLEND);
+        if (EnableCullFace) glEnable(GL_CULL_FACE); else glDisable(GL_CULL_FACE);
+        if (EnableDepthTest) glEnable(GL_DEPTH_TEST); else glDisable(GL_DEPTH_TEST);
+        if (EnableStencilTest) glEnable(GL_STENCIL_TEST); else glDisable(GL_STENCIL_TEST);
+        if (EnableScissorTest) glEnable(GL_SCISSOR_TEST); else glDisable(GL_SCISSOR_TEST);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
+        if (bd->GlVersion >= 310) { if (EnablePrimitiveRestart) glEnable(GL_PRIMITIVE_RESTART); else glDisable(GL_PRIMITIVE_RESTART); }
+#endif
+
+#ifdef IMGUI_IMPL_OPENGL_HAS_POLYGON_MODE
+        // Desktop OpenGL 3.0 and OpenGL 3.1 had separate polygon draw modes for front-facing and back-facing faces of polygons
+        if (bd->GlVersion <= 310 || bd->GlProfileIsCompat)
+        {
+            glPolygonMode(GL_FRONT, (GLenum)PolygonMode[0]);
+            glPolygonMode(GL_BACK, (GLenum)PolygonMode[1]);
+        }
+        else
+        {
+            glPolygonMode(GL_FRONT_AND_BACK, (GLenum)PolygonMode[0]);
+        }
+#endif // IMGUI_IMPL_OPENGL_HAS_POLYGON_MODE
+
+        glViewport(Viewport[0], Viewport[1], (GLsizei)Viewport[2], (GLsizei)Viewport[3]);
+        glScissor(ScissorBox[0], ScissorBox[1], (GLsizei)ScissorBox[2], (GLsizei)ScissorBox[3]);
+        (void)bd; // Not all compilation paths use this
+    }
+};
+
+// Helper structure we store in the void* RendererUserData field of each ImGuiViewport to easily retrieve our backend data. See ImGui_ImplOpenGL3_InitPlatformInterface().
+struct ImGui_ImplOpenGL3_ViewportData
+{
+    GLuint      VertexArray;        // Created on the first render of the viewport, with its GL context current
+    GLuint      LinesVertexArray;
+    ImU64       RenderedFrameHash;  // Hash of the last draw data rendered for this viewport, see ImGui_ImplOpenGL3_HasDrawDataChanged()
+
+    ImGui_ImplOpenGL3_ViewportData() { VertexArray = LinesVertexArray = 0; RenderedFrameHash = 0; }
+};
+
+// Each viewport remembers its own last rendered frame, so rendering one doesn't make the others look changed.
+static ImU64* ImGui_ImplOpenGL3_GetRenderedFrameHash(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (draw_data->OwnerViewport != nullptr)
+        if (ImGui_ImplOpenGL3_ViewportData* vd = (ImGui_ImplOpenGL3_ViewportData*)draw_data->OwnerViewport->RendererUserData)
+            return &vd->RenderedFrameHash;
+    return &bd->RenderedFrameHash;
+}
+
+static void ImGui_ImplOpenGL3_ClearRenderedFrameHashes()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    bd->RenderedFrameHash = 0;
+    for (ImGuiViewport* viewport : ImGui::GetPlatformIO().Viewports)
+        if (ImGui_ImplOpenGL3_ViewportData* vd = (ImGui_ImplOpenGL3_ViewportData*)viewport->RendererUserData)
+            vd->RenderedFrameHash = 0;
+}
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+static void ImGui_ImplOpenGL3_WaitStreamFences(ImVector<GLsync>& fences)
+{
+    for (GLsync fence : fences)
+    {
+        GLenum wait_result;
+        do { wait_result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); } while (wait_result == GL_TIMEOUT_EXPIRED);
+        glDeleteSync(fence);
+    }
+    fences.resize(0);
+}
+#endif
+
+// Forward Declarations
+static void ImGui_ImplOpenGL3_InitPlatformInterface();
+static void ImGui_ImplOpenGL3_ShutdownPlatformInterface();
+
 // Functions
 bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 {
@@ -334,6 +647,7 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     if (bd->GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;     // We can upload ImFontAtlas::TexDirtyRects[], allowing for ImFontAtlasFlags_DynamicGlyphs.
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to nullptr if unsure.
@@ -368,8 +682,20 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
         if (extension != nullptr && strcmp(extension, "GL_ARB_clip_control") == 0)
             bd->HasClipOrigin = true;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+        if (extension != nullptr && strcmp(extension, "GL_ARB_buffer_storage") == 0 && bd->GlVersion >= 320)
+            bd->HasBufferStorage = true;
+#endif
     }
 #endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (bd->GlVersion >= 440)
+        bd->HasBufferStorage = true;
+#endif
+
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasViewports;      // We can create multi-viewports on the Renderer side (optional)
+    if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+        ImGui_ImplOpenGL3_InitPlatformInterface();
 
     return true;
 }
@@ -380,13 +706,28 @@ void    ImGui_ImplOpenGL3_Shutdown()
     IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
     ImGuiIO& io = ImGui::GetIO();
 
+    ImGui_ImplOpenGL3_ShutdownPlatformInterface();
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTexUpdates | ImGuiBackendFlags_RendererHasGpuLines | ImGuiBackendFlags_RendererHasViewports);
     IM_DELETE(bd);
 }
 
+void    ImGui_ImplOpenGL3_SetFlags(ImGui_ImplOpenGL3_Flags flags)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplOpenGL3_Init()?");
+    bd->Flags = flags;
+}
+
+ImGui_ImplOpenGL3_Flags ImGui_ImplOpenGL3_GetFlags()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplOpenGL3_Init()?");
+    return bd->Flags;
+}
+
 void    ImGui_ImplOpenGL3_NewFrame()
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
@@ -396,6 +737,8 @@ void    ImGui_ImplOpenGL3_NewFrame()
         ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
+static void ImGui_ImplOpenGL3_BindVertexBuffers(GLuint vbo_handle, GLuint elements_handle);
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
@@ -437,13 +780,19 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 #if defined(GL_CLIP_ORIGIN)
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
 #endif
+    const float S = IMGUI_IMPL_OPENGL_VTX_POS_SCALE;
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
+        { 2.0f*S/(R-L), 0.0f,         0.0f,   0.0f },
+        { 0.0f,         2.0f*S/(T-B), 0.0f,   0.0f },
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+    if (bd->LinesShaderHandle != 0)
+    {
+        glUseProgram(bd->LinesShaderHandle);
+        glUniformMatrix4fv(bd->LinesAttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    }
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
@@ -459,19 +808,432 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 #endif
 
     // Bind vertex/index buffers and setup attributes for ImDrawVert
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
-    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle));
+    GLuint vbo_handle = bd->VboHandle;
+    GLuint elements_handle = bd->ElementsHandle;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (bd->UseBufferStorage)
+    {
+        vbo_handle = bd->StreamVboHandle;
+        elements_handle = bd->StreamElementsHandle;
+    }
+#endif
+    ImGui_ImplOpenGL3_BindVertexBuffers(vbo_handle, elements_handle);
+}
+
+// Bind vertex/index buffers and point vertex attributes to them. Attribute pointers capture the GL_ARRAY_BUFFER binding, so this needs to be called for every buffer pair.
+static void ImGui_ImplOpenGL3_BindVertexBuffers(GLuint vbo_handle, GLuint elements_handle)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vbo_handle));
+    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elements_handle));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
-    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
-    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, IMGUI_IMPL_OPENGL_VTX_POS_FORMAT,  sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, IMGUI_IMPL_OPENGL_VTX_UV_FORMAT,   sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+static void ImGui_ImplOpenGL3_DestroyStreamBuffers()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    for (int n = 0; n < IMGUI_IMPL_OPENGL_STREAM_FRAMES; n++)
+    {
+        for (GLsync fence : bd->StreamFences[n])
+            glDeleteSync(fence);
+        bd->StreamFences[n].clear();
+    }
+    // Deleting a mapped buffer implicitly unmaps it. The driver defers the actual release until the GPU is done with it.
+    if (bd->StreamVboHandle)      { glDeleteBuffers(1, &bd->StreamVboHandle); bd->StreamVboHandle = 0; }
+    if (bd->StreamElementsHandle) { glDeleteBuffers(1, &bd->StreamElementsHandle); bd->StreamElementsHandle = 0; }
+    bd->StreamVtxMapped = nullptr;
+    bd->StreamIdxMapped = nullptr;
+    bd->StreamVtxCapacity = bd->StreamIdxCapacity = 0;
+    bd->StreamRegion = 0;
+    bd->StreamRegionFrame = -1;
+    bd->StreamRegionVtxUsed = bd->StreamRegionIdxUsed = 0;
+}
+
+static bool ImGui_ImplOpenGL3_CreateStreamBuffers(int vtx_capacity, int idx_capacity)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    const GLsizeiptr vtx_size = (GLsizeiptr)vtx_capacity * IMGUI_IMPL_OPENGL_STREAM_FRAMES * (int)sizeof(ImDrawVert);
+    const GLsizeiptr idx_size = (GLsizeiptr)idx_capacity * IMGUI_IMPL_OPENGL_STREAM_FRAMES * (int)sizeof(ImDrawIdx);
+
+    // Both buffers are created through GL_ARRAY_BUFFER so we don't disturb the element binding of whichever VAO is currently bound.
+    GL_CALL(glGenBuffers(1, &bd->StreamVboHandle));
+    GL_CALL(glGenBuffers(1, &bd->StreamElementsHandle));
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->StreamVboHandle));
+    GL_CALL(glBufferStorage(GL_ARRAY_BUFFER, vtx_size, nullptr, flags));
+    bd->StreamVtxMapped = (ImDrawVert*)glMapBufferRange(GL_ARRAY_BUFFER, 0, vtx_size, flags);
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->StreamElementsHandle));
+    GL_CALL(glBufferStorage(GL_ARRAY_BUFFER, idx_size, nullptr, flags));
+    bd->StreamIdxMapped = (ImDrawIdx*)glMapBufferRange(GL_ARRAY_BUFFER, 0, idx_size, flags);
+    if (bd->StreamVtxMapped == nullptr || bd->StreamIdxMapped == nullptr)
+    {
+        ImGui_ImplOpenGL3_DestroyStreamBuffers();
+        return false;
+    }
+    bd->StreamVtxCapacity = vtx_capacity;
+    bd->StreamIdxCapacity = idx_capacity;
+    return true;
+}
+
+// Copy all vertex/index data of the frame into the next region of the ring, waiting for the GPU to be done with it first.
+// Outputs the element offsets of the region, to be added to every ImDrawCmd::VtxOffset/IdxOffset.
+static bool ImGui_ImplOpenGL3_UploadStreamBuffers(ImDrawData* draw_data, int* out_vtx_base, int* out_idx_base)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (bd->StreamVboHandle == 0 || draw_data->TotalVtxCount > bd->StreamVtxCapacity || draw_data->TotalIdxCount > bd->StreamIdxCapacity)
+    {
+        // Grow with some slack to avoid recreating the storage every time a window gets a little busier.
+        int vtx_capacity = draw_data->TotalVtxCount + draw_data->TotalVtxCount / 2;
+        int idx_capacity = draw_data->TotalIdxCount + draw_data->TotalIdxCount / 2;
+        if (vtx_capacity < bd->StreamVtxCapacity) vtx_capacity = bd->StreamVtxCapacity;
+        if (idx_capacity < bd->StreamIdxCapacity) idx_capacity = bd->StreamIdxCapacity;
+        ImGui_ImplOpenGL3_DestroyStreamBuffers();
+        if (!ImGui_ImplOpenGL3_CreateStreamBuffers(vtx_capacity < 5000 ? 5000 : vtx_capacity, idx_capacity < 10000 ? 10000 : idx_capacity))
+            return false;
+    }
+
+    // With multiple viewports, draw data rendered during the same frame are appended to the same region, so a frame
+    // never waits on GPU work it submitted itself. Each of them adds its own fence, as viewports use different GL contexts:
+    // the region is only reused once all of them are signaled.
+    const int frame = ImGui::GetFrameCount();
+    if (bd->StreamRegionFrame != frame || bd->StreamRegionVtxUsed + draw_data->TotalVtxCount > bd->StreamVtxCapacity || bd->StreamRegionIdxUsed + draw_data->TotalIdxCount > bd->StreamIdxCapacity)
+    {
+        bd->StreamRegion = (bd->StreamRegion + 1) % IMGUI_IMPL_OPENGL_STREAM_FRAMES;
+        ImGui_ImplOpenGL3_WaitStreamFences(bd->StreamFences[bd->StreamRegion]);
+        bd->StreamRegionFrame = frame;
+        bd->StreamRegionVtxUsed = bd->StreamRegionIdxUsed = 0;
+    }
+
+    const int vtx_base = bd->StreamRegion * bd->StreamVtxCapacity + bd->StreamRegionVtxUsed;
+    const int idx_base = bd->StreamRegion * bd->StreamIdxCapacity + bd->StreamRegionIdxUsed;
+    bd->StreamRegionVtxUsed += draw_data->TotalVtxCount;
+    bd->StreamRegionIdxUsed += draw_data->TotalIdxCount;
+    ImDrawVert* vtx_dst = bd->StreamVtxMapped + vtx_base;
+    ImDrawIdx* idx_dst = bd->StreamIdxMapped + idx_base;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        memcpy(vtx_dst, cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        memcpy(idx_dst, cmd_list->IdxBuffer.Data, (size_t)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+        vtx_dst += cmd_list->VtxBuffer.Size;
+        idx_dst += cmd_list->IdxBuffer.Size;
+    }
+    *out_vtx_base = vtx_base;
+    *out_idx_base = idx_base;
+    return true;
+}
+#endif // #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+// Upload all draw lists back to back into the currently bound vertex/index buffers, orphaning their previous storage.
+// Data is copied straight from each ImDrawList into the mapped buffers, without intermediate staging.
+static void ImGui_ImplOpenGL3_UploadSingleBuffers(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const GLsizeiptr vtx_buffer_size = (GLsizeiptr)draw_data->TotalVtxCount * (int)sizeof(ImDrawVert);
+    const GLsizeiptr idx_buffer_size = (GLsizeiptr)draw_data->TotalIdxCount * (int)sizeof(ImDrawIdx);
+    if (bd->VertexBufferSize < vtx_buffer_size)
+        bd->VertexBufferSize = vtx_buffer_size + vtx_buffer_size / 2;
+    if (bd->IndexBufferSize < idx_buffer_size)
+        bd->IndexBufferSize = idx_buffer_size + idx_buffer_size / 2;
+    GL_CALL(glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, nullptr, GL_STREAM_DRAW));
+    GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, nullptr, GL_STREAM_DRAW));
+    if (vtx_buffer_size == 0 || idx_buffer_size == 0)
+        return;
+
+    const GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT;
+    ImDrawVert* vtx_dst = (ImDrawVert*)glMapBufferRange(GL_ARRAY_BUFFER, 0, vtx_buffer_size, access);
+    ImDrawIdx* idx_dst = (ImDrawIdx*)glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, access);
+    GLintptr vtx_offset = 0;
+    GLintptr idx_offset = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        const GLsizeiptr list_vtx_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
+        const GLsizeiptr list_idx_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+        if (vtx_dst != nullptr)
+            memcpy((char*)vtx_dst + vtx_offset, cmd_list->VtxBuffer.Data, (size_t)list_vtx_size);
+        else
+            GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, vtx_offset, list_vtx_size, (const GLvoid*)cmd_list->VtxBuffer.Data));
+        if (idx_dst != nullptr)
+            memcpy((char*)idx_dst + idx_offset, cmd_list->IdxBuffer.Data, (size_t)list_idx_size);
+        else
+            GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, idx_offset, list_idx_size, (const GLvoid*)cmd_list->IdxBuffer.Data));
+        vtx_offset += list_vtx_size;
+        idx_offset += list_idx_size;
+    }
+
+    // glUnmapBuffer() returns GL_FALSE when the mapped contents were lost (e.g. on a display mode switch): upload them again for this frame.
+    bool vtx_lost = false, idx_lost = false;
+    if (vtx_dst != nullptr)
+        GL_CALL(vtx_lost = glUnmapBuffer(GL_ARRAY_BUFFER) == GL_FALSE);
+    if (idx_dst != nullptr)
+        GL_CALL(idx_lost = glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER) == GL_FALSE);
+    if (!vtx_lost && !idx_lost)
+        return;
+    vtx_offset = idx_offset = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        const GLsizeiptr list_vtx_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
+        const GLsizeiptr list_idx_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+        if (vtx_lost)
+            GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, vtx_offset, list_vtx_size, (const GLvoid*)cmd_list->VtxBuffer.Data));
+        if (idx_lost)
+            GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, idx_offset, list_idx_size, (const GLvoid*)cmd_list->IdxBuffer.Data));
+        vtx_offset += list_vtx_size;
+        idx_offset += list_idx_size;
+    }
+}
+
+// Submit the pending run of draws accumulated by ImGui_ImplOpenGL3_RenderDrawData().
+static void ImGui_ImplOpenGL3_FlushBatch()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const GLenum idx_type = sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    if (bd->BatchCounts.Size == 1)
+        GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, bd->BatchCounts[0], idx_type, bd->BatchIndices[0], bd->BatchBaseVertices[0]));
+    else if (bd->BatchCounts.Size > 1)
+        GL_CALL(glMultiDrawElementsBaseVertex(GL_TRIANGLES, bd->BatchCounts.Data, idx_type, bd->BatchIndices.Data, (GLsizei)bd->BatchCounts.Size, bd->BatchBaseVertices.Data));
+    bd->BatchCounts.resize(0);
+    bd->BatchIndices.resize(0);
+    bd->BatchBaseVertices.resize(0);
+}
+#endif // #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+
+// Fingerprint used to detect changes in draw lists (8 bytes at a time). Not meant to be resistant to anything adversarial.
+static ImU64 ImGui_ImplOpenGL3_HashBytes(const void* data, size_t data_size, ImU64 seed)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    ImU64 h = seed ^ ((ImU64)data_size * 0x9E3779B97F4A7C15ull);
+    for (; data_size >= 8; data_size -= 8, p += 8)
+    {
+        ImU64 w; memcpy(&w, p, 8);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 32;
+    }
+    if (data_size > 0)
+    {
+        ImU64 w = 0; memcpy(&w, p, data_size);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 32;
+    }
+    return h;
+}
+
+// Hash vertices, indices and commands. ImDrawCmd fields are hashed one by one as the structure has padding, which copies don't have to preserve.
+static ImU64 ImGui_ImplOpenGL3_HashDrawList(const ImDrawList* cmd_list, bool* out_has_callbacks)
+{
+    ImU64 hash = ImGui_ImplOpenGL3_HashBytes(cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), 0);
+    hash = ImGui_ImplOpenGL3_HashBytes(cmd_list->IdxBuffer.Data, (size_t)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx), hash);
+    for (const ImDrawCmd& cmd : cmd_list->CmdBuffer)
+    {
+        const unsigned int offsets[3] = { cmd.VtxOffset, cmd.IdxOffset, cmd.ElemCount };
+        hash = ImGui_ImplOpenGL3_HashBytes(&cmd.ClipRect, sizeof(cmd.ClipRect), hash);
+        hash = ImGui_ImplOpenGL3_HashBytes(&cmd.TextureId, sizeof(cmd.TextureId), hash);
+        hash = ImGui_ImplOpenGL3_HashBytes(offsets, sizeof(offsets), hash);
+        if (cmd.UserCallback != nullptr)
+        {
+            // Whatever a callback renders is out of our sight
+            hash = ImGui_ImplOpenGL3_HashBytes(&cmd.UserCallback, sizeof(cmd.UserCallback), hash);
+            if (cmd.UserCallback != ImDrawCallback_ResetRenderState && cmd.UserCallback != ImDrawCallback_GpuLines)
+                *out_has_callbacks = true;
+        }
+    }
+    return hash;
+}
+
+static ImGui_ImplOpenGL3_RetainedList* ImGui_ImplOpenGL3_GetRetainedList(const ImDrawList* cmd_list)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const int count = bd->RetainedLists.Size;
+    for (int i = 0; i < count; i++)
+    {
+        const int n = (bd->RetainedListsCursor + i) % count;
+        if (bd->RetainedLists.Data[n].List == cmd_list)
+        {
+            bd->RetainedListsCursor = n + 1;
+            return &bd->RetainedLists.Data[n];
+        }
+    }
+    ImGui_ImplOpenGL3_RetainedList entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.List = cmd_list;
+    entry.PendingFrame = -1;
+    bd->RetainedLists.push_back(entry);
+    bd->RetainedListsCursor = bd->RetainedLists.Size;
+    return &bd->RetainedLists.back();
+}
+
+// Fingerprint every draw list (at most once per frame) and the frame as a whole.
+static ImU64 ImGui_ImplOpenGL3_HashDrawData(ImDrawData* draw_data, bool* out_has_callbacks)
+{
+    const int frame = ImGui::GetFrameCount();
+    *out_has_callbacks = false;
+    ImU64 hash = ImGui_ImplOpenGL3_HashBytes(&draw_data->DisplayPos, sizeof(ImVec2), 0);
+    hash = ImGui_ImplOpenGL3_HashBytes(&draw_data->DisplaySize, sizeof(ImVec2), hash);
+    hash = ImGui_ImplOpenGL3_HashBytes(&draw_data->FramebufferScale, sizeof(ImVec2), hash);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        ImGui_ImplOpenGL3_RetainedList* retained = ImGui_ImplOpenGL3_GetRetainedList(draw_data->CmdLists[n]);
+        if (retained->PendingFrame != frame)
+        {
+            bool has_callbacks = false;
+            retained->PendingHash = ImGui_ImplOpenGL3_HashDrawList(draw_data->CmdLists[n], &has_callbacks);
+            retained->PendingFrame = frame;
+            retained->HasCallbacks = has_callbacks;
+        }
+        retained->LastUsedFrame = frame;
+        *out_has_callbacks |= retained->HasCallbacks;
+        hash = ImGui_ImplOpenGL3_HashBytes(&retained->PendingHash, sizeof(retained->PendingHash), hash);
+    }
+    return hash ? hash : 1; // 0 is reserved for "unknown", see ImGui_ImplOpenGL3_GetRenderedFrameHash()
+}
+
+// Bind the buffers of a retained draw list, uploading its contents only if they don't match what we have.
+static void ImGui_ImplOpenGL3_UploadRetainedList(ImGui_ImplOpenGL3_RetainedList* retained, const ImDrawList* cmd_list)
+{
+    if (retained->VboHandle == 0)
+    {
+        GL_CALL(glGenBuffers(1, &retained->VboHandle));
+        GL_CALL(glGenBuffers(1, &retained->ElementsHandle));
+    }
+    ImGui_ImplOpenGL3_BindVertexBuffers(retained->VboHandle, retained->ElementsHandle);
+    if (retained->Uploaded && retained->UploadedHash == retained->PendingHash)
+        return;
+    GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_DYNAMIC_DRAW));
+    GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_DYNAMIC_DRAW));
+    retained->UploadedHash = retained->PendingHash;
+    retained->Uploaded = true;
+}
+
+// Release buffers of draw lists which haven't been submitted for IMGUI_IMPL_OPENGL_RETAIN_FRAMES frames (e.g. closed windows), or all of them.
+static void ImGui_ImplOpenGL3_GcRetainedLists(bool release_all)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const int frame = ImGui::GetFrameCount();
+    int dst = 0;
+    for (int n = 0; n < bd->RetainedLists.Size; n++)
+    {
+        ImGui_ImplOpenGL3_RetainedList& retained = bd->RetainedLists.Data[n];
+        if (!release_all && frame - retained.LastUsedFrame <= IMGUI_IMPL_OPENGL_RETAIN_FRAMES)
+        {
+            bd->RetainedLists.Data[dst++] = retained;
+            continue;
+        }
+        if (retained.VboHandle)      { glDeleteBuffers(1, &retained.VboHandle); }
+        if (retained.ElementsHandle) { glDeleteBuffers(1, &retained.ElementsHandle); }
+    }
+    bd->RetainedLists.resize(dst);
+    bd->RetainedListsCursor = 0;
+    if (release_all)
+        ImGui_ImplOpenGL3_ClearRenderedFrameHashes();
+}
+
+bool    ImGui_ImplOpenGL3_HasDrawDataChanged(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplOpenGL3_Init()?");
+    if ((bd->Flags & ImGui_ImplOpenGL3_Flags_RetainBuffers) == 0)
+        return true;
+    bool has_callbacks;
+    const ImU64 frame_hash = ImGui_ImplOpenGL3_HashDrawData(draw_data, &has_callbacks);
+    if (has_callbacks || ImGui::GetIO().Fonts->TexDirtyRects.Size > 0)
+        return true;
+    return frame_hash != *ImGui_ImplOpenGL3_GetRenderedFrameHash(draw_data);
+}
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+// Draw a ImDrawCallback_GpuLines command: one instance per segment, reading vertices N and N+1 of the strip straight from the bound vertex buffer.
+// Lines use their own VAO, created on first use (and kept with the viewport, if any), so the attribute divisors don't leak into the main one.
+static void ImGui_ImplOpenGL3_RenderGpuLines(const ImDrawList* cmd_list, const ImDrawCmd* pcmd, int global_vtx_offset, GLuint vertex_array_object, GLuint* lines_vertex_array_object)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (pcmd->ElemCount < 2)
+        return;
+    const GLuint attribs[] = { bd->LinesAttribLocationPos0, bd->LinesAttribLocationParams, bd->LinesAttribLocationColor, bd->LinesAttribLocationPos1 };
+    if (*lines_vertex_array_object == 0)
+    {
+        GL_CALL(glGenVertexArrays(1, lines_vertex_array_object));
+        GL_CALL(glBindVertexArray(*lines_vertex_array_object));
+        for (GLuint attrib : attribs)
+        {
+            GL_CALL(glEnableVertexAttribArray(attrib));
+            GL_CALL(glVertexAttribDivisor(attrib, 1));
+        }
+    }
+    else
+    {
+        GL_CALL(glBindVertexArray(*lines_vertex_array_object));
+    }
+
+    // Indices of a ImDrawCallback_GpuLines command are consecutive: only the first one is needed to locate the strip.
+    const size_t first_vtx = (size_t)global_vtx_offset + pcmd->VtxOffset + cmd_list->IdxBuffer.Data[pcmd->IdxOffset];
+    const char* vtx_base = (const char*)(intptr_t)(first_vtx * sizeof(ImDrawVert));
+    GL_CALL(glVertexAttribPointer(bd->LinesAttribLocationPos0,   2, IMGUI_IMPL_OPENGL_VTX_POS_FORMAT,      sizeof(ImDrawVert), vtx_base + offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->LinesAttribLocationParams, 2, IMGUI_IMPL_OPENGL_LINES_PARAMS_FORMAT, sizeof(ImDrawVert), vtx_base + offsetof(ImDrawVert, uv)));
+    GL_CALL(glVertexAttribPointer(bd->LinesAttribLocationColor,  4, GL_UNSIGNED_BYTE, GL_TRUE,             sizeof(ImDrawVert), vtx_base + offsetof(ImDrawVert, col)));
+    GL_CALL(glVertexAttribPointer(bd->LinesAttribLocationPos1,   2, IMGUI_IMPL_OPENGL_VTX_POS_FORMAT,      sizeof(ImDrawVert), vtx_base + sizeof(ImDrawVert) + offsetof(ImDrawVert, pos)));
+    GL_CALL(glUseProgram(bd->LinesShaderHandle));
+    GL_CALL(glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)pcmd->ElemCount - 1));
+    GL_CALL(glUseProgram(bd->ShaderHandle));
+    GL_CALL(glBindVertexArray(vertex_array_object));
+}
+#endif
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
+// Upload regions of the font atlas which were rasterized since last upload (ImFontAtlasFlags_DynamicGlyphs).
+// When the atlas grew we reallocate storage under the same texture name, as draw commands submitted this frame already refer to it.
+static void ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (bd->FontTexture == 0 || atlas->TexDirtyRects.Size == 0)
+        return;
+
+    unsigned char* pixels;
+    int width, height, bytes_per_pixel;
+    if (bd->FontTextureFormat != GL_RGBA)
+        atlas->GetTexDataAsAlpha8(&pixels, &width, &height, &bytes_per_pixel);
+    else
+        atlas->GetTexDataAsRGBA32(&pixels, &width, &height, &bytes_per_pixel);
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->FontTexture));
+    GLint last_unpack_alignment; glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment);
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    if (width != bd->FontTextureWidth || height != bd->FontTextureHeight)
+    {
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+        GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#endif
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, bd->FontTextureInternalFormat, width, height, 0, bd->FontTextureFormat, GL_UNSIGNED_BYTE, pixels));
+        bd->FontTextureWidth = width;
+        bd->FontTextureHeight = height;
+    }
+    else
+    {
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+        GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, width));
+        for (const ImFontAtlasTexRect& r : atlas->TexDirtyRects)
+            GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, r.X, r.Y, r.Width, r.Height, bd->FontTextureFormat, GL_UNSIGNED_BYTE, pixels + ((size_t)r.X + (size_t)r.Y * width) * bytes_per_pixel));
+        GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#else
+        // Without GL_UNPACK_ROW_LENGTH we can only upload full rows
+        for (const ImFontAtlasTexRect& r : atlas->TexDirtyRects)
+            GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, r.Y, width, r.Height, bd->FontTextureFormat, GL_UNSIGNED_BYTE, pixels + (size_t)r.Y * width * bytes_per_pixel));
+#endif
+    }
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment));
+    atlas->TexDirtyRects.resize(0);
+}
+
 void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 {
     // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
@@ -481,55 +1243,72 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         return;
 
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui::DebugProfilerScopeBegin("ImGui_ImplOpenGL3_RenderDrawData"); // CPU side cost of the renderer, see Metrics->Profiler
 
-    // Backup GL state
-    GLenum last_active_texture; glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture);
-    glActiveTexture(GL_TEXTURE0);
-    GLuint last_program; glGetIntegerv(GL_CURRENT_PROGRAM, (GLint*)&last_program);
-    GLuint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&last_texture);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
-    GLuint last_sampler; if (bd->GlVersion >= 330 || bd->GlProfileIsES3) { glGetIntegerv(GL_SAMPLER_BINDING, (GLint*)&last_sampler); } else { last_sampler = 0; }
-#endif
-    GLuint last_array_buffer; glGetIntegerv(GL_ARRAY_BUFFER_BINDING, (GLint*)&last_array_buffer);
-#ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    // This is part of VAO on OpenGL 3.0+ and OpenGL ES 3.0+.
-    GLint last_element_array_buffer; glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &last_element_array_buffer);
-    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_pos; last_vtx_attrib_state_pos.GetState(bd->AttribLocationVtxPos);
-    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_uv; last_vtx_attrib_state_uv.GetState(bd->AttribLocationVtxUV);
-    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_color; last_vtx_attrib_state_color.GetState(bd->AttribLocationVtxColor);
-#endif
-#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    GLuint last_vertex_array_object; glGetIntegerv(GL_VERTEX_ARRAY_BINDING, (GLint*)&last_vertex_array_object);
-#endif
-#ifdef IMGUI_IMPL_OPENGL_HAS_POLYGON_MODE
-    GLint last_polygon_mode[2]; glGetIntegerv(GL_POLYGON_MODE, last_polygon_mode);
-#endif
-    GLint last_viewport[4]; glGetIntegerv(GL_VIEWPORT, last_viewport);
-    GLint last_scissor_box[4]; glGetIntegerv(GL_SCISSOR_BOX, last_scissor_box);
-    GLenum last_blend_src_rgb; glGetIntegerv(GL_BLEND_SRC_RGB, (GLint*)&last_blend_src_rgb);
-    GLenum last_blend_dst_rgb; glGetIntegerv(GL_BLEND_DST_RGB, (GLint*)&last_blend_dst_rgb);
-    GLenum last_blend_src_alpha; glGetIntegerv(GL_BLEND_SRC_ALPHA, (GLint*)&last_blend_src_alpha);
-    GLenum last_blend_dst_alpha; glGetIntegerv(GL_BLEND_DST_ALPHA, (GLint*)&last_blend_dst_alpha);
-    GLenum last_blend_equation_rgb; glGetIntegerv(GL_BLEND_EQUATION_RGB, (GLint*)&last_blend_equation_rgb);
-    GLenum last_blend_equation_alpha; glGetIntegerv(GL_BLEND_EQUATION_ALPHA, (GLint*)&last_blend_equation_alpha);
-    GLboolean last_enable_blend = glIsEnabled(GL_BLEND);
-    GLboolean last_enable_cull_face = glIsEnabled(GL_CULL_FACE);
-    GLboolean last_enable_depth_test = glIsEnabled(GL_DEPTH_TEST);
-    GLboolean last_enable_stencil_test = glIsEnabled(GL_STENCIL_TEST);
-    GLboolean last_enable_scissor_test = glIsEnabled(GL_SCISSOR_TEST);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
-    GLboolean last_enable_primitive_restart = (bd->GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
+    // Backup GL state, unless the application told us it doesn't rely on it
+    const bool backup_state = (bd->Flags & ImGui_ImplOpenGL3_Flags_NoStateBackup) == 0;
+    ImGui_ImplOpenGL3_StateBackup state_backup;
+    if (backup_state)
+        state_backup.Backup();
+    else
+        glActiveTexture(GL_TEXTURE0);
+    ImGui_ImplOpenGL3_UpdateFontsTexture();
+
+    // Fingerprint draw lists when retaining buffers (reusing fingerprints computed by ImGui_ImplOpenGL3_HasDrawDataChanged() this frame).
+    const bool retain_buffers = (bd->Flags & ImGui_ImplOpenGL3_Flags_RetainBuffers) != 0;
+    ImU64 frame_hash = 0;
+    bool frame_has_callbacks = false;
+    if (retain_buffers)
+        frame_hash = ImGui_ImplOpenGL3_HashDrawData(draw_data, &frame_has_callbacks);
+    else if (bd->RetainedLists.Size > 0)
+        ImGui_ImplOpenGL3_GcRetainedLists(true);
+
+    // Stream the whole frame into the persistently mapped ring when requested and supported.
+    // Failure to create the storage (e.g. out of memory) permanently falls back to the glBufferData() path.
+    int global_vtx_offset = 0;
+    int global_idx_offset = 0;
+    bd->UseBufferStorage = false;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (!retain_buffers && (bd->Flags & ImGui_ImplOpenGL3_Flags_BufferStorage) && bd->HasBufferStorage)
+    {
+        bd->UseBufferStorage = ImGui_ImplOpenGL3_UploadStreamBuffers(draw_data, &global_vtx_offset, &global_idx_offset);
+        if (!bd->UseBufferStorage)
+            bd->HasBufferStorage = false;
+    }
+    else if (bd->StreamVboHandle)
+    {
+        ImGui_ImplOpenGL3_DestroyStreamBuffers();
+    }
 #endif
 
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
+    // Viewports rendered through our platform interface are each bound to their own GL context, so they keep their VAO instead.
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
-    GLuint vertex_array_object = 0;
+    ImGui_ImplOpenGL3_ViewportData* vd = draw_data->OwnerViewport ? (ImGui_ImplOpenGL3_ViewportData*)draw_data->OwnerViewport->RendererUserData : nullptr;
+    GLuint vertex_array_object = vd ? vd->VertexArray : 0;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    GL_CALL(glGenVertexArrays(1, &vertex_array_object));
+    if (vertex_array_object == 0)
+        GL_CALL(glGenVertexArrays(1, &vertex_array_object));
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+    GLuint lines_vertex_array_object = vd ? vd->LinesVertexArray : 0;
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
+    // With all vertex/index data living in a single buffer pair, commands from every draw list can be addressed
+    // through global offsets, and runs of commands sharing texture and clip rectangle get merged into multi-draws.
+    bool single_upload = bd->UseBufferStorage;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+    if (!single_upload && !retain_buffers && (bd->Flags & ImGui_ImplOpenGL3_Flags_SingleUpload) && bd->GlVersion >= 320)
+    {
+        ImGui_ImplOpenGL3_UploadSingleBuffers(draw_data);
+        single_upload = true;
+    }
+    ImTextureID batch_tex_id = (ImTextureID)0;
+    ImVec4 batch_clip_rect;
+#endif
+
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
@@ -547,9 +1326,20 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         // - We are now back to using exclusively glBufferData(). So bd->UseBufferSubData IS ALWAYS FALSE in this code.
         //   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
         // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
+        // - With bd->UseBufferStorage or ImGui_ImplOpenGL3_Flags_SingleUpload, everything was already uploaded above.
+        // - With ImGui_ImplOpenGL3_Flags_RetainBuffers, each list has its own buffers which we only update when the list's fingerprint changed.
         const GLsizeiptr vtx_buffer_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
         const GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
-        if (bd->UseBufferSubData)
+        ImGui_ImplOpenGL3_RetainedList* retained = retain_buffers ? ImGui_ImplOpenGL3_GetRetainedList(cmd_list) : nullptr;
+        if (single_upload)
+        {
+            // Already uploaded by ImGui_ImplOpenGL3_UploadStreamBuffers() or ImGui_ImplOpenGL3_UploadSingleBuffers().
+        }
+        else if (retained != nullptr)
+        {
+            ImGui_ImplOpenGL3_UploadRetainedList(retained, cmd_list);
+        }
+        else if (bd->UseBufferSubData)
         {
             if (bd->VertexBufferSize < vtx_buffer_size)
             {
@@ -575,10 +1365,30 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
             if (pcmd->UserCallback != nullptr)
             {
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+                if (single_upload)
+                    ImGui_ImplOpenGL3_FlushBatch();
+#endif
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    if (retained != nullptr)
+                        ImGui_ImplOpenGL3_BindVertexBuffers(retained->VboHandle, retained->ElementsHandle);
+                }
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+                else if (pcmd->UserCallback == ImDrawCallback_GpuLines)
+                {
+                    // Lines expanded on the GPU (ImDrawCallback_GpuLines is only emitted when we set ImGuiBackendFlags_RendererHasGpuLines)
+                    ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+                    ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+                    if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                        continue;
+                    GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
+                    ImGui_ImplOpenGL3_RenderGpuLines(cmd_list, pcmd, global_vtx_offset, vertex_array_object, &lines_vertex_array_object);
+                }
+#endif
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -590,6 +1400,27 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
                     continue;
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+                if (single_upload)
+                {
+                    // Extend the current run, or flush it and start a new one when texture or clip rectangle change.
+                    const ImTextureID tex_id = pcmd->GetTexID();
+                    if (bd->BatchCounts.Size > 0 && (tex_id != batch_tex_id || memcmp(&pcmd->ClipRect, &batch_clip_rect, sizeof(ImVec4)) != 0))
+                        ImGui_ImplOpenGL3_FlushBatch();
+                    if (bd->BatchCounts.Size == 0)
+                    {
+                        GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
+                        GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)tex_id));
+                        batch_tex_id = tex_id;
+                        batch_clip_rect = pcmd->ClipRect;
+                    }
+                    bd->BatchCounts.push_back((GLsizei)pcmd->ElemCount);
+                    bd->BatchIndices.push_back((const void*)(intptr_t)((pcmd->IdxOffset + global_idx_offset) * sizeof(ImDrawIdx)));
+                    bd->BatchBaseVertices.push_back((GLint)(pcmd->VtxOffset + global_vtx_offset));
+                    continue;
+                }
+#endif
+
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
                 GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
 
@@ -603,58 +1434,57 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
             }
         }
+        if (single_upload)
+        {
+            global_vtx_offset += cmd_list->VtxBuffer.Size;
+            global_idx_offset += cmd_list->IdxBuffer.Size;
+        }
     }
-
-    // Destroy the temporary VAO
-#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+    if (single_upload)
+        ImGui_ImplOpenGL3_FlushBatch();
 #endif
 
-    // Restore modified GL state
-    // This "glIsProgram()" check is required because if the program is "pending deletion" at the time of binding backup, it will have been deleted by now and will cause an OpenGL error. See #6220.
-    if (last_program == 0 || glIsProgram(last_program)) glUseProgram(last_program);
-    glBindTexture(GL_TEXTURE_2D, last_texture);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
-    if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
-        glBindSampler(0, last_sampler);
-#endif
-    glActiveTexture(last_active_texture);
-#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glBindVertexArray(last_vertex_array_object);
-#endif
-    glBindBuffer(GL_ARRAY_BUFFER, last_array_buffer);
-#ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, last_element_array_buffer);
-    last_vtx_attrib_state_pos.SetState(bd->AttribLocationVtxPos);
-    last_vtx_attrib_state_uv.SetState(bd->AttribLocationVtxUV);
-    last_vtx_attrib_state_color.SetState(bd->AttribLocationVtxColor);
-#endif
-    glBlendEquationSeparate(last_blend_equation_rgb, last_blend_equation_alpha);
-    glBlendFuncSeparate(last_blend_src_rgb, last_blend_dst_rgb, last_blend_src_alpha, last_blend_dst_alpha);
-    if (last_enable_blend) glEnable(GL_BLEND); else glDisable(GL_BLEND);
-    if (last_enable_cull_face) glEnable(GL_CULL_FACE); else glDisable(GL_CULL_FACE);
-    if (last_enable_depth_test) glEnable(GL_DEPTH_TEST); else glDisable(GL_DEPTH_TEST);
-    if (last_enable_stencil_test) glEnable(GL_STENCIL_TEST); else glDisable(GL_STENCIL_TEST);
-    if (last_enable_scissor_test) glEnable(GL_SCISSOR_TEST); else glDisable(GL_SCISSOR_TEST);
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
-    if (bd->GlVersion >= 310) { if (last_enable_primitive_restart) glEnable(GL_PRIMITIVE_RESTART); else glDisable(GL_PRIMITIVE_RESTART); }
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    // Guard the region we just used: it will be waited on before being written to again, possibly from another viewport's context.
+    // GL_SYNC_FLUSH_COMMANDS_BIT in glClientWaitSync() only flushes the waiting context, so flush ours now or the fence may never signal.
+    if (bd->UseBufferStorage)
+    {
+        bd->StreamFences[bd->StreamRegion].push_back(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        glFlush();
+    }
 #endif
 
-#ifdef IMGUI_IMPL_OPENGL_HAS_POLYGON_MODE
-    // Desktop OpenGL 3.0 and OpenGL 3.1 had separate polygon draw modes for front-facing and back-facing faces of polygons
-    if (bd->GlVersion <= 310 || bd->GlProfileIsCompat)
+    // Remember what we rendered for ImGui_ImplOpenGL3_HasDrawDataChanged()
+    if (retain_buffers)
+    {
+        *ImGui_ImplOpenGL3_GetRenderedFrameHash(draw_data) = frame_has_callbacks ? 0 : frame_hash;
+        ImGui_ImplOpenGL3_GcRetainedLists(false);
+    }
+
+    // Destroy the temporary VAO, or keep them with the viewport
+    if (vd != nullptr)
     {
-        glPolygonMode(GL_FRONT, (GLenum)last_polygon_mode[0]);
-        glPolygonMode(GL_BACK, (GLenum)last_polygon_mode[1]);
+        vd->VertexArray = vertex_array_object;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+        vd->LinesVertexArray = lines_vertex_array_object;
+#endif
     }
     else
     {
-        glPolygonMode(GL_FRONT_AND_BACK, (GLenum)last_polygon_mode[0]);
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+        GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+        if (lines_vertex_array_object != 0)
+            GL_CALL(glDeleteVertexArrays(1, &lines_vertex_array_object));
+#endif
     }
-#endif // IMGUI_IMPL_OPENGL_HAS_POLYGON_MODE
 
-    glViewport(last_viewport[0], last_viewport[1], (GLsizei)last_viewport[2], (GLsizei)last_viewport[3]);
-    glScissor(last_scissor_box[0], last_scissor_box[1], (GLsizei)last_scissor_box[2], (GLsizei)last_scissor_box[3]);
+    // Restore modified GL state
+    if (backup_state)
+        state_backup.Restore();
+    ImGui::DebugProfilerScopeEnd();
     (void)bd; // Not all compilation paths use this
 }
 
@@ -664,9 +1494,25 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
     // Build texture atlas
+    // When the context supports texture swizzle we upload a single channel texture which is sampled as (1,1,1,R): this is 4x less memory/bandwidth than RGBA32.
+    // Atlases with colored content keep a RGBA32 texture: either 'io.Fonts->TexPixelsUseColors' is set (colored glyphs), or the app already called GetTexDataAsRGBA32() (e.g. to write colored pixels into custom rects).
+    if (io.Fonts->TexPixelsAlpha8 == nullptr && io.Fonts->TexPixelsRGBA32 == nullptr)
+        io.Fonts->Build();
+    bd->FontTextureInternalFormat = GL_RGBA;
+    bd->FontTextureFormat = GL_RGBA;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    if ((bd->GlVersion >= 330 || bd->GlProfileIsES3) && !(bd->Flags & ImGui_ImplOpenGL3_Flags_FontTextureRGBA32) && !io.Fonts->TexPixelsUseColors && io.Fonts->TexPixelsAlpha8 != nullptr && io.Fonts->TexPixelsRGBA32 == nullptr)
+    {
+        bd->FontTextureInternalFormat = GL_R8;
+        bd->FontTextureFormat = GL_RED;
+    }
+#endif
     unsigned char* pixels;
     int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
+    if (bd->FontTextureFormat != GL_RGBA)
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
+    else
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
 
     // Upload texture to graphics system
     // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling)
@@ -676,10 +1522,25 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->FontTexture));
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
     GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TEXTURE_SWIZZLE
+    if (bd->FontTextureFormat != GL_RGBA)
+    {
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED));
+    }
+#endif
 #ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
     GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
 #endif
-    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+    GLint last_unpack_alignment; glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment);
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, bd->FontTextureInternalFormat, width, height, 0, bd->FontTextureFormat, GL_UNSIGNED_BYTE, pixels));
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment));
+    bd->FontTextureWidth = width;
+    bd->FontTextureHeight = height;
+    io.Fonts->TexDirtyRects.resize(0);
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
@@ -702,6 +1563,201 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     }
 }
 
+// Allocate a w*h rectangle in an atlas page: reuse the shortest fitting shelf at most 25% taller than needed (or any empty one), otherwise open a new shelf.
+static bool ImGui_ImplOpenGL3_AllocAtlasRect(ImGui_ImplOpenGL3_AtlasPage* page, int w, int h, int* out_shelf, int* out_x)
+{
+    int best_shelf = -1, best_span = -1;
+    for (int shelf_n = 0; shelf_n < page->Shelves.Size; shelf_n++)
+    {
+        const ImGui_ImplOpenGL3_AtlasShelf& shelf = page->Shelves[shelf_n];
+        const bool shelf_is_empty = shelf.FreeSpans.Size == 1 && shelf.FreeSpans[0].Width == IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE;
+        if (shelf.Height < h || (shelf.Height > h + h / 4 && !shelf_is_empty))
+            continue;
+        if (best_shelf != -1 && page->Shelves[best_shelf].Height <= shelf.Height)
+            continue;
+        for (int span_n = 0; span_n < shelf.FreeSpans.Size; span_n++)
+            if (shelf.FreeSpans[span_n].Width >= w)
+            {
+                best_shelf = shelf_n;
+                best_span = span_n;
+                break;
+            }
+    }
+    if (best_shelf == -1)
+    {
+        if (page->ShelvesHeight + h > IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE)
+            return false;
+        page->Shelves.push_back(ImGui_ImplOpenGL3_AtlasShelf());
+        ImGui_ImplOpenGL3_AtlasShelf& shelf = page->Shelves.back();
+        shelf.Y = page->ShelvesHeight;
+        shelf.Height = h;
+        ImGui_ImplOpenGL3_AtlasSpan span = { 0, IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE };
+        shelf.FreeSpans.push_back(span);
+        page->ShelvesHeight += h;
+        best_shelf = page->Shelves.Size - 1;
+        best_span = 0;
+    }
+    ImGui_ImplOpenGL3_AtlasShelf& shelf = page->Shelves[best_shelf];
+    ImGui_ImplOpenGL3_AtlasSpan& span = shelf.FreeSpans[best_span];
+    *out_shelf = best_shelf;
+    *out_x = span.X;
+    span.X += w;
+    span.Width -= w;
+    if (span.Width == 0)
+        shelf.FreeSpans.erase(&span);
+    return true;
+}
+
+static void ImGui_ImplOpenGL3_FreeAtlasRect(ImGui_ImplOpenGL3_AtlasPage* page, int shelf_n, int x, int w)
+{
+    ImGui_ImplOpenGL3_AtlasShelf& shelf = page->Shelves[shelf_n];
+    int span_n = 0;
+    while (span_n < shelf.FreeSpans.Size && shelf.FreeSpans[span_n].X < x)
+        span_n++;
+    ImGui_ImplOpenGL3_AtlasSpan span = { x, w };
+    shelf.FreeSpans.insert(shelf.FreeSpans.Data + span_n, span);
+    if (span_n + 1 < shelf.FreeSpans.Size && shelf.FreeSpans[span_n].X + shelf.FreeSpans[span_n].Width == shelf.FreeSpans[span_n + 1].X)
+    {
+        shelf.FreeSpans[span_n].Width += shelf.FreeSpans[span_n + 1].Width;
+        shelf.FreeSpans.erase(shelf.FreeSpans.Data + span_n + 1);
+    }
+    if (span_n > 0 && shelf.FreeSpans[span_n - 1].X + shelf.FreeSpans[span_n - 1].Width == shelf.FreeSpans[span_n].X)
+    {
+        shelf.FreeSpans[span_n - 1].Width += shelf.FreeSpans[span_n].Width;
+        shelf.FreeSpans.erase(shelf.FreeSpans.Data + span_n);
+    }
+
+    // Give the space of trailing empty shelves back to the page
+    while (page->Shelves.Size > 0)
+    {
+        ImGui_ImplOpenGL3_AtlasShelf& last = page->Shelves.back();
+        if (last.FreeSpans.Size != 1 || last.FreeSpans[0].Width != IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE)
+            break;
+        page->ShelvesHeight = last.Y;
+        last.FreeSpans.clear();
+        page->Shelves.pop_back();
+    }
+}
+
+static void ImGui_ImplOpenGL3_DestroyAtlasPage(ImGui_ImplOpenGL3_AtlasPage* page)
+{
+    if (page->Texture)
+        glDeleteTextures(1, &page->Texture);
+    for (ImGui_ImplOpenGL3_AtlasShelf& shelf : page->Shelves)
+        shelf.FreeSpans.clear();
+    page->Shelves.clear();
+    page->Texture = 0;
+    page->ShelvesHeight = page->ImagesCount = 0;
+    page->Generation = 0;
+}
+
+bool    ImGui_ImplOpenGL3_AddAtlasImage(const void* rgba_pixels, int width, int height, ImGui_ImplOpenGL3_AtlasImage* out_image)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplOpenGL3_Init()?");
+    IM_ASSERT(rgba_pixels != nullptr && out_image != nullptr);
+    memset((void*)out_image, 0, sizeof(*out_image));
+    out_image->Page = -1;
+
+    // Reserve 1 texel of border on each side
+    const int w = width + 2;
+    const int h = height + 2;
+    if (width <= 0 || height <= 0 || w > IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE || h > IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE)
+        return false;
+
+    GLint last_texture;
+    GL_CALL(glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture));
+    int page_n, shelf_n = 0, x = 0;
+    for (page_n = 0; page_n < bd->AtlasPages.Size; page_n++)
+        if (bd->AtlasPages[page_n].Texture != 0 && ImGui_ImplOpenGL3_AllocAtlasRect(&bd->AtlasPages[page_n], w, h, &shelf_n, &x))
+            break;
+    if (page_n == bd->AtlasPages.Size)
+    {
+        // Create a new page, reusing the slot of a released one if any
+        for (page_n = 0; page_n < bd->AtlasPages.Size; page_n++)
+            if (bd->AtlasPages[page_n].Texture == 0)
+                break;
+        if (page_n == bd->AtlasPages.Size)
+            bd->AtlasPages.push_back(ImGui_ImplOpenGL3_AtlasPage());
+        ImGui_ImplOpenGL3_AtlasPage& page = bd->AtlasPages[page_n];
+        if (++g_AtlasPageGeneration == 0)
+            ++g_AtlasPageGeneration;
+        page.Generation = g_AtlasPageGeneration;
+        GL_CALL(glGenTextures(1, &page.Texture));
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, page.Texture));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE, IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+        ImGui_ImplOpenGL3_AllocAtlasRect(&page, w, h, &shelf_n, &x);
+    }
+    ImGui_ImplOpenGL3_AtlasPage& page = bd->AtlasPages[page_n];
+    const int y = page.Shelves[shelf_n].Y;
+    page.ImagesCount++;
+
+    // Copy the image surrounded by its replicated edges, and upload it in one call
+    bd->AtlasUploadBuffer.resize(w * h);
+    const ImU32* src = (const ImU32*)rgba_pixels;
+    for (int dst_y = 0; dst_y < h; dst_y++)
+    {
+        const int src_y = (dst_y == 0) ? 0 : (dst_y > height) ? height - 1 : dst_y - 1;
+        const ImU32* src_line = src + (size_t)src_y * width;
+        ImU32* dst_line = bd->AtlasUploadBuffer.Data + (size_t)dst_y * w;
+        dst_line[0] = src_line[0];
+        memcpy(dst_line + 1, src_line, (size_t)width * sizeof(ImU32));
+        dst_line[w - 1] = src_line[width - 1];
+    }
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, page.Texture));
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#endif
+    GLint last_unpack_alignment; glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment);
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+    GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, GL_RGBA, GL_UNSIGNED_BYTE, bd->AtlasUploadBuffer.Data));
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
+
+    const float scale = 1.0f / IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE;
+    out_image->TexID = (ImTextureID)(intptr_t)page.Texture;
+    out_image->Uv0 = ImVec2((x + 1) * scale, (y + 1) * scale);
+    out_image->Uv1 = ImVec2((x + 1 + width) * scale, (y + 1 + height) * scale);
+    out_image->Page = page_n;
+    out_image->Shelf = shelf_n;
+    out_image->X = x;
+    out_image->Width = w;
+    out_image->PageGeneration = page.Generation;
+
+    // The new image may reuse the space and coordinates of a removed one: draw data alone can't tell them apart.
+    ImGui_ImplOpenGL3_ClearRenderedFrameHashes();
+    return true;
+}
+
+void    ImGui_ImplOpenGL3_RemoveAtlasImage(ImGui_ImplOpenGL3_AtlasImage* image)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplOpenGL3_Init()?");
+    // Texture names alone can't identify a page: glGenTextures() often hands out the name of a released page again.
+    if (image->TexID != 0 && image->Page >= 0 && image->Page < bd->AtlasPages.Size && bd->AtlasPages[image->Page].Generation != 0 && bd->AtlasPages[image->Page].Generation == image->PageGeneration)
+    {
+        ImGui_ImplOpenGL3_AtlasPage& page = bd->AtlasPages[image->Page];
+        ImGui_ImplOpenGL3_FreeAtlasRect(&page, image->Shelf, image->X, image->Width);
+        if (--page.ImagesCount == 0)
+            ImGui_ImplOpenGL3_DestroyAtlasPage(&page);
+    }
+    memset((void*)image, 0, sizeof(*image));
+    image->Page = -1;
+}
+
+static void ImGui_ImplOpenGL3_DestroyAtlasPages()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    for (ImGui_ImplOpenGL3_AtlasPage& page : bd->AtlasPages)
+        ImGui_ImplOpenGL3_DestroyAtlasPage(&page);
+    bd->AtlasPages.clear();
+    bd->AtlasUploadBuffer.clear();
+}
+
 // If you get an error please report on github. You may try different GL context version or GLSL version. See GL<>GLSL version table at the top of this file.
 static bool CheckShader(GLuint handle, const char* desc)
 {
@@ -916,6 +1972,79 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+    // Create program for ImDrawCallback_GpuLines commands (needs instancing and gl_VertexID)
+    // Each instance is a segment, expanded into a quad by the vertex shader. The quad extends 'half_width' on each side,
+    // and alpha fades to 0 over the last 'fringe' pixels: same coverage as the triangles AddPolyline() outputs on the CPU.
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasGpuLines;
+    if ((bd->GlVersion >= 330 || bd->GlProfileIsES3) && glsl_version >= 130)
+    {
+        const GLchar* lines_vertex_shader =
+            "uniform mat4 ProjMtx;\n"
+            "in vec2 Pos0;\n"          // Segment start
+            "in vec2 Params;\n"        // Thickness (0.0: no segment), AA fringe size
+            "in vec4 Color;\n"
+            "in vec2 Pos1;\n"          // Segment end
+            "out vec4 Frag_Color;\n"
+            "out vec2 Frag_Edge;\n"    // Signed distance to center line, half width. In units of fringe size.
+            "void main()\n"
+            "{\n"
+            "    vec2 dir = Pos1 - Pos0;\n"
+            "    float len = length(dir);\n"
+            "    vec2 normal = (len > 0.0) ? vec2(dir.y, -dir.x) / len : vec2(0.0);\n"
+            "    float fringe = Params.y;\n"
+            "    float half_width = (Params.x > 0.0) ? max(fringe, (Params.x + fringe) * 0.5) : 0.0;\n"
+            "    float side = (gl_VertexID == 0 || gl_VertexID == 2) ? 1.0 : -1.0;\n"
+            "    vec2 pos = ((gl_VertexID < 2) ? Pos0 : Pos1) + normal * (side * half_width);\n"
+            "    Frag_Color = Color;\n"
+            "    Frag_Edge = vec2(side * half_width, half_width) / fringe;\n"
+            "    gl_Position = ProjMtx * vec4(pos.xy,0,1);\n"
+            "}\n";
+        const GLchar* lines_fragment_shader =
+            "in vec4 Frag_Color;\n"
+            "in vec2 Frag_Edge;\n"
+            "out vec4 Out_Color;\n"
+            "void main()\n"
+            "{\n"
+            "    float coverage = clamp(Frag_Edge.y - abs(Frag_Edge.x), 0.0, 1.0);\n"
+            "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * coverage);\n"
+            "}\n";
+        const bool is_es = (glsl_version == 300);
+        const GLchar* lines_vertex_shader_with_version[3] = { bd->GlslVersionString, is_es ? "precision highp float;\n" : "", lines_vertex_shader };
+        const GLchar* lines_fragment_shader_with_version[3] = { bd->GlslVersionString, is_es ? "precision mediump float;\n" : "", lines_fragment_shader };
+        GLuint lines_vert_handle = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(lines_vert_handle, 3, lines_vertex_shader_with_version, nullptr);
+        glCompileShader(lines_vert_handle);
+        GLuint lines_frag_handle = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(lines_frag_handle, 3, lines_fragment_shader_with_version, nullptr);
+        glCompileShader(lines_frag_handle);
+        bd->LinesShaderHandle = glCreateProgram();
+        glAttachShader(bd->LinesShaderHandle, lines_vert_handle);
+        glAttachShader(bd->LinesShaderHandle, lines_frag_handle);
+        glLinkProgram(bd->LinesShaderHandle);
+        const bool lines_ok = CheckShader(lines_vert_handle, "lines vertex shader") && CheckShader(lines_frag_handle, "lines fragment shader") && CheckProgram(bd->LinesShaderHandle, "lines shader program");
+        glDetachShader(bd->LinesShaderHandle, lines_vert_handle);
+        glDetachShader(bd->LinesShaderHandle, lines_frag_handle);
+        glDeleteShader(lines_vert_handle);
+        glDeleteShader(lines_frag_handle);
+        if (lines_ok)
+        {
+            bd->LinesAttribLocationProjMtx = glGetUniformLocation(bd->LinesShaderHandle, "ProjMtx");
+            bd->LinesAttribLocationPos0 = (GLuint)glGetAttribLocation(bd->LinesShaderHandle, "Pos0");
+            bd->LinesAttribLocationParams = (GLuint)glGetAttribLocation(bd->LinesShaderHandle, "Params");
+            bd->LinesAttribLocationColor = (GLuint)glGetAttribLocation(bd->LinesShaderHandle, "Color");
+            bd->LinesAttribLocationPos1 = (GLuint)glGetAttribLocation(bd->LinesShaderHandle, "Pos1");
+            io.BackendFlags |= ImGuiBackendFlags_RendererHasGpuLines;   // We can draw ImDrawCallback_GpuLines commands, allowing for style.AntiAliasedLinesUseGpu.
+        }
+        else
+        {
+            glDeleteProgram(bd->LinesShaderHandle);
+            bd->LinesShaderHandle = 0;
+        }
+    }
+#endif
+
     // Create buffers
     glGenBuffers(1, &bd->VboHandle);
     glGenBuffers(1, &bd->ElementsHandle);
@@ -941,9 +2070,79 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    if (bd->LinesShaderHandle) { glDeleteProgram(bd->LinesShaderHandle); bd->LinesShaderHandle = 0; ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_RendererHasGpuLines; }
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    ImGui_ImplOpenGL3_DestroyStreamBuffers();
+#endif
+    ImGui_ImplOpenGL3_GcRetainedLists(true);
+    ImGui_ImplOpenGL3_DestroyAtlasPages();
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
 
+//--------------------------------------------------------------------------------------------------------
+// MULTI-VIEWPORT / PLATFORM INTERFACE SUPPORT
+// This is an _advanced_ and _optional_ feature, allowing the backend to create and handle multiple viewports simultaneously.
+// If you are new to dear imgui or creating a new binding for dear imgui, it is recommended that you completely ignore this section first..
+//--------------------------------------------------------------------------------------------------------
+
+// Platform backends create one GL context per platform window, sharing objects with the main context: our program, buffers (including the
+// ImGui_ImplOpenGL3_Flags_BufferStorage ring) and textures are used by all viewports. Only VAO, which are not shared, are kept per viewport.
+static void ImGui_ImplOpenGL3_CreateWindow(ImGuiViewport* viewport)
+{
+    viewport->RendererUserData = IM_NEW(ImGui_ImplOpenGL3_ViewportData)();
+}
+
+static void ImGui_ImplOpenGL3_DestroyWindow(ImGuiViewport* viewport)
+{
+    if (ImGui_ImplOpenGL3_ViewportData* vd = (ImGui_ImplOpenGL3_ViewportData*)viewport->RendererUserData)
+    {
+        // VAO of secondary viewports go away with the GL context destroyed by the platform backend: we can't delete them
+        // from here as their names may designate other objects in the current context. The main viewport is only destroyed
+        // on shutdown, with the main context current.
+        if (viewport == ImGui::GetMainViewport())
+        {
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+            if (vd->VertexArray)
+                glDeleteVertexArrays(1, &vd->VertexArray);
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_INSTANCING
+            if (vd->LinesVertexArray)
+                glDeleteVertexArrays(1, &vd->LinesVertexArray);
+#endif
+        }
+        IM_DELETE(vd);
+    }
+    viewport->RendererUserData = nullptr;
+}
+
+static void ImGui_ImplOpenGL3_RenderWindow(ImGuiViewport* viewport, void*)
+{
+    if (!(viewport->Flags & ImGuiViewportFlags_NoRendererClear))
+    {
+        ImVec4 clear_color = ImVec4(0.0f, 0.0f, 0.0f, 1.0f);
+        glClearColor(clear_color.x, clear_color.y, clear_color.z, clear_color.w);
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+    ImGui_ImplOpenGL3_RenderDrawData(viewport->DrawData);
+}
+
+static void ImGui_ImplOpenGL3_InitPlatformInterface()
+{
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    platform_io.Renderer_CreateWindow = ImGui_ImplOpenGL3_CreateWindow;
+    platform_io.Renderer_DestroyWindow = ImGui_ImplOpenGL3_DestroyWindow;
+    platform_io.Renderer_RenderWindow = ImGui_ImplOpenGL3_RenderWindow;
+
+    // The main viewport is rendered by the application in the main context, which lives as long as the backend.
+    ImGuiViewport* main_viewport = ImGui::GetMainViewport();
+    main_viewport->RendererUserData = IM_NEW(ImGui_ImplOpenGL3_ViewportData)();
+}
+
+static void ImGui_ImplOpenGL3_ShutdownPlatformInterface()
+{
+    ImGui::DestroyPlatformWindows();
+}
+
 //-----------------------------------------------------------------------------
 
 #if defined(__GNUC__)
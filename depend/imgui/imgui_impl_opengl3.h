@@ -5,7 +5,14 @@
 
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Multi-viewport support (multiple windows). Enable with 'io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable'.
 //  [x] Renderer: Large meshes support (64k+ vertices) with 16-bit indices (Desktop OpenGL only).
+//  [x] Renderer: Optional streaming of vertex/index data through a persistently mapped ring buffer (Desktop OpenGL 4.4+ or GL_ARB_buffer_storage). See ImGui_ImplOpenGL3_SetFlags().
+//  [x] Renderer: Optional single upload of all draw lists per frame, with multi-draw batching of commands sharing texture and clip rectangle (Desktop OpenGL 3.2+).
+//  [x] Renderer: Incremental font atlas updates (ImGuiBackendFlags_RendererHasTexUpdates), for use with ImFontAtlasFlags_DynamicGlyphs.
+//  [x] Renderer: Single-channel GL_R8 font texture (Desktop OpenGL 3.3+, OpenGL ES 3.0+). Atlas with colored content use RGBA32.
+//  [x] Renderer: Optional retained per-draw-list buffers, only re-uploading draw lists whose contents changed, and detection of unchanged frames. See ImGui_ImplOpenGL3_HasDrawDataChanged().
+//  [x] Renderer: Optional image atlas packing many small images into shared textures, so consecutive ImGui::Image() calls merge into one draw call. See ImGui_ImplOpenGL3_AddAtlasImage().
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -41,6 +48,43 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyFontsTexture();
 IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_CreateDeviceObjects();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyDeviceObjects();
 
+// (Optional) Opt-in features. May be changed at any time after Init(). Features not supported by the current GL context are ignored.
+typedef int ImGui_ImplOpenGL3_Flags;
+enum ImGui_ImplOpenGL3_Flags_
+{
+    ImGui_ImplOpenGL3_Flags_None            = 0,
+    ImGui_ImplOpenGL3_Flags_BufferStorage   = 1 << 0,   // Stream all vertex/index data of a frame into a persistently mapped, fenced ring of IMGUI_IMPL_OPENGL_STREAM_FRAMES regions instead of calling glBufferData() for every draw list. Requires GL 4.4+ or GL_ARB_buffer_storage.
+    ImGui_ImplOpenGL3_Flags_SingleUpload    = 1 << 1,   // Upload all draw lists into one vertex/index buffer pair per frame and merge consecutive commands sharing texture and clip rectangle into glMultiDrawElementsBaseVertex() calls. Requires GL 3.2+. Implied by ImGui_ImplOpenGL3_Flags_BufferStorage.
+    ImGui_ImplOpenGL3_Flags_FontTextureRGBA32 = 1 << 2, // Always upload the font atlas as RGBA32 (legacy behavior). By default we upload a single-channel GL_R8 texture swizzled to white + alpha when the context supports texture swizzle (GL 3.3+, ES 3.0+) and the atlas has no colored content (io.Fonts->TexPixelsUseColors not set, and GetTexDataAsRGBA32() not called before the backend creates the texture). Applied when the font texture is (re)created.
+    ImGui_ImplOpenGL3_Flags_RetainBuffers   = 1 << 3,   // Keep one vertex/index buffer pair per ImDrawList and fingerprint each list (sizes + hash of vertices, indices and commands), only re-uploading lists which changed since last frame. Takes precedence over ImGui_ImplOpenGL3_Flags_BufferStorage and ImGui_ImplOpenGL3_Flags_SingleUpload. Required by ImGui_ImplOpenGL3_HasDrawDataChanged().
+    ImGui_ImplOpenGL3_Flags_NoStateBackup   = 1 << 4,   // Don't backup and restore GL state around ImGui_ImplOpenGL3_RenderDrawData(), saving ~30 glGet/glIsEnabled queries per call (and per viewport). Only use when the application owns the context(s) and sets up all the state it needs itself before drawing: we leave blending and scissor test enabled, depth/stencil test and face culling disabled, our program, VAO, buffers and textures bound and texture unit 0 active.
+};
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_SetFlags(ImGui_ImplOpenGL3_Flags flags);
+IMGUI_IMPL_API ImGui_ImplOpenGL3_Flags ImGui_ImplOpenGL3_GetFlags();
+
+// (Optional) With ImGui_ImplOpenGL3_Flags_RetainBuffers: call after ImGui::Render() to find out if the frame would render the same as the last one passed to ImGui_ImplOpenGL3_RenderDrawData().
+// When this returns false you may skip clearing, rendering and swapping entirely, or throttle your idle frame rate. Always returns true without the flag.
+// - Draw lists with user callbacks (other than ImDrawCallback_ResetRenderState) and pending font atlas uploads always count as changed.
+// - We cannot see changes in the contents of textures you display with ImGui::Image(): if you render into them, don't skip those frames.
+// - Fingerprints computed here are reused by the following ImGui_ImplOpenGL3_RenderDrawData() call.
+IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_HasDrawDataChanged(ImDrawData* draw_data);
+
+// (Optional) Image atlas: pack many small RGBA images (e.g. thumbnails of a texture browser) into shared IMGUI_IMPL_OPENGL_IMAGE_ATLAS_SIZE^2 textures ("pages").
+// Images of a same page share their ImTextureID, so consecutive ImGui::Image() calls using them merge into a single draw command, instead of one texture bind + draw call per image.
+// Display with 'ImGui::Image(image.TexID, size, image.Uv0, image.Uv1)'.
+// - Each image is surrounded by 1 texel replicating its edges, so bilinear filtering doesn't bleed neighbor images in. Images too large for a page return false: use a regular texture for them.
+// - Drawing anything using another texture (e.g. text labels using the font texture) between two images breaks the run. Submit images and labels on separate channels (ImDrawList::ChannelsSplit()) to get one draw per page.
+// - Pages are created on demand and released when their last image is removed or by ImGui_ImplOpenGL3_DestroyDeviceObjects(), which invalidates all images.
+struct ImGui_ImplOpenGL3_AtlasImage
+{
+    ImTextureID     TexID;          // Texture of the page storing the image, 0 if the image is not valid
+    ImVec2          Uv0, Uv1;       // Coordinates of the image inside the page
+    int             Page, Shelf, X, Width; // [Internal] Location of the allocated rectangle
+    unsigned int    PageGeneration; // [Internal] Identifies the page instance, as released texture names and page slots get reused
+};
+IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_AddAtlasImage(const void* rgba_pixels, int width, int height, ImGui_ImplOpenGL3_AtlasImage* out_image);
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_RemoveAtlasImage(ImGui_ImplOpenGL3_AtlasImage* image); // Free the space used by an image and clear it. Removing an invalid image does nothing.
+
 // Specific OpenGL ES versions
 //#define IMGUI_IMPL_OPENGL_ES2     // Auto-detected on Emscripten
 //#define IMGUI_IMPL_OPENGL_ES3     // Auto-detected on iOS/Android
@@ -10,6 +10,7 @@
 //  [X] Platform: Gamepad support. Enabled with 'io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad'.
 //  [X] Platform: Mouse cursor shape and visibility. Disable with 'io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange'.
 //  [X] Platform: Multi-viewport support (multiple windows). Enable with 'io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable'.
+//  [X] Platform: Idle throttling: ImGui_ImplSDL2_GetIdleTimeout() tells how long the app can block waiting for events.
 // Issues:
 //  [ ] Platform: Multi-viewport: Minimized windows seems to break mouse wheel events (at least under Windows).
 //  [ ] Platform: Multi-viewport: ParentViewportID not honored, and so io.ConfigViewportsNoDefaultParent has no effect (minor).
@@ -25,6 +26,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-14: Multi-Viewports: Skip SDL_GL_MakeCurrent() when the viewport context is already current.
+//  2026-10-14: Added ImGui_ImplSDL2_GetIdleTimeout() for event-driven main loops using SDL_WaitEventTimeout().
 //  2024-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2024-02-14: Inputs: Handle gamepad disconnection. Added ImGui_ImplSDL2_SetGamepadMode().
 //  2023-10-05: Inputs: Added support for extra ImGuiKey values: F13 to F24 function keys, app back/forward keys.
@@ -124,6 +127,7 @@ struct ImGui_ImplSDL2_Data
     char*                   ClipboardTextData;
     bool                    UseVulkan;
     bool                    WantUpdateMonitors;
+    bool                    EventsProcessed;         // ImGui_ImplSDL2_ProcessEvent() handled an event since last NewFrame()
 
     // Mouse handling
     Uint32                  MouseWindowID;
@@ -152,6 +156,7 @@ static ImGui_ImplSDL2_Data* ImGui_ImplSDL2_GetBackendData()
 }
 
 // Forward Declarations
+static bool ImGui_ImplSDL2_ProcessEventEx(ImGui_ImplSDL2_Data* bd, ImGuiIO& io, const SDL_Event* event);
 static void ImGui_ImplSDL2_UpdateMonitors();
 static void ImGui_ImplSDL2_InitPlatformInterface(SDL_Window* window, void* sdl_gl_context);
 static void ImGui_ImplSDL2_ShutdownPlatformInterface();
@@ -331,7 +336,13 @@ bool ImGui_ImplSDL2_ProcessEvent(const SDL_Event* event)
     ImGui_ImplSDL2_Data* bd = ImGui_ImplSDL2_GetBackendData();
     IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSDL2_Init()?");
     ImGuiIO& io = ImGui::GetIO();
+    const bool handled = ImGui_ImplSDL2_ProcessEventEx(bd, io, event);
+    bd->EventsProcessed |= handled;
+    return handled;
+}
 
+static bool ImGui_ImplSDL2_ProcessEventEx(ImGui_ImplSDL2_Data* bd, ImGuiIO& io, const SDL_Event* event)
+{
     switch (event->type)
     {
         case SDL_MOUSEMOTION:
@@ -892,6 +903,29 @@ void ImGui_ImplSDL2_NewFrame()
 
     // Update game controllers (if enabled and available)
     ImGui_ImplSDL2_UpdateGamepads();
+
+    bd->EventsProcessed = false;
+}
+
+int ImGui_ImplSDL2_GetIdleTimeout(int max_timeout_ms)
+{
+    ImGui_ImplSDL2_Data* bd = ImGui_ImplSDL2_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSDL2_Init()?");
+
+    // Events handled since NewFrame() (which may not translate to dear imgui input events, e.g. window resize), or a delayed mouse leave.
+    // A leave is only pending if the next NewFrame() will apply it (same condition as there). If the cursor left while a button was held,
+    // MouseLastLeaveFrame stays set but goes stale: it must not count, or we would never wait again.
+    const bool mouse_leave_pending = bd->MouseLastLeaveFrame && bd->MouseLastLeaveFrame >= ImGui::GetFrameCount() && bd->MouseButtonsDown == 0;
+    if (bd->EventsProcessed || mouse_leave_pending || bd->WantUpdateMonitors || bd->WantUpdateGamepadsList)
+        return 0;
+
+    const float wait_time = ImGui::GetIdleWaitTime();
+    if (wait_time <= 0.0f)
+        return 0;
+    if (wait_time == FLT_MAX)
+        return max_timeout_ms;
+    const int wait_ms = (int)(wait_time * 1000.0f) + 1; // Round up so we don't wake up right before the deadline
+    return (max_timeout_ms >= 0 && max_timeout_ms < wait_ms) ? max_timeout_ms : wait_ms;
 }
 
 //--------------------------------------------------------------------------------------------------------
@@ -1070,11 +1104,18 @@ static bool ImGui_ImplSDL2_GetWindowMinimized(ImGuiViewport* viewport)
     return (SDL_GetWindowFlags(vd->Window) & SDL_WINDOW_MINIMIZED) != 0;
 }
 
+// Context switches are not free: skip them when the viewport's context is already current (e.g. SwapBuffers following RenderWindow).
+static void ImGui_ImplSDL2_MakeContextCurrent(ImGui_ImplSDL2_ViewportData* vd)
+{
+    if (SDL_GL_GetCurrentContext() != vd->GLContext || SDL_GL_GetCurrentWindow() != vd->Window)
+        SDL_GL_MakeCurrent(vd->Window, vd->GLContext);
+}
+
 static void ImGui_ImplSDL2_RenderWindow(ImGuiViewport* viewport, void*)
 {
     ImGui_ImplSDL2_ViewportData* vd = (ImGui_ImplSDL2_ViewportData*)viewport->PlatformUserData;
     if (vd->GLContext)
-        SDL_GL_MakeCurrent(vd->Window, vd->GLContext);
+        ImGui_ImplSDL2_MakeContextCurrent(vd);
 }
 
 static void ImGui_ImplSDL2_SwapBuffers(ImGuiViewport* viewport, void*)
@@ -1082,7 +1123,7 @@ static void ImGui_ImplSDL2_SwapBuffers(ImGuiViewport* viewport, void*)
     ImGui_ImplSDL2_ViewportData* vd = (ImGui_ImplSDL2_ViewportData*)viewport->PlatformUserData;
     if (vd->GLContext)
     {
-        SDL_GL_MakeCurrent(vd->Window, vd->GLContext);
+        ImGui_ImplSDL2_MakeContextCurrent(vd);
         SDL_GL_SwapWindow(vd->Window);
     }
 }
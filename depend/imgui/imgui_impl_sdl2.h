@@ -9,6 +9,7 @@
 //  [X] Platform: Gamepad support. Enabled with 'io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad'.
 //  [X] Platform: Mouse cursor shape and visibility. Disable with 'io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange'.
 //  [X] Platform: Multi-viewport support (multiple windows). Enable with 'io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable'.
+//  [X] Platform: Idle throttling: ImGui_ImplSDL2_GetIdleTimeout() tells how long the app can block waiting for events.
 // Issues:
 //  [ ] Platform: Multi-viewport: Minimized windows seems to break mouse wheel events (at least under Windows).
 //  [ ] Platform: Multi-viewport: ParentViewportID not honored, and so io.ConfigViewportsNoDefaultParent has no effect (minor).
@@ -41,6 +42,15 @@ IMGUI_IMPL_API void     ImGui_ImplSDL2_Shutdown();
 IMGUI_IMPL_API void     ImGui_ImplSDL2_NewFrame();
 IMGUI_IMPL_API bool     ImGui_ImplSDL2_ProcessEvent(const SDL_Event* event);
 
+// (Optional) Event-driven main loop: call after ImGui::Render() to get how long you may block in SDL_WaitEventTimeout() before starting the next frame.
+// Returns 0 if a new frame is needed right away (events were processed since last NewFrame(), or the UI is animating), the time until the next scheduled change in milliseconds
+// (text cursor blink, tooltip delay, see ImGui::GetIdleWaitTime()), or 'max_timeout_ms' when nothing is pending (-1 = wait for the next event).
+//   int timeout = ImGui_ImplSDL2_GetIdleTimeout(); SDL_Event event;
+//   if (timeout != 0 && SDL_WaitEventTimeout(&event, timeout)) ImGui_ImplSDL2_ProcessEvent(&event);
+//   while (SDL_PollEvent(&event)) ImGui_ImplSDL2_ProcessEvent(&event);
+// Pass a 'max_timeout_ms' if your application has its own periodic work or animations.
+IMGUI_IMPL_API int      ImGui_ImplSDL2_GetIdleTimeout(int max_timeout_ms = -1);
+
 // Gamepad selection automatically starts in AutoFirst mode, picking first available SDL_Gamepad. You may override this.
 // When using manual mode, caller is responsible for opening/closing gamepad.
 enum ImGui_ImplSDL2_GamepadMode { ImGui_ImplSDL2_GamepadMode_AutoFirst, ImGui_ImplSDL2_GamepadMode_AutoAll, ImGui_ImplSDL2_GamepadMode_Manual };
@@ -61,6 +61,24 @@ Index of this file:
 #include <immintrin.h>
 #endif
 
+// Enable hardware CRC32 for ImHashData()/ImHashStr() if available
+// - ARMv8 CRC32 instructions use the same polynomial as our lookup table (identical IDs): used whenever the compiler targets them (e.g. -march=armv8-a+crc).
+// - x86 SSE4.2 only provides CRC32C (Castagnoli polynomial), which generates different IDs: opt-in with IMGUI_USE_CRC32C, see imconfig.h.
+#if defined(IMGUI_USE_CRC32C)
+#if defined(__SSE4_2__) || defined(__AVX__)
+#define IMGUI_ENABLE_SSE4_2_CRC32
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#define IMGUI_ENABLE_ARM_CRC32
+#include <arm_acle.h>
+#else
+#error "IMGUI_USE_CRC32C requires SSE4.2 or ARMv8 CRC32 instructions (e.g. -msse4.2 or -march=armv8-a+crc)."
+#endif
+#elif defined(__ARM_FEATURE_CRC32) && !defined(IMGUI_DISABLE_HW_CRC32)
+#define IMGUI_ENABLE_ARM_CRC32
+#include <arm_acle.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -142,12 +160,14 @@ struct ImGuiMenuColumns;            // Simple column measurement, currently used
 struct ImGuiNavItemData;            // Result of a gamepad/keyboard directional navigation move query result
 struct ImGuiNavTreeNodeData;        // Temporary storage for last TreeNode() being a Left arrow landing candidate.
 struct ImGuiMetricsConfig;          // Storage for ShowMetricsWindow() and DebugNodeXXX() functions
+struct ImGuiProfiler;               // Storage for DebugProfilerScopeBegin()/DebugProfilerScopeEnd() and Metrics->Profiler
 struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
 struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
 struct ImGuiPopupData;              // Storage for current popup stack
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
+struct ImGuiSettingsBinWriter;      // Helper to write binary settings records (see SaveIniSettingsToBinary())
 struct ImGuiStackSizes;             // Storage of stack sizes for debugging/asserting
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
@@ -211,7 +231,7 @@ namespace ImStb
 #undef IMSTB_TEXTEDIT_STRING
 #undef IMSTB_TEXTEDIT_CHARTYPE
 #define IMSTB_TEXTEDIT_STRING             ImGuiInputTextState
-#define IMSTB_TEXTEDIT_CHARTYPE           ImWchar
+#define IMSTB_TEXTEDIT_CHARTYPE           char
 #define IMSTB_TEXTEDIT_GETWIDTH_NEWLINE   (-1.0f)
 #define IMSTB_TEXTEDIT_UNDOSTATECOUNT     99
 #define IMSTB_TEXTEDIT_UNDOCHARCOUNT      999
@@ -389,12 +409,14 @@ IMGUI_API char*         ImStrdupcpy(char* dst, size_t* p_dst_size, const char* s
 IMGUI_API const char*   ImStrchrRange(const char* str_begin, const char* str_end, char c);  // Find first occurrence of 'c' in string range.
 IMGUI_API const char*   ImStreolRange(const char* str, const char* str_end);                // End end-of-line
 IMGUI_API const char*   ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end);  // Find a substring in a string range.
+IMGUI_API const char*   ImStristrLowered(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end); // Same as ImStristr() with a needle already lowered with ImToLower(). Vectorized with SSE.
 IMGUI_API void          ImStrTrimBlanks(char* str);                                         // Remove leading and trailing blanks from a buffer.
 IMGUI_API const char*   ImStrSkipBlank(const char* str);                                    // Find first non-blank character.
 IMGUI_API int           ImStrlenW(const ImWchar* str);                                      // Computer string length (ImWchar string)
 IMGUI_API const ImWchar*ImStrbolW(const ImWchar* buf_mid_line, const ImWchar* buf_begin);   // Find beginning-of-line (ImWchar string)
 IM_MSVC_RUNTIME_CHECKS_OFF
 static inline char      ImToUpper(char c)               { return (c >= 'a' && c <= 'z') ? c &= ~32 : c; }
+static inline char      ImToLower(char c)               { return (c >= 'A' && c <= 'Z') ? c |= 32 : c; }
 static inline bool      ImCharIsBlankA(char c)          { return c == ' ' || c == '\t'; }
 static inline bool      ImCharIsBlankW(unsigned int c)  { return c == ' ' || c == '\t' || c == 0x3000; }
 IM_MSVC_RUNTIME_CHECKS_RESTORE
@@ -431,6 +453,7 @@ static inline bool          ImFileClose(ImFileHandle)
 static inline ImU64         ImFileGetSize(ImFileHandle)                             { return (ImU64)-1; }
 static inline ImU64         ImFileRead(void*, ImU64, ImU64, ImFileHandle)           { return 0; }
 static inline ImU64         ImFileWrite(const void*, ImU64, ImU64, ImFileHandle)    { return 0; }
+static inline bool          ImFileRename(const char*, const char*)                  { return false; }
 #endif
 #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 typedef FILE* ImFileHandle;
@@ -439,6 +462,7 @@ IMGUI_API bool              ImFileClose(ImFileHandle file);
 IMGUI_API ImU64             ImFileGetSize(ImFileHandle file);
 IMGUI_API ImU64             ImFileRead(void* data, ImU64 size, ImU64 count, ImFileHandle file);
 IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 count, ImFileHandle file);
+IMGUI_API bool              ImFileRename(const char* src, const char* dst);
 #else
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
@@ -735,6 +759,34 @@ struct ImChunkStream
     void    swap(ImChunkStream<T>& rhs) { rhs.Buf.swap(Buf); }
 };
 
+// Helper: ImFrameArena
+// Double-buffered linear allocator for transient per-frame data. Use through ImGui::MemAllocFrame().
+// - Allocations are never freed individually: they stay valid until the second call to NewFrame() after them, so data built during one frame can be consumed early in the next one.
+// - Each half grows by chaining blocks. When a half is reused after needing several blocks, they are replaced by a single block of the combined size,
+//   so the arena quickly settles on its high-water mark and steady-state frames perform no MemAlloc() call.
+#define IMGUI_FRAME_ARENA_MIN_BLOCK_SIZE    (16 * 1024)
+struct ImFrameArenaBlock
+{
+    ImFrameArenaBlock*  Next;
+    size_t              Size;                               // Usable bytes after this header
+    size_t              Used;
+};
+
+struct IMGUI_API ImFrameArena
+{
+    ImFrameArenaBlock*  Blocks[2];                          // Chain of blocks for each half, most recently allocated first
+    size_t              UsedBytes[2];                       // Requested bytes since each half was last reset
+    size_t              PeakBytes;                          // Largest per-frame usage so far
+    int                 CurrIdx;                            // Half used by current frame
+
+    ImFrameArena()                                          { memset((void*)this, 0, sizeof(*this)); }
+    ~ImFrameArena()                                         { ClearFreeMemory(); }
+    void*               Alloc(size_t sz, size_t align = 16);
+    void                NewFrame();                         // Switch to other half, which was written two frames ago
+    void                ClearFreeMemory();
+    size_t              GetCapacity() const;
+};
+
 // Helper: ImGuiTextIndex
 // Maintain a line index for a text buffer. This is a strong candidate to be moved into the public API.
 struct ImGuiTextIndex
@@ -780,6 +832,14 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList::AddTextCached(): maximum number of layouts kept per draw list, and number of frames a layout can stay unused before being released.
+#ifndef IM_DRAWLIST_TEXT_LAYOUT_CACHE_MAX
+#define IM_DRAWLIST_TEXT_LAYOUT_CACHE_MAX                       512
+#endif
+#ifndef IM_DRAWLIST_TEXT_LAYOUT_MAX_AGE
+#define IM_DRAWLIST_TEXT_LAYOUT_MAX_AGE                         120
+#endif
+
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
 struct IMGUI_API ImDrawListSharedData
@@ -791,6 +851,7 @@ struct IMGUI_API ImDrawListSharedData
     float           CircleSegmentMaxError;      // Number of circle segments to use per pixel of radius for AddCircle() etc
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
+    bool            NoDynamicGlyphs;            // Never rasterize pending glyphs (ImFontAtlasFlags_DynamicGlyphs), which writes to the shared atlas: they are skipped. Set by CreateDrawListSharedData().
 
     // [Internal] Temp write buffer
     ImVector<ImVec2> TempBuffer;
@@ -1122,11 +1183,12 @@ struct IMGUI_API ImGuiInputTextState
 {
     ImGuiContext*           Ctx;                    // parent UI context (needs to be set explicitly by parent).
     ImGuiID                 ID;                     // widget id owning the text state
-    int                     CurLenW, CurLenA;       // we need to maintain our buffer length in both UTF-8 and wchar format. UTF-8 length is valid even if TextA is not.
-    ImVector<ImWchar>       TextW;                  // edit buffer, we need to persist but can't guarantee the persistence of the user-provided buffer. so we copy into own buffer.
-    ImVector<char>          TextA;                  // temporary UTF8 buffer for callbacks and other operations. this is not updated in every code-path! size=capacity.
+    int                     CurLenA;                // UTF-8 length of the text in bytes
+    ImVector<char>          TextA;                  // edit buffer (UTF-8), we need to persist but can't guarantee the persistence of the user-provided buffer. so we copy into own buffer. size=capacity.
     ImVector<char>          InitialTextA;           // value to revert to when pressing Escape = backup of end-user buffer at the time of focus (in UTF-8, unaltered)
-    bool                    TextAIsValid;           // temporary UTF8 buffer is not initially valid before we make the widget active (until then we pull the data from user argument)
+    ImVector<char>          CallbackTextBackup;     // copy of the text before a user callback, taken by the first InputTextCallbackData::InsertChars()/DeleteChars() call, to reconcile the undo stack and line index
+    const char*             TextSrc;                // == TextA.Data unless read-only, in which case == buf passed to InputText(). Only valid during the InputText() call.
+    ImVector<int>           LineStarts;             // byte offset of each line in TextSrc ([0] == 0), updated on every edit so multi-line layout/rendering doesn't need to scan the text
     int                     BufCapacityA;           // end-user buffer capacity
     float                   ScrollX;                // horizontal scrolling/offset
     ImStb::STB_TexteditState Stb;                   // state for stb_textedit.h
@@ -1134,27 +1196,29 @@ struct IMGUI_API ImGuiInputTextState
     bool                    CursorFollow;           // set when we want scrolling to follow the current cursor position (not always!)
     bool                    SelectedAllMouseLock;   // after a double-click to select all, we ignore further mouse drags to update selection
     bool                    Edited;                 // edited this frame
+    bool                    CallbackTextBackupValid; // CallbackTextBackup holds the text from before the current user callback
     ImGuiInputTextFlags     Flags;                  // copy of InputText() flags. may be used to check if e.g. ImGuiInputTextFlags_Password is set.
     bool                    ReloadUserBuf;          // force a reload of user buf so it may be modified externally. may be automatic in future version.
-    int                     ReloadSelectionStart;   // POSITIONS ARE IN IMWCHAR units *NOT* UTF-8 this is why this is not exposed yet.
+    int                     ReloadSelectionStart;   // UTF-8 byte offsets
     int                     ReloadSelectionEnd;
 
     ImGuiInputTextState()                   { memset(this, 0, sizeof(*this)); }
-    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); }
+    void        ClearText()                 { CurLenA = 0; TextA[0] = 0; TextSrc = TextA.Data; LineStarts.resize(1); LineStarts[0] = 0; CursorClamp(); }
+    void        ClearFreeMemory()           { TextA.clear(); InitialTextA.clear(); CallbackTextBackup.clear(); LineStarts.clear(); TextSrc = NULL; }
     int         GetUndoAvailCount() const   { return Stb.undostate.undo_point; }
     int         GetRedoAvailCount() const   { return IMSTB_TEXTEDIT_UNDOSTATECOUNT - Stb.undostate.redo_point; }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
+    void        OnCharPressed(unsigned int c);
 
     // Cursor & Selection
     void        CursorAnimReset()           { CursorAnim = -0.30f; }                                   // After a user-input the cursor stays on for a while without blinking
-    void        CursorClamp()               { Stb.cursor = ImMin(Stb.cursor, CurLenW); Stb.select_start = ImMin(Stb.select_start, CurLenW); Stb.select_end = ImMin(Stb.select_end, CurLenW); }
+    void        CursorClamp()               { Stb.cursor = ImMin(Stb.cursor, CurLenA); Stb.select_start = ImMin(Stb.select_start, CurLenA); Stb.select_end = ImMin(Stb.select_end, CurLenA); }
     bool        HasSelection() const        { return Stb.select_start != Stb.select_end; }
     void        ClearSelection()            { Stb.select_start = Stb.select_end = Stb.cursor; }
     int         GetCursorPos() const        { return Stb.cursor; }
     int         GetSelectionStart() const   { return Stb.select_start; }
     int         GetSelectionEnd() const     { return Stb.select_end; }
-    void        SelectAll()                 { Stb.select_start = 0; Stb.cursor = Stb.select_end = CurLenW; Stb.has_preferred_x = 0; }
+    void        SelectAll()                 { Stb.select_start = 0; Stb.cursor = Stb.select_end = CurLenA; Stb.has_preferred_x = 0; }
 
     // Reload user buf (WIP #2890)
     // If you modify underlying user-passed const char* while active you need to call this (InputText V2 may lift this)
@@ -1539,10 +1603,11 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    int                             ItemsCursor;        // Item at current cursor position (used to advance table rows when seeking variable height items)
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = ItemsCursor = 0; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -1972,11 +2037,34 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*ReadBinFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const void* data, int data_size);  // Read: Called for every binary record written by WriteBinFn (optional)
+    void        (*WriteBinFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiSettingsBinWriter* out);     // Write: Output every entries as one binary record each (optional: otherwise each entry written by WriteAllFn is stored as a text record)
     void*       UserData;
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
 };
 
+// Binary settings store, see SaveIniSettingsToBinary().
+// - A store is a sequence of segments, each made of a header followed by records. A record is one settings entry (e.g. a window or a table),
+//   identified by a key: the store can be appended with the records which changed since the previous save, later records overriding earlier ones.
+// - Handlers providing WriteBinFn/ReadBinFn store their entries in binary, others have each of their text entries stored as is.
+struct ImGuiSettingsBinWriter
+{
+    ImVector<char>      Buf;            // Output segment
+    ImGuiStorage        Hashes;         // Hash of every record of this save (written or not), by record key
+    const ImGuiStorage* PrevHashes;     // Hash of every record of the previous save, NULL when writing all records
+    ImGuiTextBuffer     TextBuf;        // Temporary text: output of WriteAllFn for handlers without WriteBinFn, zero-terminated copies of record data when reading
+    ImGuiID             TypeHash;       // Type of the records being written (0 for text records)
+    int                 RecordOffset;   // Offset of the record being written into Buf, -1 if none
+    int                 LiveSize;       // Size of all records of the last save or load: what a segment holding all of them weighs
+
+    ImGuiSettingsBinWriter()            { PrevHashes = NULL; TypeHash = 0; RecordOffset = -1; LiveSize = 0; }
+    void                Write(const void* data, size_t size) { const int off = Buf.Size; Buf.resize(off + (int)size); memcpy(Buf.Data + off, data, size); }
+    template<typename T> void WriteValue(const T& v) { Write(&v, sizeof(T)); }
+    IMGUI_API void      BeginRecord(ImGuiID id);
+    IMGUI_API void      EndRecord();
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Localization support
 //-----------------------------------------------------------------------------
@@ -2042,10 +2130,59 @@ struct ImGuiDebugAllocInfo
     int         TotalFreeCount;
     ImS16       LastEntriesIdx;             // Current index in buffer
     ImGuiDebugAllocEntry LastEntriesBuf[6]; // Track last 6 frames that had allocations
+    int         NoAllocFramesCount;         // Number of consecutive frames without any MemAlloc() call
+    int         AssertAllocAfterFrames;     // Assert in MemAlloc() once this many consecutive frames were allocation-free (steady state). 0 to disable. Toggle in Metrics->Memory allocations.
+    const void* OwnerThread;                // Thread calling NewFrame() (address of a thread-local). Only its allocations are tracked: the counters are not atomic, and worker threads (e.g. recording standalone ImDrawList) are skipped.
 
     ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
 };
 
+// Hot-path profiler: scopes are timed with a monotonic nanosecond clock, accumulated per scope name for each frame,
+// and the completed scopes of the last frame are kept for the timeline view in Metrics->Profiler.
+// A frame sample spans from one NewFrame() to the next so it includes application time, which gives the share of dear imgui in it.
+#define IMGUI_PROFILER_FRAMES           120     // Number of frames kept in history
+#define IMGUI_PROFILER_MAX_SCOPES       32      // Number of distinct scope names aggregated, extra names are only visible in the timeline
+#define IMGUI_PROFILER_MAX_EVENTS       4096    // Number of scopes recorded per frame for the timeline
+
+struct ImGuiProfilerEvent
+{
+    const char* Name;
+    ImU64       StartNs;
+    ImU64       EndNs;                      // 0 while the scope is open
+    int         Depth;                      // Nesting depth, 0 for scopes not enclosed by another scope
+};
+
+struct ImGuiProfilerFrame
+{
+    ImU64       StartNs;
+    float       DurationMs;                 // NewFrame() to next NewFrame()
+    float       TopLevelMs;                 // Sum of depth 0 scopes
+    float       ScopeTimesMs[IMGUI_PROFILER_MAX_SCOPES];
+    int         ScopeCalls[IMGUI_PROFILER_MAX_SCOPES];
+};
+
+struct ImGuiProfiler
+{
+    bool        Enabled;                    // Toggled from Metrics->Profiler, forced while HookCallback is set
+    bool        Paused;                     // Keep measuring but freeze history and timeline
+    ImGuiProfilerHookCallback HookCallback; // Set with DebugSetProfilerHook()
+    void*       HookUserData;
+    const char* ScopeNames[IMGUI_PROFILER_MAX_SCOPES];
+    int         ScopeNamesCount;
+    ImGuiProfilerFrame CurrentFrame;
+    ImGuiProfilerFrame Frames[IMGUI_PROFILER_FRAMES];
+    int         FramesIdx;                  // Next index to write in Frames[]
+    int         FramesCount;
+    ImVector<ImGuiProfilerEvent> Stack;     // Open scopes
+    ImVector<ImGuiProfilerEvent> Events;    // Completed scopes of current frame
+    ImVector<ImGuiProfilerEvent> EventsLastFrame; // Completed scopes of last frame, swapped with Events on NewFrame()
+    ImU64       EventsLastFrameStartNs;
+    float       EventsLastFrameDurationMs;
+    float       TimelineZoom;
+
+    ImGuiProfiler() { memset((void*)this, 0, sizeof(*this)); TimelineZoom = 1.0f; }
+};
+
 struct ImGuiMetricsConfig
 {
     bool        ShowDebugLog = false;
@@ -2124,6 +2261,7 @@ struct ImGuiContext
     float                   FontBaseSize;                       // (Shortcut) == IO.FontGlobalScale * Font->Scale * Font->FontSize. Base text height.
     float                   CurrentDpiScale;                    // Current window/viewport DpiScale == CurrentViewport->DpiScale
     ImDrawListSharedData    DrawListSharedData;
+    int                     DrawListSharedDataCopiesCount;      // Number of CreateDrawListSharedData() instances alive: draw lists may be recorded on other threads, see ImFontAtlas::DynamicGlyphsQueued.
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
@@ -2146,7 +2284,6 @@ struct ImGuiContext
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
-    ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
@@ -2414,6 +2551,9 @@ struct ImGuiContext
     bool                    SettingsLoaded;
     float                   SettingsDirtyTimer;                 // Save .ini Settings to memory when time reaches zero
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
+    ImGuiSettingsBinWriter  SettingsBinData;                    // In memory binary settings (last segment output by SaveIniSettingsToBinary())
+    ImGuiStorage            SettingsBinHashes;                  // Hash of every record of the binary store we're appending to, by record key
+    int                     SettingsBinStoreSize;               // Size of io.IniBinaryFilename on disk, -1 if it wasn't loaded or written yet
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
@@ -2455,6 +2595,7 @@ struct ImGuiContext
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+    ImGuiProfiler           DebugProfiler;
     ImGuiDockNode*          DebugHoveredDockNode;               // Hovered dock node.
 
     // Misc
@@ -2466,6 +2607,7 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;
     ImVector<char>          TempBuffer;                         // Temporary text buffer
+    ImFrameArena            FrameArena;                         // Transient per-frame allocations, see MemAllocFrame()
     char                    TempKeychordName[64];
 
     ImGuiContext(ImFontAtlas* shared_font_atlas)
@@ -2478,6 +2620,7 @@ struct ImGuiContext
         FontAtlasOwnedByContext = shared_font_atlas ? false : true;
         Font = NULL;
         FontSize = FontBaseSize = CurrentDpiScale = 0.0f;
+        DrawListSharedDataCopiesCount = 0;
         IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
         Time = 0.0f;
         FrameCount = 0;
@@ -2643,6 +2786,7 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsBinStoreSize = -1;
         HookIdNext = 0;
 
         memset(LocalizationTable, 0, sizeof(LocalizationTable));
@@ -2684,6 +2828,19 @@ struct ImGuiContext
     }
 };
 
+// Helper to time a scope with the profiler, e.g. IMGUI_PROFILER_SCOPE("Begin")
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+struct ImGuiProfilerScope
+{
+    bool Active;
+    ImGuiProfilerScope(const char* name) { Active = GImGui->DebugProfiler.Enabled; if (Active) ImGui::DebugProfilerScopeBegin(name); }
+    ~ImGuiProfilerScope()                { if (Active) ImGui::DebugProfilerScopeEnd(); }
+};
+#define IMGUI_PROFILER_SCOPE(_NAME)     ImGuiProfilerScope profiler_scope(_NAME)
+#else
+#define IMGUI_PROFILER_SCOPE(_NAME)     ((void)0)
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiWindowTempData, ImGuiWindow
 //-----------------------------------------------------------------------------
@@ -2839,6 +2996,7 @@ struct IMGUI_API ImGuiWindow
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImVector<ImDrawList*>   ExternalDrawLists;                  // Draw lists added with AddDrawListToWindow() this frame, rendered after DrawList. Not owned.
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup _or_ docked window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            ParentWindowInBeginStack;
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window. Doesn't cross through popups/dock nodes.
@@ -3207,6 +3365,8 @@ struct IMGUI_API ImGuiTableTempData
 
     ImVec2                      UserOuterSize;              // outer_size.x passed to BeginTable()
     ImDrawListSplitter          DrawSplitter;
+    int                         DrawChannelsUsedMax;        // Max channels count used by DrawSplitter since DrawChannelsGcTime
+    float                       DrawChannelsGcTime;         // Last time unused channels of DrawSplitter were released
 
     ImRect                      HostBackupWorkRect;         // Backup of InnerWindow->WorkRect at the end of BeginTable()
     ImRect                      HostBackupParentWorkRect;   // Backup of InnerWindow->ParentWorkRect at the end of BeginTable()
@@ -3344,6 +3504,9 @@ namespace ImGui
     IMGUI_API void                  AddSettingsHandler(const ImGuiSettingsHandler* handler);
     IMGUI_API void                  RemoveSettingsHandler(const char* type_name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
+    IMGUI_API ImGuiSettingsHandler* FindSettingsHandlerByHash(ImGuiID type_hash);
+    IMGUI_API bool                  LoadIniSettingsFromDiskBinary(const char* filename);
+    IMGUI_API void                  SaveIniSettingsToDiskBinary(const char* filename);
 
     // Settings - Windows
     IMGUI_API ImGuiWindowSettings*  CreateNewWindowSettings(const char* name);
@@ -3691,6 +3854,7 @@ namespace ImGui
     IMGUI_API void          TableRemove(ImGuiTable* table);
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTable* table);
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTableTempData* table);
+    IMGUI_API void          TableGcCompactUnusedDrawChannels(ImGuiTableTempData* table);
     IMGUI_API void          TableGcCompactSettings();
 
     // Tables: Settings
@@ -3814,12 +3978,16 @@ namespace ImGui
 
     // Plot
     IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
+    IMGUI_API int           PlotBufferEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
     IMGUI_API void          ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, bool clamp);
     IMGUI_API void          ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& pivot_in, float cos_a, float sin_a, const ImVec2& pivot_out);
 
+    // Frame arena
+    IMGUI_API void*         MemAllocFrame(size_t size);                 // Allocate from g.FrameArena: don't free, memory is valid until the second NewFrame() after this call.
+
     // Garbage collection
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
@@ -3908,6 +4076,11 @@ IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
+// Helper for dynamic font atlas (ImFontAtlasFlags_DynamicGlyphs)
+IMGUI_API void      ImFontAtlasBuildDynamicGlyph(ImFontAtlas* atlas, ImFont* font, ImFontGlyph* glyph);    // Rasterize a glyph left out by Build(), if any. Called by ImFont::RenderText() on invisible glyphs.
+IMGUI_API void      ImFontAtlasBuildDynamicNewFrame(ImFontAtlas* atlas);                                    // Grow texture to fit glyphs which didn't fit during last frame. Called by ImGui::NewFrame().
+IMGUI_API void      ImFontAtlasBuildDynamicDestroy(ImFontAtlas* atlas);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
 //-----------------------------------------------------------------------------
@@ -778,6 +778,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(table->IsLayoutLocked == false);
+    IMGUI_PROFILER_SCOPE("TableUpdateLayout");
 
     const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
     table->IsDefaultDisplayOrder = true;
@@ -2437,6 +2438,7 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
     const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
     table->DrawSplitter->Split(table->InnerWindow->DrawList, channels_total);
+    table->TempData->DrawChannelsUsedMax = ImMax(table->TempData->DrawChannelsUsedMax, channels_total);
     table->DummyDrawChannel = (ImGuiTableDrawChannelIdx)((channels_for_dummy > 0) ? channels_total - 1 : -1);
     table->Bg2DrawChannelCurrent = TABLE_DRAW_CHANNEL_BG2_FROZEN;
     table->Bg2DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)((table->FreezeRowsCount > 0) ? 2 + channels_for_row : TABLE_DRAW_CHANNEL_BG2_FROZEN);
@@ -2773,6 +2775,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
 // - TableSetColumnSortDirection() [Internal]
 // - TableSortSpecsSanitize() [Internal]
 // - TableSortSpecsBuild() [Internal]
+// - ImGuiTableSortIndex
 //-------------------------------------------------------------------------
 
 // Return NULL if no sort specs (most often when ImGuiTableFlags_Sortable is not set)
@@ -2961,6 +2964,160 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+#ifndef IMGUI_TABLE_SORT_RUN_SIZE
+#define IMGUI_TABLE_SORT_RUN_SIZE           32      // First pass sorts runs of that many items with an insertion sort
+#endif
+#define IMGUI_TABLE_SORT_MIN_ITEMS_PER_JOB  4096    // Group small blocks so ParallelFor() jobs are not too fine-grained
+
+struct ImGuiTableSortJob
+{
+    ImGuiTableSortIndex*    Index;
+    int                     Width;          // Width of input runs (1 for first pass)
+    int                     NextWidth;      // Width of output runs
+    int                     BlockFirst;
+    int                     BlocksCount;
+    int                     BlocksPerJob;
+};
+
+static void TableSortIndexProcessBlock(ImGuiTableSortIndex* index, int width, int next_width, int block_n)
+{
+    const ImGuiTableSortCompareFunc compare_func = index->CompareFunc;
+    void* user_data = index->CompareUserData;
+    const ImGuiTableSortSpecs* sort_specs = &index->Specs;
+    int* src = index->SortBuf.Data;
+    const int lo = block_n * next_width;
+    const int hi = ImMin(lo + next_width, index->SortBuf.Size);
+
+    // First pass: insertion sort in place
+    if (width == 1)
+    {
+        for (int i = lo + 1; i < hi; i++)
+        {
+            const int item = src[i];
+            int j = i;
+            for (; j > lo && compare_func(user_data, sort_specs, item, src[j - 1]) < 0; j--)
+                src[j] = src[j - 1];
+            src[j] = item;
+        }
+        return;
+    }
+
+    // Following passes: merge [lo..mid) and [mid..hi) into SortTmp. Prefer left side on equality to keep the sort stable.
+    int* dst = index->SortTmp.Data;
+    const int mid = ImMin(lo + width, hi);
+    if (mid == hi || compare_func(user_data, sort_specs, src[mid], src[mid - 1]) >= 0)
+    {
+        memcpy(dst + lo, src + lo, (size_t)(hi - lo) * sizeof(int)); // Already in order
+        return;
+    }
+    int a = lo, b = mid, out = lo;
+    while (a < mid && b < hi)
+        dst[out++] = (compare_func(user_data, sort_specs, src[b], src[a]) < 0) ? src[b++] : src[a++];
+    while (a < mid)
+        dst[out++] = src[a++];
+    while (b < hi)
+        dst[out++] = src[b++];
+}
+
+static void TableSortIndexJobFunc(void* job_data, int job_index)
+{
+    const ImGuiTableSortJob* job = (const ImGuiTableSortJob*)job_data;
+    const int block_begin = job->BlockFirst + job_index * job->BlocksPerJob;
+    const int block_end = ImMin(block_begin + job->BlocksPerJob, job->BlockFirst + job->BlocksCount);
+    for (int block_n = block_begin; block_n < block_end; block_n++)
+        TableSortIndexProcessBlock(job->Index, job->Width, job->NextWidth, block_n);
+}
+
+bool ImGuiTableSortIndex::Update(ImGuiTableSortSpecs* sort_specs, int items_count)
+{
+    IM_ASSERT(CompareFunc != NULL && items_count >= 0);
+    bool order_changed = false;
+
+    // Keep Order[] a valid permutation for the current items count. Added items are displayed last until sorted.
+    if (Order.Size != items_count)
+    {
+        if (items_count < Order.Size)
+        {
+            int dst_n = 0;
+            for (int src_n = 0; src_n < Order.Size; src_n++)
+                if (Order.Data[src_n] < items_count)
+                    Order.Data[dst_n++] = Order.Data[src_n];
+            Order.resize(dst_n);
+        }
+        for (int n = Order.Size; n < items_count; n++)
+            Order.push_back(n);
+        order_changed = WantSort = true;
+    }
+
+    // Copy sort specs: they need to outlive the current frame when sorting over several frames
+    if (sort_specs != NULL && sort_specs->SpecsDirty)
+    {
+        SpecsCopy.resize(sort_specs->SpecsCount);
+        if (sort_specs->SpecsCount > 0)
+            memcpy(SpecsCopy.Data, sort_specs->Specs, (size_t)sort_specs->SpecsCount * sizeof(ImGuiTableColumnSortSpecs));
+        sort_specs->SpecsDirty = false;
+        WantSort = true;
+    }
+
+    // (Re)start from identity so the result doesn't depend on previous orders. A sort in progress is discarded.
+    if (WantSort)
+    {
+        WantSort = false;
+        Generation++;
+        SortBuf.resize(items_count);
+        SortTmp.resize(items_count);
+        for (int n = 0; n < items_count; n++)
+            SortBuf.Data[n] = n;
+        SortWidth = (SpecsCopy.Size > 0) ? 1 : ImMax(items_count, 1); // No specs: identity is the result
+        SortBlock = 0;
+    }
+    if (SortWidth == 0)
+        return order_changed;
+    Specs.Specs = SpecsCopy.Data;
+    Specs.SpecsCount = SpecsCopy.Size;
+
+    // Process blocks of the current pass (sorting runs of SortWidth items into runs of next_width items) until done or out of budget
+    int budget = (MaxItemsPerFrame > 0) ? MaxItemsPerFrame : INT_MAX;
+    while (SortWidth < SortBuf.Size && budget > 0)
+    {
+        const int next_width = (SortWidth == 1) ? IMGUI_TABLE_SORT_RUN_SIZE : SortWidth * 2;
+        const int blocks_total = (SortBuf.Size + next_width - 1) / next_width;
+        ImGuiTableSortJob job;
+        job.Index = this;
+        job.Width = SortWidth;
+        job.NextWidth = next_width;
+        job.BlockFirst = SortBlock;
+        job.BlocksCount = ImMin(blocks_total - SortBlock, ImMax(budget / next_width, 1));
+        job.BlocksPerJob = ImMax(IMGUI_TABLE_SORT_MIN_ITEMS_PER_JOB / next_width, 1);
+        const int jobs_count = (job.BlocksCount + job.BlocksPerJob - 1) / job.BlocksPerJob;
+        if (ParallelFor != NULL && jobs_count > 1)
+            ParallelFor(ParallelForUserData, jobs_count, TableSortIndexJobFunc, &job);
+        else
+            for (int job_n = 0; job_n < jobs_count; job_n++)
+                TableSortIndexJobFunc(&job, job_n);
+
+        budget -= ImMin(job.BlocksCount * next_width, budget);
+        SortBlock += job.BlocksCount;
+        if (SortBlock == blocks_total)
+        {
+            if (SortWidth > 1)
+                SortBuf.swap(SortTmp);
+            SortWidth = next_width;
+            SortBlock = 0;
+        }
+    }
+
+    // Done: publish new order
+    if (SortWidth >= SortBuf.Size)
+    {
+        Order.swap(SortBuf);
+        SortWidth = 0;
+        OrderGeneration = Generation;
+        order_changed = true;
+    }
+    return order_changed;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -3511,6 +3668,8 @@ void ImGui::TableDrawDefaultContextMenu(ImGuiTable* table, ImGuiTableFlags flags
 // - TableSettingsHandler_ReadOpen() [Internal]
 // - TableSettingsHandler_ReadLine() [Internal]
 // - TableSettingsHandler_WriteAll() [Internal]
+// - TableSettingsHandler_ReadBin() [Internal]
+// - TableSettingsHandler_WriteBin() [Internal]
 // - TableSettingsInstallHandler() [Internal]
 //-------------------------------------------------------------------------
 // [Init] 1: TableSettingsHandler_ReadXXXX()   Load and parse .ini file into TableSettings.
@@ -3807,6 +3966,80 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
     }
 }
 
+// Binary record: ID, SaveFlags, RefScale, ColumnsCount then per column WidthOrWeight, UserID, DisplayOrder, SortOrder and packed SortDirection/IsEnabled/IsStretch.
+// Unlike the text entry, all columns are written: column data is small and fixed size.
+static const int TableSettingsBinHeaderSize = 4 + 4 + 4 + 2;
+static const int TableSettingsBinColumnSize = 4 + 4 + 2 + 2 + 1;
+
+static void TableSettingsHandler_WriteBin(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiSettingsBinWriter* out)
+{
+    ImGuiContext& g = *ctx;
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+    {
+        if (settings->ID == 0) // Skip ditched settings
+            continue;
+        if ((settings->SaveFlags & (ImGuiTableFlags_Resizable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Sortable)) == 0)
+            continue;
+
+        out->Buf.reserve(out->Buf.Size + 32 + TableSettingsBinHeaderSize + settings->ColumnsCount * TableSettingsBinColumnSize);
+        out->BeginRecord(settings->ID);
+        out->WriteValue<ImU32>(settings->ID);
+        out->WriteValue<ImS32>(settings->SaveFlags);
+        out->WriteValue<float>(settings->RefScale);
+        out->WriteValue<ImS16>(settings->ColumnsCount);
+        ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+        for (int column_n = 0; column_n < settings->ColumnsCount; column_n++, column++)
+        {
+            out->WriteValue<float>(column->WidthOrWeight);
+            out->WriteValue<ImU32>(column->UserID);
+            out->WriteValue<ImS16>(column->DisplayOrder);
+            out->WriteValue<ImS16>(column->SortOrder);
+            out->WriteValue<ImU8>((ImU8)(column->SortDirection | (column->IsEnabled << 2) | (column->IsStretch << 3)));
+        }
+        out->EndRecord();
+    }
+}
+
+static void TableSettingsHandler_ReadBin(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const void* data, int data_size)
+{
+    if (data_size < TableSettingsBinHeaderSize)
+        return;
+    const char* p = (const char*)data;
+    ImGuiID id;
+    ImS32 save_flags;
+    float ref_scale;
+    ImS16 columns_count;
+    memcpy(&id, p, 4);              p += 4;
+    memcpy(&save_flags, p, 4);      p += 4;
+    memcpy(&ref_scale, p, 4);       p += 4;
+    memcpy(&columns_count, p, 2);   p += 2;
+    if (columns_count < 0 || columns_count > IMGUI_TABLE_MAX_COLUMNS || data_size != TableSettingsBinHeaderSize + columns_count * TableSettingsBinColumnSize)
+        return;
+
+    // Recycle or create the entry like TableSettingsHandler_ReadOpen() does
+    char name[32];
+    ImFormatString(name, IM_ARRAYSIZE(name), "0x%08X,%d", id, columns_count);
+    ImGuiTableSettings* settings = (ImGuiTableSettings*)TableSettingsHandler_ReadOpen(ctx, handler, name);
+    settings->SaveFlags = save_flags;
+    settings->RefScale = ref_scale;
+    ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+    for (int column_n = 0; column_n < columns_count; column_n++, column++)
+    {
+        ImS16 display_order, sort_order;
+        memcpy(&column->WidthOrWeight, p, 4);   p += 4;
+        memcpy(&column->UserID, p, 4);          p += 4;
+        memcpy(&display_order, p, 2);           p += 2;
+        memcpy(&sort_order, p, 2);              p += 2;
+        column->Index = (ImGuiTableColumnIdx)column_n;
+        column->DisplayOrder = (ImGuiTableColumnIdx)display_order;
+        column->SortOrder = (ImGuiTableColumnIdx)sort_order;
+        column->SortDirection = (*p & 3);
+        column->IsEnabled = (*p >> 2) & 1;
+        column->IsStretch = (*p >> 3) & 1;
+        p++;
+    }
+}
+
 void ImGui::TableSettingsAddSettingsHandler()
 {
     ImGuiSettingsHandler ini_handler;
@@ -3817,6 +4050,8 @@ void ImGui::TableSettingsAddSettingsHandler()
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = TableSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = TableSettingsHandler_WriteAll;
+    ini_handler.ReadBinFn = TableSettingsHandler_ReadBin;
+    ini_handler.WriteBinFn = TableSettingsHandler_WriteBin;
     AddSettingsHandler(&ini_handler);
 }
 
@@ -3825,6 +4060,7 @@ void ImGui::TableSettingsAddSettingsHandler()
 //-------------------------------------------------------------------------
 // - TableRemove() [Internal]
 // - TableGcCompactTransientBuffers() [Internal]
+// - TableGcCompactUnusedDrawChannels() [Internal]
 // - TableGcCompactSettings() [Internal]
 //-------------------------------------------------------------------------
 
@@ -3859,9 +4095,22 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTable* table)
 void ImGui::TableGcCompactTransientBuffers(ImGuiTableTempData* temp_data)
 {
     temp_data->DrawSplitter.ClearFreeMemory();
+    temp_data->DrawChannelsUsedMax = 0;
     temp_data->LastTimeActive = -1.0f;
 }
 
+// ImGuiTableTempData are shared by all tables at a same nesting level: a wide table which is not visible anymore would keep
+// its draw channels (and their command/index buffers) alive as long as any other table is submitted at the same level.
+// Release channels which haven't been needed by any of those tables since last call.
+void ImGui::TableGcCompactUnusedDrawChannels(ImGuiTableTempData* temp_data)
+{
+    ImGuiContext& g = *GImGui;
+    if (temp_data->DrawSplitter._Count <= 1 && temp_data->DrawChannelsUsedMax > 0)
+        temp_data->DrawSplitter.ClearFreeMemoryUnusedChannels(temp_data->DrawChannelsUsedMax);
+    temp_data->DrawChannelsUsedMax = 0;
+    temp_data->DrawChannelsGcTime = (float)g.Time;
+}
+
 // Compact and remove unused settings data (currently only used by TestEngine)
 void ImGui::TableGcCompactSettings()
 {
@@ -0,0 +1,204 @@
+// dear imgui: draw list, settings and text input tests
+// Headless checks of ImDrawList output, settings storage and InputText() state (no platform or renderer backend).
+// Built and run by 'zig build test'. Prints one line per failed check and exits with a non-zero status if any failed.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static int TestFailures = 0;
+
+#define TEST_CHECK(_EXPR, ...)  do { if (!(_EXPR)) { TestFailures++; printf("FAILED %s:%d: %s: ", __FILE__, __LINE__, #_EXPR); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+static void BeginTestFrame()
+{
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin("Test", NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+}
+
+static void EndTestFrame()
+{
+    ImGui::End();
+    ImGui::Render();
+}
+
+// Vertex colors output by one text call.
+static ImVector<ImU32> CaptureTextColors(ImDrawList* draw_list, bool cached, ImU32 col, const char* text)
+{
+    const int vtx_begin = draw_list->VtxBuffer.Size;
+    if (cached)
+        draw_list->AddTextCached(0, NULL, 0.0f, ImVec2(10.0f, 10.0f), col, text);
+    else
+        draw_list->AddText(NULL, 0.0f, ImVec2(10.0f, 10.0f), col, text);
+    ImVector<ImU32> colors;
+    for (int n = vtx_begin; n < draw_list->VtxBuffer.Size; n++)
+        colors.push_back(draw_list->VtxBuffer[n].col);
+    return colors;
+}
+
+// AddTextCached() must color quads like AddText(): tinted by 'col', except colored glyphs which are drawn untinted.
+// Checked on the frame building the layout and on a later frame replaying it with a different color.
+static void TestTextCachedColoredGlyphs()
+{
+    ImFont* font = ImGui::GetIO().Fonts->Fonts[0];
+    ImFontGlyph* glyph = (ImFontGlyph*)font->FindGlyph('A');
+    glyph->Colored = 1;
+
+    const char* text = "AbA";
+    const ImU32 cols[] = { IM_COL32(255, 0, 0, 255), IM_COL32(0, 128, 255, 200) };
+    for (ImU32 col : cols)
+    {
+        BeginTestFrame();
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        ImVector<ImU32> uncached = CaptureTextColors(draw_list, false, col, text);
+        ImVector<ImU32> cached = CaptureTextColors(draw_list, true, col, text);
+        EndTestFrame();
+
+        TEST_CHECK(uncached.Size == 12, "%d vertices", uncached.Size);
+        TEST_CHECK(cached.Size == uncached.Size, "%d vs %d vertices", cached.Size, uncached.Size);
+        for (int n = 0; n < cached.Size && n < uncached.Size; n++)
+            TEST_CHECK(cached[n] == uncached[n], "col %08X, vertex %d: cached %08X, uncached %08X", col, n, cached[n], uncached[n]);
+        TEST_CHECK(uncached.Size > 0 && uncached[0] == (col | ~IM_COL32_A_MASK), "colored glyph is tinted: %08X", uncached.Size > 0 ? uncached[0] : 0);
+        TEST_CHECK(uncached.Size > 4 && uncached[4] == col, "regular glyph is not tinted: %08X", uncached.Size > 4 ? uncached[4] : 0);
+    }
+
+    glyph->Colored = 0;
+}
+
+// LoadIniSettingsFromBinary() must stop at a segment whose records don't fit it, without reading past it.
+// The buffer is allocated to the exact size so that ASan reports any overread.
+static void TestSettingsBinaryCorruptSegment()
+{
+    size_t valid_size = 0;
+    const void* valid = ImGui::SaveIniSettingsToBinary(&valid_size);
+    TEST_CHECK(valid_size >= 16, "%d bytes", (int)valid_size);
+
+    // Segment header (magic "IMGB", version 1, no flags, 5 bytes of records) followed by 5 bytes: too short for a record header.
+    const unsigned char corrupt[] = { 'I', 'M', 'G', 'B', 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 1, 2, 3, 4, 5 };
+    char* data = (char*)IM_ALLOC(valid_size + sizeof(corrupt));
+    memcpy(data, valid, valid_size);
+    memcpy(data + valid_size, corrupt, sizeof(corrupt));
+    TEST_CHECK(ImGui::LoadIniSettingsFromBinary(data, valid_size + sizeof(corrupt)), "valid segment before a corrupt one is rejected");
+    IM_FREE(data);
+
+    data = (char*)IM_ALLOC(sizeof(corrupt));
+    memcpy(data, corrupt, sizeof(corrupt));
+    TEST_CHECK(!ImGui::LoadIniSettingsFromBinary(data, sizeof(corrupt)), "corrupt segment is accepted");
+    IM_FREE(data);
+}
+
+// A segment cut short by an interrupted append hides everything after it, so the next save must rewrite the store instead of appending to it.
+static void TestSettingsBinaryAppendAfterTruncatedSegment()
+{
+    const char* filename = "imgui_test_draw_settings.bin";
+    const ImGuiID window_id = ImHashStr("Settings");
+    ImGuiContext& g = *GImGui;
+
+    BeginTestFrame();
+    ImGui::SetNextWindowPos(ImVec2(100.0f, 100.0f));
+    ImGui::Begin("Settings");
+    ImGui::End();
+    EndTestFrame();
+    ImGui::SaveIniSettingsToDiskBinary(filename);
+
+    // Append a segment header announcing more records than follow it.
+    const unsigned char truncated[] = { 'I', 'M', 'G', 'B', 1, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 1, 2, 3, 4 };
+    ImFileHandle f = ImFileOpen(filename, "ab");
+    TEST_CHECK(f != NULL, "can't open %s", filename);
+    if (f == NULL)
+        return;
+    ImFileWrite(truncated, 1, sizeof(truncated), f);
+    ImFileClose(f);
+
+    TEST_CHECK(ImGui::LoadIniSettingsFromDiskBinary(filename), "store with a truncated segment isn't loaded");
+    TEST_CHECK(g.SettingsBinStoreSize == -1, "store size %d: next save would append after the truncated segment", g.SettingsBinStoreSize);
+
+    BeginTestFrame();
+    ImGui::SetNextWindowPos(ImVec2(200.0f, 150.0f));
+    ImGui::Begin("Settings");
+    ImGui::End();
+    EndTestFrame();
+    ImGui::MarkIniSettingsDirty();
+    ImGui::SaveIniSettingsToDiskBinary(filename);
+
+    ImGui::ClearIniSettings();
+    TEST_CHECK(ImGui::LoadIniSettingsFromDiskBinary(filename), "rewritten store isn't loaded");
+    ImGuiWindowSettings* settings = ImGui::FindWindowSettingsByID(window_id);
+    TEST_CHECK(settings != NULL && settings->Pos.x == 200 && settings->Pos.y == 150, "saved position lost: %d,%d", settings ? settings->Pos.x : -1, settings ? settings->Pos.y : -1);
+    remove(filename);
+}
+
+// A callback editing through InsertChars() gets an undo record, one writing to Buf directly clears the undo stack. Both must leave the line index in sync.
+static int TestInputTextCallbackEditMode = 0; // 0: no edit, 1: InsertChars(), 2: direct write
+static int TestInputTextCallback(ImGuiInputTextCallbackData* data)
+{
+    if (TestInputTextCallbackEditMode == 1)
+        data->InsertChars(0, "x\n");
+    else if (TestInputTextCallbackEditMode == 2 && data->BufTextLen + 2 < data->BufSize)
+    {
+        memmove(data->Buf + 2, data->Buf, (size_t)data->BufTextLen + 1);
+        data->Buf[0] = 'y';
+        data->Buf[1] = '\n';
+        data->BufTextLen += 2;
+        data->BufDirty = true;
+    }
+    TestInputTextCallbackEditMode = 0;
+    return 0;
+}
+
+static void TestInputTextCallbackEdits()
+{
+    static char buf[256] = "a\nb";
+    for (int frame = 0; frame < 6; frame++)
+    {
+        TestInputTextCallbackEditMode = (frame == 2) ? 1 : (frame == 4) ? 2 : 0;
+        BeginTestFrame();
+        if (frame == 0)
+            ImGui::SetKeyboardFocusHere();
+        ImGui::InputTextMultiline("##text", buf, IM_ARRAYSIZE(buf), ImVec2(200.0f, 100.0f), ImGuiInputTextFlags_CallbackAlways, TestInputTextCallback);
+        EndTestFrame();
+
+        ImGuiInputTextState* state = &GImGui->InputTextState;
+        if (frame == 3)
+        {
+            TEST_CHECK(strcmp(buf, "x\na\nb") == 0, "text after InsertChars(): \"%s\"", buf);
+            TEST_CHECK(state->GetUndoAvailCount() == 1, "%d undo records after InsertChars()", state->GetUndoAvailCount());
+            TEST_CHECK(state->LineStarts.Size == 3 && state->LineStarts[1] == 2 && state->LineStarts[2] == 4, "line index out of sync after InsertChars()");
+        }
+        if (frame == 5)
+        {
+            TEST_CHECK(strcmp(buf, "y\nx\na\nb") == 0, "text after direct write: \"%s\"", buf);
+            TEST_CHECK(state->GetUndoAvailCount() == 0, "%d undo records after direct write", state->GetUndoAvailCount());
+            TEST_CHECK(state->LineStarts.Size == 4 && state->LineStarts[1] == 2 && state->LineStarts[3] == 6, "line index out of sync after direct write");
+        }
+    }
+    ImGui::ClearActiveID();
+}
+
+int main(int, char**)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.DisplaySize = ImVec2(800.0f, 600.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+    unsigned char* tex_pixels;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    io.Fonts->SetTexID((ImTextureID)(intptr_t)1);
+
+    TestTextCachedColoredGlyphs();
+    TestSettingsBinaryCorruptSegment();
+    TestSettingsBinaryAppendAfterTruncatedSegment();
+    TestInputTextCallbackEdits();
+
+    ImGui::DestroyContext();
+    printf("imgui_test_draw: %d failure(s)\n", TestFailures);
+    return TestFailures == 0 ? 0 : 1;
+}
@@ -125,7 +125,7 @@ static const ImU64          IM_U64_MAX = (2ULL * 9223372036854775807LL + 1);
 // For InputTextEx()
 static bool     InputTextFilterCharacter(ImGuiContext* ctx, unsigned int* p_char, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* user_data, bool input_source_is_clipboard = false);
 static int      InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end);
-static ImVec2   InputTextCalcTextSizeW(ImGuiContext* ctx, const ImWchar* text_begin, const ImWchar* text_end, const ImWchar** remaining = NULL, ImVec2* out_offset = NULL, bool stop_on_new_line = false);
+static ImVec2   InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, const char* text_end, const char** remaining = NULL, ImVec2* out_offset = NULL, bool stop_on_new_line = false);
 
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Text, etc.
@@ -3721,19 +3721,19 @@ bool ImGui::InputTextWithHint(const char* label, const char* hint, char* buf, si
 
 static int InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end)
 {
-    int line_count = 0;
+    int line_count = 1;
     const char* s = text_begin;
-    while (char c = *s++) // We are only matching for \n so we can ignore UTF-8 decoding
-        if (c == '\n')
-            line_count++;
-    s--;
-    if (s[0] != '\n' && s[0] != '\r')
+    const char* s_end = text_begin + strlen(text_begin);
+    while ((s = (const char*)memchr(s, '\n', (size_t)(s_end - s))) != NULL) // We are only matching for \n so we can ignore UTF-8 decoding
+    {
         line_count++;
-    *out_text_end = s;
+        s++;
+    }
+    *out_text_end = s_end;
     return line_count;
 }
 
-static ImVec2 InputTextCalcTextSizeW(ImGuiContext* ctx, const ImWchar* text_begin, const ImWchar* text_end, const ImWchar** remaining, ImVec2* out_offset, bool stop_on_new_line)
+static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, const char* text_end, const char** remaining, ImVec2* out_offset, bool stop_on_new_line)
 {
     ImGuiContext& g = *ctx;
     ImFont* font = g.Font;
@@ -3743,10 +3743,15 @@ static ImVec2 InputTextCalcTextSizeW(ImGuiContext* ctx, const ImWchar* text_begi
     ImVec2 text_size = ImVec2(0, 0);
     float line_width = 0.0f;
 
-    const ImWchar* s = text_begin;
+    const char* s = text_begin;
     while (s < text_end)
     {
-        unsigned int c = (unsigned int)(*s++);
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+
         if (c == '\n')
         {
             text_size.x = ImMax(text_size.x, line_width);
@@ -3778,20 +3783,77 @@ static ImVec2 InputTextCalcTextSizeW(ImGuiContext* ctx, const ImWchar* text_begi
     return text_size;
 }
 
-// Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
+// Line index: state->LineStarts[n] is the byte offset of line n in state->TextSrc. [0] is always 0, and a trailing '\n' is followed by an empty line starting at CurLenA.
+// Return the line holding byte offset 'pos' (binary search).
+static int InputTextFindLineNo(const ImVector<int>& line_starts, int pos)
+{
+    int lo = 0, hi = line_starts.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (line_starts.Data[mid] <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// Rebuild the line index from 'line_no' to the end of the text.
+static void InputTextReindexLines(ImGuiInputTextState* state, int line_no)
+{
+    ImVector<int>& line_starts = state->LineStarts;
+    line_no = ImClamp(line_no, 0, ImMax(line_starts.Size - 1, 0));
+    line_starts.resize(line_no + 1);
+    if (line_no == 0)
+        line_starts.Data[0] = 0;
+    const char* text = state->TextSrc;
+    const char* text_end = text + state->CurLenA;
+    for (const char* s = text + line_starts.Data[line_no]; (s = (const char*)memchr(s, '\n', (size_t)(text_end - s))) != NULL; )
+        line_starts.push_back((int)(++s - text));
+}
+
+// Update the line index after 'delete_len' bytes at 'pos' have been replaced with 'insert_len' bytes (already written in TextSrc).
+// Lines starting inside the deleted range are removed, lines created by the inserted text are added, and following lines are offset.
+static void InputTextReindexLinesRange(ImGuiInputTextState* state, int pos, int delete_len, int insert_len)
+{
+    ImVector<int>& line_starts = state->LineStarts;
+    const int first = InputTextFindLineNo(line_starts, pos) + 1;
+    const int last = (delete_len > 0) ? InputTextFindLineNo(line_starts, pos + delete_len) + 1 : first;
+    int new_lines_count = 0;
+    for (const char* s = state->TextSrc + pos, *s_end = s + insert_len; (s = (const char*)memchr(s, '\n', (size_t)(s_end - s))) != NULL; s++)
+        new_lines_count++;
+
+    const int old_size = line_starts.Size;
+    const int new_size = old_size + new_lines_count - (last - first);
+    if (new_size > old_size)
+        line_starts.resize(new_size);
+    if (last != first + new_lines_count)
+        memmove(line_starts.Data + first + new_lines_count, line_starts.Data + last, (size_t)(old_size - last) * sizeof(int));
+    if (new_size < old_size)
+        line_starts.resize(new_size);
+
+    int* p = line_starts.Data + first;
+    for (const char* s = state->TextSrc + pos, *s_end = s + insert_len; (s = (const char*)memchr(s, '\n', (size_t)(s_end - s))) != NULL; s++)
+        *p++ = (int)(s + 1 - state->TextSrc);
+    if (const int offset = insert_len - delete_len)
+        for (int* p_end = line_starts.Data + line_starts.Size; p < p_end; p++)
+            *p += offset;
+}
+
+// Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, UTF-8 characters. Positions are byte offsets in TextSrc)
 namespace ImStb
 {
 
-static int     STB_TEXTEDIT_STRINGLEN(const ImGuiInputTextState* obj)                             { return obj->CurLenW; }
-static ImWchar STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { IM_ASSERT(idx <= obj->CurLenW); return obj->TextW[idx]; }
-static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { ImWchar c = obj->TextW[line_start_idx + char_idx]; if (c == '\n') return IMSTB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; return g.Font->GetCharAdvance(c) * (g.FontSize / g.Font->FontSize); }
-static int     STB_TEXTEDIT_KEYTOTEXT(int key)                                                    { return key >= 0x200000 ? 0 : key; }
-static ImWchar STB_TEXTEDIT_NEWLINE = '\n';
+static int     STB_TEXTEDIT_STRINGLEN(const ImGuiInputTextState* obj)                             { return obj->CurLenA; }
+static char    STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { IM_ASSERT(idx <= obj->CurLenA); return obj->TextSrc[idx]; }
+static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { unsigned int c; ImTextCharFromUtf8(&c, obj->TextSrc + line_start_idx + char_idx, obj->TextSrc + obj->CurLenA); if ((ImWchar)c == '\n') return IMSTB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; return g.Font->GetCharAdvance((ImWchar)c) * (g.FontSize / g.Font->FontSize); }
+static char    STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* obj, int line_start_idx)
 {
-    const ImWchar* text = obj->TextW.Data;
-    const ImWchar* text_remaining = NULL;
-    const ImVec2 size = InputTextCalcTextSizeW(obj->Ctx, text + line_start_idx, text + obj->CurLenW, &text_remaining, NULL, true);
+    const char* text = obj->TextSrc;
+    const char* text_remaining = NULL;
+    const ImVec2 size = InputTextCalcTextSize(obj->Ctx, text + line_start_idx, text + obj->CurLenA, &text_remaining, NULL, true);
     r->x0 = 0.0f;
     r->x1 = size.x;
     r->baseline_y_delta = size.y;
@@ -3800,6 +3862,40 @@ static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* ob
     r->num_chars = (int)(text_remaining - (text + line_start_idx));
 }
 
+// Rows are the lines of our index (no word-wrapping) so we can seek to them instead of letting stb_textedit.h lay out every row from the top.
+// We start one row early so the row scan of stb_textedit.h settles any floating-point rounding.
+static void IMSTB_TEXTEDIT_SEEKROW_FROM_Y_IMPL(ImGuiInputTextState* obj, float y, int* out_row_start, float* out_row_y)
+{
+    const float line_height = obj->Ctx->FontSize;
+    const int line_no = (y > line_height) ? ImMin((int)(y / line_height) - 1, obj->LineStarts.Size - 1) : 0;
+    *out_row_start = obj->LineStarts[line_no];
+    *out_row_y = line_no * line_height;
+}
+static void IMSTB_TEXTEDIT_SEEKROW_FROM_CHAR_IMPL(ImGuiInputTextState* obj, int n, int* out_row_start, float* out_row_y)
+{
+    const int line_no = ImMax(InputTextFindLineNo(obj->LineStarts, n) - 1, 0);
+    *out_row_start = obj->LineStarts[line_no];
+    *out_row_y = line_no * obj->Ctx->FontSize;
+}
+static int IMSTB_TEXTEDIT_GETNEXTCHARINDEX_IMPL(ImGuiInputTextState* obj, int idx)
+{
+    if (idx >= obj->CurLenA)
+        return obj->CurLenA + 1;
+    unsigned int c;
+    return idx + ImTextCharFromUtf8(&c, obj->TextSrc + idx, obj->TextSrc + obj->CurLenA);
+}
+static int IMSTB_TEXTEDIT_GETPREVCHARINDEX_IMPL(ImGuiInputTextState* obj, int idx)
+{
+    if (idx <= 0)
+        return -1;
+    const char* p = ImTextFindPreviousUtf8Codepoint(obj->TextSrc, obj->TextSrc + idx);
+    return (int)(p - obj->TextSrc);
+}
+#define IMSTB_TEXTEDIT_SEEKROW_FROM_Y       IMSTB_TEXTEDIT_SEEKROW_FROM_Y_IMPL
+#define IMSTB_TEXTEDIT_SEEKROW_FROM_CHAR    IMSTB_TEXTEDIT_SEEKROW_FROM_CHAR_IMPL
+#define IMSTB_TEXTEDIT_GETNEXTCHARINDEX     IMSTB_TEXTEDIT_GETNEXTCHARINDEX_IMPL
+#define IMSTB_TEXTEDIT_GETPREVCHARINDEX     IMSTB_TEXTEDIT_GETPREVCHARINDEX_IMPL
+
 static bool is_separator(unsigned int c)
 {
     return c==',' || c==';' || c=='(' || c==')' || c=='{' || c=='}' || c=='[' || c==']' || c=='|' || c=='\n' || c=='\r' || c=='.' || c=='!';
@@ -3811,10 +3907,15 @@ static int is_word_boundary_from_right(ImGuiInputTextState* obj, int idx)
     if ((obj->Flags & ImGuiInputTextFlags_Password) || idx <= 0)
         return 0;
 
-    bool prev_white = ImCharIsBlankW(obj->TextW[idx - 1]);
-    bool prev_separ = is_separator(obj->TextW[idx - 1]);
-    bool curr_white = ImCharIsBlankW(obj->TextW[idx]);
-    bool curr_separ = is_separator(obj->TextW[idx]);
+    const char* curr_p = obj->TextSrc + idx;
+    const char* prev_p = ImTextFindPreviousUtf8Codepoint(obj->TextSrc, curr_p);
+    unsigned int curr_c; ImTextCharFromUtf8(&curr_c, curr_p, obj->TextSrc + obj->CurLenA);
+    unsigned int prev_c; ImTextCharFromUtf8(&prev_c, prev_p, obj->TextSrc + obj->CurLenA);
+
+    bool prev_white = ImCharIsBlankW(prev_c);
+    bool prev_separ = is_separator(prev_c);
+    bool curr_white = ImCharIsBlankW(curr_c);
+    bool curr_separ = is_separator(curr_c);
     return ((prev_white || prev_separ) && !(curr_separ || curr_white)) || (curr_separ && !prev_separ);
 }
 static int is_word_boundary_from_left(ImGuiInputTextState* obj, int idx)
@@ -3822,63 +3923,66 @@ static int is_word_boundary_from_left(ImGuiInputTextState* obj, int idx)
     if ((obj->Flags & ImGuiInputTextFlags_Password) || idx <= 0)
         return 0;
 
-    bool prev_white = ImCharIsBlankW(obj->TextW[idx]);
-    bool prev_separ = is_separator(obj->TextW[idx]);
-    bool curr_white = ImCharIsBlankW(obj->TextW[idx - 1]);
-    bool curr_separ = is_separator(obj->TextW[idx - 1]);
+    const char* curr_p = obj->TextSrc + idx;
+    const char* prev_p = ImTextFindPreviousUtf8Codepoint(obj->TextSrc, curr_p);
+    unsigned int prev_c; ImTextCharFromUtf8(&prev_c, curr_p, obj->TextSrc + obj->CurLenA);
+    unsigned int curr_c; ImTextCharFromUtf8(&curr_c, prev_p, obj->TextSrc + obj->CurLenA);
+
+    bool prev_white = ImCharIsBlankW(prev_c);
+    bool prev_separ = is_separator(prev_c);
+    bool curr_white = ImCharIsBlankW(curr_c);
+    bool curr_separ = is_separator(curr_c);
     return ((prev_white) && !(curr_separ || curr_white)) || (curr_separ && !prev_separ);
 }
-static int  STB_TEXTEDIT_MOVEWORDLEFT_IMPL(ImGuiInputTextState* obj, int idx)   { idx--; while (idx >= 0 && !is_word_boundary_from_right(obj, idx)) idx--; return idx < 0 ? 0 : idx; }
-static int  STB_TEXTEDIT_MOVEWORDRIGHT_MAC(ImGuiInputTextState* obj, int idx)   { idx++; int len = obj->CurLenW; while (idx < len && !is_word_boundary_from_left(obj, idx)) idx++; return idx > len ? len : idx; }
-static int  STB_TEXTEDIT_MOVEWORDRIGHT_WIN(ImGuiInputTextState* obj, int idx)   { idx++; int len = obj->CurLenW; while (idx < len && !is_word_boundary_from_right(obj, idx)) idx++; return idx > len ? len : idx; }
+static int  STB_TEXTEDIT_MOVEWORDLEFT_IMPL(ImGuiInputTextState* obj, int idx)   { idx = IMSTB_TEXTEDIT_GETPREVCHARINDEX(obj, idx); while (idx >= 0 && !is_word_boundary_from_right(obj, idx)) idx = IMSTB_TEXTEDIT_GETPREVCHARINDEX(obj, idx); return idx < 0 ? 0 : idx; }
+static int  STB_TEXTEDIT_MOVEWORDRIGHT_MAC(ImGuiInputTextState* obj, int idx)   { int len = obj->CurLenA; idx = IMSTB_TEXTEDIT_GETNEXTCHARINDEX(obj, idx); while (idx < len && !is_word_boundary_from_left(obj, idx)) idx = IMSTB_TEXTEDIT_GETNEXTCHARINDEX(obj, idx); return idx > len ? len : idx; }
+static int  STB_TEXTEDIT_MOVEWORDRIGHT_WIN(ImGuiInputTextState* obj, int idx)   { int len = obj->CurLenA; idx = IMSTB_TEXTEDIT_GETNEXTCHARINDEX(obj, idx); while (idx < len && !is_word_boundary_from_right(obj, idx)) idx = IMSTB_TEXTEDIT_GETNEXTCHARINDEX(obj, idx); return idx > len ? len : idx; }
 static int  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL(ImGuiInputTextState* obj, int idx)  { ImGuiContext& g = *obj->Ctx; if (g.IO.ConfigMacOSXBehaviors) return STB_TEXTEDIT_MOVEWORDRIGHT_MAC(obj, idx); else return STB_TEXTEDIT_MOVEWORDRIGHT_WIN(obj, idx); }
 #define STB_TEXTEDIT_MOVEWORDLEFT   STB_TEXTEDIT_MOVEWORDLEFT_IMPL  // They need to be #define for stb_textedit.h
 #define STB_TEXTEDIT_MOVEWORDRIGHT  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL
 
 static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 {
-    ImWchar* dst = obj->TextW.Data + pos;
+    IM_ASSERT(obj->TextSrc == obj->TextA.Data);
+    char* dst = obj->TextA.Data + pos;
 
-    // We maintain our buffer length in both UTF-8 and wchar formats
     obj->Edited = true;
-    obj->CurLenA -= ImTextCountUtf8BytesFromStr(dst, dst + n);
-    obj->CurLenW -= n;
+    obj->CurLenA -= n;
 
-    // Offset remaining text (FIXME-OPT: Use memmove)
-    const ImWchar* src = obj->TextW.Data + pos + n;
-    while (ImWchar c = *src++)
-        *dst++ = c;
-    *dst = '\0';
+    // Offset remaining text (+ copy zero terminator)
+    const char* src = obj->TextA.Data + pos + n;
+    memmove(dst, src, (size_t)(obj->CurLenA - pos + 1));
+    InputTextReindexLinesRange(obj, pos, n, 0);
 }
 
-static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ImWchar* new_text, int new_text_len)
+static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const char* new_text, int new_text_len)
 {
     const bool is_resizable = (obj->Flags & ImGuiInputTextFlags_CallbackResize) != 0;
-    const int text_len = obj->CurLenW;
+    const int text_len = obj->CurLenA;
     IM_ASSERT(pos <= text_len);
+    IM_ASSERT(obj->TextSrc == obj->TextA.Data);
 
-    const int new_text_len_utf8 = ImTextCountUtf8BytesFromStr(new_text, new_text + new_text_len);
-    if (!is_resizable && (new_text_len_utf8 + obj->CurLenA + 1 > obj->BufCapacityA))
+    if (!is_resizable && (new_text_len + obj->CurLenA + 1 > obj->BufCapacityA))
         return false;
 
     // Grow internal buffer if needed
-    if (new_text_len + text_len + 1 > obj->TextW.Size)
+    if (new_text_len + text_len + 1 > obj->TextA.Size)
     {
         if (!is_resizable)
             return false;
-        IM_ASSERT(text_len < obj->TextW.Size);
-        obj->TextW.resize(text_len + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1);
+        obj->TextA.resize(text_len + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1);
+        obj->TextSrc = obj->TextA.Data;
     }
 
-    ImWchar* text = obj->TextW.Data;
+    char* text = obj->TextA.Data;
     if (pos != text_len)
-        memmove(text + pos + new_text_len, text + pos, (size_t)(text_len - pos) * sizeof(ImWchar));
-    memcpy(text + pos, new_text, (size_t)new_text_len * sizeof(ImWchar));
+        memmove(text + pos + new_text_len, text + pos, (size_t)(text_len - pos));
+    memcpy(text + pos, new_text, (size_t)new_text_len);
 
     obj->Edited = true;
-    obj->CurLenW += new_text_len;
-    obj->CurLenA += new_text_len_utf8;
-    obj->TextW[obj->CurLenW] = '\0';
+    obj->CurLenA += new_text_len;
+    obj->TextA[obj->CurLenA] = '\0';
+    InputTextReindexLinesRange(obj, pos, 0, new_text_len);
 
     return true;
 }
@@ -3910,8 +4014,8 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const Im
 // the stb_textedit_paste() function creates two separate records, so we perform it manually. (FIXME: Report to nothings/stb?)
 static void stb_textedit_replace(ImGuiInputTextState* str, STB_TexteditState* state, const IMSTB_TEXTEDIT_CHARTYPE* text, int text_len)
 {
-    stb_text_makeundo_replace(str, state, 0, str->CurLenW, text_len);
-    ImStb::STB_TEXTEDIT_DELETECHARS(str, 0, str->CurLenW);
+    stb_text_makeundo_replace(str, state, 0, str->CurLenA, text_len);
+    ImStb::STB_TEXTEDIT_DELETECHARS(str, 0, str->CurLenA);
     state->cursor = state->select_start = state->select_end = 0;
     if (text_len <= 0)
         return;
@@ -3933,17 +4037,42 @@ void ImGuiInputTextState::OnKeyPressed(int key)
     CursorAnimReset();
 }
 
+void ImGuiInputTextState::OnCharPressed(unsigned int c)
+{
+    // Convert the key to a UTF8 byte sequence.
+    char utf8[5];
+    ImTextCharToUtf8(utf8, c);
+    stb_textedit_text(this, &Stb, utf8, (int)strlen(utf8));
+    CursorFollow = true;
+    CursorAnimReset();
+}
+
 ImGuiInputTextCallbackData::ImGuiInputTextCallbackData()
 {
     memset(this, 0, sizeof(*this));
 }
 
-// Public API to manipulate UTF-8 text
-// We expose UTF-8 to the user (unlike the STB_TEXTEDIT_* functions which are manipulating wchar)
+// Public API to manipulate UTF-8 text from a callback
+// (this is working on the same UTF-8 buffer as the STB_TEXTEDIT_* functions, the undo stack and line index are reconciled after the callback returns)
 // FIXME: The existence of this rarely exercised code path is a bit of a nuisance.
+// Called before the first change InsertChars()/DeleteChars() make to the text of the active InputText() in a callback.
+// Backing up the text only when it is about to change keeps e.g. ImGuiInputTextFlags_CallbackAlways from copying it every frame.
+static void InputTextBackupBeforeCallbackEdit(ImGuiInputTextCallbackData* data)
+{
+    if (data->Ctx == NULL)
+        return;
+    ImGuiInputTextState* state = &data->Ctx->InputTextState;
+    if (state->CallbackTextBackupValid || data->BufDirty || data->Buf != state->TextA.Data)
+        return; // Already backed up, already modified directly (too late), or not editing our own buffer
+    state->CallbackTextBackup.resize(data->BufTextLen + 1);
+    memcpy(state->CallbackTextBackup.Data, data->Buf, (size_t)data->BufTextLen + 1);
+    state->CallbackTextBackupValid = true;
+}
+
 void ImGuiInputTextCallbackData::DeleteChars(int pos, int bytes_count)
 {
     IM_ASSERT(pos + bytes_count <= BufTextLen);
+    InputTextBackupBeforeCallbackEdit(this);
     char* dst = Buf + pos;
     const char* src = Buf + pos + bytes_count;
     while (char c = *src++)
@@ -3964,6 +4093,7 @@ void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, cons
     // Accept null ranges
     if (new_text == new_text_end)
         return;
+    InputTextBackupBeforeCallbackEdit(this);
 
     const bool is_resizable = (Flags & ImGuiInputTextFlags_CallbackResize) != 0;
     const int new_text_len = new_text_end ? (int)(new_text_end - new_text) : (int)strlen(new_text);
@@ -3972,13 +4102,14 @@ void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, cons
         if (!is_resizable)
             return;
 
-        // Contrary to STB_TEXTEDIT_INSERTCHARS() this is working in the UTF8 buffer, hence the mildly similar code (until we remove the U16 buffer altogether!)
+        // Contrary to STB_TEXTEDIT_INSERTCHARS() this is not updating the line index or undo stack, hence the mildly similar code (see InputTextReconcileUndoStateAfterUserCallback())
         ImGuiContext& g = *Ctx;
         ImGuiInputTextState* edit_state = &g.InputTextState;
         IM_ASSERT(edit_state->ID != 0 && g.ActiveId == edit_state->ID);
         IM_ASSERT(Buf == edit_state->TextA.Data);
         int new_buf_size = BufTextLen + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1;
-        edit_state->TextA.reserve(new_buf_size + 1);
+        edit_state->TextA.resize(new_buf_size + 1);
+        edit_state->TextSrc = edit_state->TextA.Data;
         Buf = edit_state->TextA.Data;
         BufSize = edit_state->BufCapacityA = new_buf_size;
     }
@@ -4096,19 +4227,12 @@ static bool InputTextFilterCharacter(ImGuiContext* ctx, unsigned int* p_char, Im
     return true;
 }
 
-// Find the shortest single replacement we can make to get the new text from the old text.
-// Important: needs to be run before TextW is rewritten with the new characters because calling STB_TEXTEDIT_GETCHAR() at the end.
+// Find the shortest single replacement we can make to get the new text from the old text, and apply it to the undo stack and line index.
+// Important: needs to be run after state->TextSrc has been set to the new text, with 'old_buf' being a copy of the text before the user callback.
 // FIXME: Ideally we should transition toward (1) making InsertChars()/DeleteChars() update undo-stack (2) discourage (and keep reconcile) or obsolete (and remove reconcile) accessing buffer directly.
-static void InputTextReconcileUndoStateAfterUserCallback(ImGuiInputTextState* state, const char* new_buf_a, int new_length_a)
+static void InputTextReconcileUndoStateAfterUserCallback(ImGuiInputTextState* state, const char* old_buf, int old_length, int new_length)
 {
-    ImGuiContext& g = *GImGui;
-    const ImWchar* old_buf = state->TextW.Data;
-    const int old_length = state->CurLenW;
-    const int new_length = ImTextCountCharsFromUtf8(new_buf_a, new_buf_a + new_length_a);
-    g.TempBuffer.reserve_discard((new_length + 1) * sizeof(ImWchar));
-    ImWchar* new_buf = (ImWchar*)(void*)g.TempBuffer.Data;
-    ImTextStrFromUtf8(new_buf, new_length + 1, new_buf_a, new_buf_a + new_length_a);
-
+    const char* new_buf = state->TextSrc;
     const int shorter_length = ImMin(old_length, new_length);
     int first_diff;
     for (first_diff = 0; first_diff < shorter_length; first_diff++)
@@ -4126,9 +4250,49 @@ static void InputTextReconcileUndoStateAfterUserCallback(ImGuiInputTextState* st
     const int insert_len = new_last_diff - first_diff + 1;
     const int delete_len = old_last_diff - first_diff + 1;
     if (insert_len > 0 || delete_len > 0)
+    {
         if (IMSTB_TEXTEDIT_CHARTYPE* p = stb_text_createundo(&state->Stb.undostate, first_diff, delete_len, insert_len))
             for (int i = 0; i < delete_len; i++)
-                p[i] = ImStb::STB_TEXTEDIT_GETCHAR(state, first_diff + i);
+                p[i] = old_buf[first_diff + i];
+        InputTextReindexLinesRange(state, first_diff, delete_len, insert_len);
+    }
+}
+
+// Read-only InputText() always display the live user buffer, which may change under our feet (e.g. a log viewer appending to it).
+// We only re-index what is likely to have changed: appended text is indexed from the previous last line, other changes are caught
+// by checking the lines we are about to use (visible lines + cursor line) against the text, falling back to a full re-index.
+static void InputTextUpdateReadOnlySource(ImGuiInputTextState* state, const char* buf, int visible_line_first, int visible_line_count)
+{
+    const int buf_len = (int)strlen(buf);
+    ImVector<int>& line_starts = state->LineStarts;
+    bool reindex_all = (state->TextSrc != buf || buf_len < state->CurLenA || line_starts.Size == 0);
+    const int prev_len = state->CurLenA;
+    state->TextSrc = buf;
+    state->CurLenA = buf_len;
+    if (!reindex_all && buf_len != prev_len)
+    {
+        const int last_line_start = line_starts.back();
+        reindex_all = (last_line_start > 0 && buf[last_line_start - 1] != '\n');
+        if (!reindex_all)
+            InputTextReindexLines(state, line_starts.Size - 1);
+    }
+    if (!reindex_all)
+    {
+        const int cursor_line_no = InputTextFindLineNo(line_starts, ImMin(state->Stb.cursor, buf_len));
+        const int check_ranges[2][2] = { { visible_line_first, visible_line_first + visible_line_count }, { cursor_line_no, cursor_line_no + 1 } };
+        for (int range_n = 0; range_n < 2 && !reindex_all; range_n++)
+            for (int line_no = ImMax(check_ranges[range_n][0], 0); line_no < ImMin(check_ranges[range_n][1], line_starts.Size) && !reindex_all; line_no++)
+            {
+                const int line_start = line_starts[line_no];
+                const int line_end = (line_no + 1 < line_starts.Size) ? line_starts[line_no + 1] - 1 : buf_len;
+                if (line_end > buf_len || (line_start > 0 && buf[line_start - 1] != '\n') || (line_end < buf_len && buf[line_end] != '\n'))
+                    reindex_all = true;
+                else if (memchr(buf + line_start, '\n', (size_t)(line_end - line_start)) != NULL)
+                    reindex_all = true;
+            }
+    }
+    if (reindex_all)
+        InputTextReindexLines(state, 0);
 }
 
 // As InputText() retain textual data and we currently provide a path for user to not retain it (via local variables)
@@ -4160,8 +4324,9 @@ void ImGui::InputTextDeactivateHook(ImGuiID id)
 //   Note that in std::string world, capacity() would omit 1 byte used by the zero-terminator.
 // - When active, hold on a privately held copy of the text (and apply back to 'buf'). So changing 'buf' while the InputText is active has no effect.
 // - If you want to use ImGui::InputText() with std::string, see misc/cpp/imgui_stdlib.h
-// (FIXME: Rather confusing and messy function, among the worse part of our codebase, expecting to rewrite a V2 at some point.. Partly because we are
-//  doing UTF8 > U16 > UTF8 conversions on the go to easily interface with stb_textedit. Ideally should stay in UTF-8 all the time. See https://github.com/nothings/stb/issues/188)
+// - The text is edited in UTF-8 with positions in bytes, and a line index (ImGuiInputTextState::LineStarts) is updated on every edit, so multi-line
+//   cursor placement, scrolling and rendering scale with the number of visible lines rather than with the size of the text (e.g. large logs or scripts).
+// (FIXME: Rather confusing and messy function, among the worse part of our codebase, expecting to rewrite a V2 at some point..)
 bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
 {
     ImGuiWindow* window = GetCurrentWindow();
@@ -4293,17 +4458,16 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // Preserve cursor position and undo/redo stack if we come back to same widget
         // FIXME: Since we reworked this on 2022/06, may want to differentiate recycle_cursor vs recycle_undostate?
         bool recycle_state = (state->ID == id && !init_changed_specs && !init_reload_from_user_buf);
-        if (recycle_state && (state->CurLenA != buf_len || (state->TextAIsValid && strncmp(state->TextA.Data, buf, buf_len) != 0)))
+        if (recycle_state && (state->CurLenA != buf_len || (!is_readonly && strncmp(state->TextA.Data, buf, buf_len) != 0)))
             recycle_state = false;
 
         // Start edition
-        const char* buf_end = NULL;
         state->ID = id;
-        state->TextW.resize(buf_size + 1);          // wchar count <= UTF-8 count. we use +1 to make sure that .Data is always pointing to at least an empty string.
-        state->TextA.resize(0);
-        state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
-        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
-        state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        state->TextA.resize(ImMax(buf_size, buf_len) + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
+        memcpy(state->TextA.Data, buf, buf_len + 1);
+        state->TextSrc = state->TextA.Data;
+        state->CurLenA = buf_len;
+        InputTextReindexLines(state, 0);
 
         if (recycle_state)
         {
@@ -4382,19 +4546,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     bool validated = false;
 
     // When read-only we always use the live data passed to the function
-    // FIXME-OPT: Because our selection/cursor code currently needs the wide text we need to convert it when active, which is not ideal :(
+    if (state != NULL && !is_readonly)
+        state->TextSrc = state->TextA.Data;
     if (is_readonly && state != NULL && (render_cursor || render_selection))
     {
-        const char* buf_end = NULL;
-        state->TextW.resize(buf_size + 1);
-        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, buf, NULL, &buf_end);
-        state->CurLenA = (int)(buf_end - buf);
+        const int visible_line_first = is_multiline ? (int)(scroll_y / g.FontSize) : 0;
+        InputTextUpdateReadOnlySource(state, buf, visible_line_first, (int)(inner_size.y / g.FontSize) + 2);
         state->CursorClamp();
         render_selection &= state->HasSelection();
     }
 
     // Select the buffer to render.
-    const bool buf_display_from_state = (render_cursor || render_selection || g.ActiveId == id) && !is_readonly && state && state->TextAIsValid;
+    const bool buf_display_from_state = (render_cursor || render_selection || g.ActiveId == id) && !is_readonly && state;
     const bool is_displaying_hint = (hint != NULL && (buf_display_from_state ? state->TextA.Data : buf)[0] == 0);
 
     // Password pushes a temporary font with only a fallback glyph
@@ -4414,14 +4577,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     }
 
     // Process mouse inputs and character inputs
-    int backup_current_text_length = 0;
     if (g.ActiveId == id)
     {
         IM_ASSERT(state != NULL);
-        backup_current_text_length = state->CurLenA;
         state->Edited = false;
         state->BufCapacityA = buf_size;
         state->Flags = flags;
+        if (!is_readonly && state->TextA.Size < buf_size + 1)
+        {
+            // User buffer grew since activation (e.g. a resize callback): keep enough room for callbacks writing up to BufSize bytes
+            state->TextA.resize(buf_size + 1);
+            state->TextSrc = state->TextA.Data;
+        }
 
         // Although we are active we don't prevent mouse from hovering other elements unless we are interacting right now with the widget.
         // Down the line we should have a cleaner library-wide concept of Selected vs Active.
@@ -4499,7 +4666,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 unsigned int c = '\t'; // Insert TAB
                 if (InputTextFilterCharacter(&g, &c, flags, callback, callback_user_data))
-                    state->OnKeyPressed((int)c);
+                    state->OnCharPressed(c);
             }
             // FIXME: Implement Shift+Tab
             /*
@@ -4522,7 +4689,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     if (c == '\t') // Skip Tab, see above.
                         continue;
                     if (InputTextFilterCharacter(&g, &c, flags, callback, callback_user_data))
-                        state->OnKeyPressed((int)c);
+                        state->OnCharPressed(c);
                 }
 
             // Consume characters
@@ -4606,7 +4773,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 unsigned int c = '\n'; // Insert new line
                 if (InputTextFilterCharacter(&g, &c, flags, callback, callback_user_data))
-                    state->OnKeyPressed((int)c);
+                    state->OnCharPressed(c);
             }
         }
         else if (is_cancel)
@@ -4645,10 +4812,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             if (io.SetClipboardTextFn)
             {
                 const int ib = state->HasSelection() ? ImMin(state->Stb.select_start, state->Stb.select_end) : 0;
-                const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenW;
-                const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
-                char* clipboard_data = (char*)IM_ALLOC(clipboard_data_len * sizeof(char));
-                ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
+                const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenA;
+                char* clipboard_data = (char*)IM_ALLOC((ie - ib + 1) * sizeof(char));
+                memcpy(clipboard_data, state->TextSrc + ib, (size_t)(ie - ib));
+                clipboard_data[ie - ib] = 0;
                 SetClipboardText(clipboard_data);
                 MemFree(clipboard_data);
             }
@@ -4664,9 +4831,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             if (const char* clipboard = GetClipboardText())
             {
-                // Filter pasted buffer
+                // Filter pasted buffer (a filtered character may be re-encoded to a longer UTF-8 sequence, e.g. an invalid byte becoming U+FFFD)
                 const int clipboard_len = (int)strlen(clipboard);
-                ImWchar* clipboard_filtered = (ImWchar*)IM_ALLOC((clipboard_len + 1) * sizeof(ImWchar));
+                char* clipboard_filtered = (char*)IM_ALLOC((clipboard_len * 4 + 1) * sizeof(char));
                 int clipboard_filtered_len = 0;
                 for (const char* s = clipboard; *s != 0; )
                 {
@@ -4674,7 +4841,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     s += ImTextCharFromUtf8(&c, s, NULL);
                     if (!InputTextFilterCharacter(&g, &c, flags, callback, callback_user_data, true))
                         continue;
-                    clipboard_filtered[clipboard_filtered_len++] = (ImWchar)c;
+                    clipboard_filtered_len += (int)strlen(ImTextCharToUtf8(clipboard_filtered + clipboard_filtered_len, c));
                 }
                 clipboard_filtered[clipboard_filtered_len] = 0;
                 if (clipboard_filtered_len > 0) // If everything was filtered, ignore the pasting operation
@@ -4715,24 +4882,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 apply_new_text = state->InitialTextA.Data;
                 apply_new_text_length = state->InitialTextA.Size - 1;
                 value_changed = true;
-                ImVector<ImWchar> w_text;
-                if (apply_new_text_length > 0)
-                {
-                    w_text.resize(ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length) + 1);
-                    ImTextStrFromUtf8(w_text.Data, w_text.Size, apply_new_text, apply_new_text + apply_new_text_length);
-                }
-                stb_textedit_replace(state, &state->Stb, w_text.Data, (apply_new_text_length > 0) ? (w_text.Size - 1) : 0);
+                stb_textedit_replace(state, &state->Stb, state->InitialTextA.Data, apply_new_text_length);
             }
         }
 
-        // Apply ASCII value
-        if (!is_readonly)
-        {
-            state->TextAIsValid = true;
-            state->TextA.resize(state->TextW.Size * 4 + 1);
-            ImTextStrToUtf8(state->TextA.Data, state->TextA.Size, state->TextW.Data, NULL);
-        }
-
         // When using 'ImGuiInputTextFlags_EnterReturnsTrue' as a special case we reapply the live buffer back to the input buffer
         // before clearing ActiveId, even though strictly speaking it wasn't modified on this frame.
         // If we didn't do that, code like InputInt() with ImGuiInputTextFlags_EnterReturnsTrue would fail.
@@ -4794,11 +4947,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     callback_data.BufSize = state->BufCapacityA;
                     callback_data.BufDirty = false;
 
-                    // We have to convert from wchar-positions to UTF-8-positions, which can be pretty slow (an incentive to ditch the ImWchar buffer, see https://github.com/nothings/stb/issues/188)
-                    ImWchar* text = state->TextW.Data;
-                    const int utf8_cursor_pos = callback_data.CursorPos = ImTextCountUtf8BytesFromStr(text, text + state->Stb.cursor);
-                    const int utf8_selection_start = callback_data.SelectionStart = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_start);
-                    const int utf8_selection_end = callback_data.SelectionEnd = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_end);
+                    const int utf8_cursor_pos = callback_data.CursorPos = state->Stb.cursor;
+                    const int utf8_selection_start = callback_data.SelectionStart = state->Stb.select_start;
+                    const int utf8_selection_end = callback_data.SelectionEnd = state->Stb.select_end;
+
+                    // InsertChars()/DeleteChars() back up the text before changing it, so we can reconcile the undo stack and line index
+                    state->CallbackTextBackupValid = false;
 
                     // Call user code
                     callback(&callback_data);
@@ -4809,18 +4963,29 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     IM_ASSERT(callback_data.BufSize == state->BufCapacityA);
                     IM_ASSERT(callback_data.Flags == flags);
                     const bool buf_dirty = callback_data.BufDirty;
-                    if (callback_data.CursorPos != utf8_cursor_pos || buf_dirty)            { state->Stb.cursor = ImTextCountCharsFromUtf8(callback_data.Buf, callback_data.Buf + callback_data.CursorPos); state->CursorFollow = true; }
-                    if (callback_data.SelectionStart != utf8_selection_start || buf_dirty)  { state->Stb.select_start = (callback_data.SelectionStart == callback_data.CursorPos) ? state->Stb.cursor : ImTextCountCharsFromUtf8(callback_data.Buf, callback_data.Buf + callback_data.SelectionStart); }
-                    if (callback_data.SelectionEnd != utf8_selection_end || buf_dirty)      { state->Stb.select_end = (callback_data.SelectionEnd == callback_data.SelectionStart) ? state->Stb.select_start : ImTextCountCharsFromUtf8(callback_data.Buf, callback_data.Buf + callback_data.SelectionEnd); }
+                    if (callback_data.CursorPos != utf8_cursor_pos || buf_dirty)            { state->Stb.cursor = callback_data.CursorPos; state->CursorFollow = true; }
+                    if (callback_data.SelectionStart != utf8_selection_start || buf_dirty)  { state->Stb.select_start = (callback_data.SelectionStart == callback_data.CursorPos) ? state->Stb.cursor : callback_data.SelectionStart; }
+                    if (callback_data.SelectionEnd != utf8_selection_end || buf_dirty)      { state->Stb.select_end = (callback_data.SelectionEnd == callback_data.SelectionStart) ? state->Stb.select_start : callback_data.SelectionEnd; }
                     if (buf_dirty)
                     {
                         IM_ASSERT(!is_readonly);
                         IM_ASSERT(callback_data.BufTextLen == (int)strlen(callback_data.Buf)); // You need to maintain BufTextLen if you change the text!
-                        InputTextReconcileUndoStateAfterUserCallback(state, callback_data.Buf, callback_data.BufTextLen); // FIXME: Move the rest of this block inside function and rename to InputTextReconcileStateAfterUserCallback() ?
-                        if (callback_data.BufTextLen > backup_current_text_length && is_resizable)
-                            state->TextW.resize(state->TextW.Size + (callback_data.BufTextLen - backup_current_text_length)); // Worse case scenario resize
-                        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, callback_data.Buf, NULL);
-                        state->CurLenA = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        state->TextSrc = state->TextA.Data;
+                        if (state->CallbackTextBackupValid)
+                        {
+                            InputTextReconcileUndoStateAfterUserCallback(state, state->CallbackTextBackup.Data, state->CallbackTextBackup.Size - 1, callback_data.BufTextLen); // FIXME: Move the rest of this block inside function and rename to InputTextReconcileStateAfterUserCallback() ?
+                            state->CurLenA = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        }
+                        else
+                        {
+                            // Buf was written directly: the previous text is unknown, so the undo stack can't be kept
+                            state->CurLenA = callback_data.BufTextLen;
+                            state->Stb.undostate.undo_point = state->Stb.undostate.undo_char_point = 0;
+                            state->Stb.undostate.redo_point = IMSTB_TEXTEDIT_UNDOSTATECOUNT;
+                            state->Stb.undostate.redo_char_point = IMSTB_TEXTEDIT_UNDOCHARCOUNT;
+                            InputTextReindexLines(state, 0);
+                        }
+                        state->CallbackTextBackupValid = false;
                         state->CursorAnimReset();
                     }
                 }
@@ -4852,7 +5017,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     // Copy result to user buffer. This can currently only happen when (g.ActiveId == id)
     if (apply_new_text != NULL)
     {
-        // We cannot test for 'backup_current_text_length != apply_new_text_length' here because we have no guarantee that the size
+        // We cannot test for 'state->CurLenA != apply_new_text_length' here because we have no guarantee that the size
         // of our owned buffer matches the size of the string object held by the user, and by design we allow InputText() to be used
         // without any storage on user's side.
         IM_ASSERT(apply_new_text_length >= 0);
@@ -4921,59 +5086,32 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // - Display the text (this alone can be more easily clipped)
         // - Handle scrolling, highlight selection, display cursor (those all requires some form of 1d->2d cursor position calculation)
         // - Measure text height (for scrollbar)
-        // We are attempting to do most of that in **one main pass** to minimize the computation cost (non-negligible for large amount of text) + 2nd pass for selection rendering (we could merge them by an extra refactoring effort)
-        // FIXME: This should occur on buf_display but we'd need to maintain cursor/select_start/select_end for UTF-8.
-        const ImWchar* text_begin = state->TextW.Data;
+        // The line index gives us the line of any position and the line count without scanning the text, so the cost of this section is
+        // proportional to the number of visible lines, plus the lengths of the lines holding the cursor and the start of the selection.
+        const char* text_begin = state->TextSrc;
+        const ImVector<int>& line_starts = state->LineStarts;
         ImVec2 cursor_offset, select_start_offset;
+        int select_start_line_no = 0;
 
         {
-            // Find lines numbers straddling 'cursor' (slot 0) and 'select_start' (slot 1) positions.
-            const ImWchar* searches_input_ptr[2] = { NULL, NULL };
-            int searches_result_line_no[2] = { -1000, -1000 };
-            int searches_remaining = 0;
+            // Calculate 2d position by finding the beginning of the line and measuring distance
             if (render_cursor)
             {
-                searches_input_ptr[0] = text_begin + state->Stb.cursor;
-                searches_result_line_no[0] = -1;
-                searches_remaining++;
+                const int cursor_line_no = InputTextFindLineNo(line_starts, state->Stb.cursor);
+                cursor_offset.x = InputTextCalcTextSize(&g, text_begin + line_starts[cursor_line_no], text_begin + state->Stb.cursor).x;
+                cursor_offset.y = (cursor_line_no + 1) * g.FontSize;
             }
             if (render_selection)
             {
-                searches_input_ptr[1] = text_begin + ImMin(state->Stb.select_start, state->Stb.select_end);
-                searches_result_line_no[1] = -1;
-                searches_remaining++;
-            }
-
-            // Iterate all lines to find our line numbers
-            // In multi-line mode, we never exit the loop until all lines are counted, so add one extra to the searches_remaining counter.
-            searches_remaining += is_multiline ? 1 : 0;
-            int line_count = 0;
-            //for (const ImWchar* s = text_begin; (s = (const ImWchar*)wcschr((const wchar_t*)s, (wchar_t)'\n')) != NULL; s++)  // FIXME-OPT: Could use this when wchar_t are 16-bit
-            for (const ImWchar* s = text_begin; *s != 0; s++)
-                if (*s == '\n')
-                {
-                    line_count++;
-                    if (searches_result_line_no[0] == -1 && s >= searches_input_ptr[0]) { searches_result_line_no[0] = line_count; if (--searches_remaining <= 0) break; }
-                    if (searches_result_line_no[1] == -1 && s >= searches_input_ptr[1]) { searches_result_line_no[1] = line_count; if (--searches_remaining <= 0) break; }
-                }
-            line_count++;
-            if (searches_result_line_no[0] == -1)
-                searches_result_line_no[0] = line_count;
-            if (searches_result_line_no[1] == -1)
-                searches_result_line_no[1] = line_count;
-
-            // Calculate 2d position by finding the beginning of the line and measuring distance
-            cursor_offset.x = InputTextCalcTextSizeW(&g, ImStrbolW(searches_input_ptr[0], text_begin), searches_input_ptr[0]).x;
-            cursor_offset.y = searches_result_line_no[0] * g.FontSize;
-            if (searches_result_line_no[1] >= 0)
-            {
-                select_start_offset.x = InputTextCalcTextSizeW(&g, ImStrbolW(searches_input_ptr[1], text_begin), searches_input_ptr[1]).x;
-                select_start_offset.y = searches_result_line_no[1] * g.FontSize;
+                const int select_start = ImMin(state->Stb.select_start, state->Stb.select_end);
+                select_start_line_no = InputTextFindLineNo(line_starts, select_start);
+                select_start_offset.x = InputTextCalcTextSize(&g, text_begin + line_starts[select_start_line_no], text_begin + select_start).x;
+                select_start_offset.y = (select_start_line_no + 1) * g.FontSize;
             }
 
             // Store text height (note that we haven't calculated text width at all, see GitHub issues #383, #1224)
             if (is_multiline)
-                text_size = ImVec2(inner_size.x, line_count * g.FontSize);
+                text_size = ImVec2(inner_size.x, line_starts.Size * g.FontSize);
         }
 
         // Scroll
@@ -5015,34 +5153,33 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         const ImVec2 draw_scroll = ImVec2(state->ScrollX, 0.0f);
         if (render_selection)
         {
-            const ImWchar* text_selected_begin = text_begin + ImMin(state->Stb.select_start, state->Stb.select_end);
-            const ImWchar* text_selected_end = text_begin + ImMax(state->Stb.select_start, state->Stb.select_end);
+            const char* text_selected_begin = text_begin + ImMin(state->Stb.select_start, state->Stb.select_end);
+            const char* text_selected_end = text_begin + ImMax(state->Stb.select_start, state->Stb.select_end);
 
             ImU32 bg_color = GetColorU32(ImGuiCol_TextSelectedBg, render_cursor ? 1.0f : 0.6f); // FIXME: current code flow mandate that render_cursor is always true here, we are leaving the transparent one for tests.
             float bg_offy_up = is_multiline ? 0.0f : -1.0f;    // FIXME: those offsets should be part of the style? they don't play so well with multi-line selection.
             float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
             ImVec2 rect_pos = draw_pos + select_start_offset - draw_scroll;
-            for (const ImWchar* p = text_selected_begin; p < text_selected_end; )
+            const char* p = text_selected_begin;
+            if (rect_pos.y < clip_rect.y)
+            {
+                // Skip selected lines above the clip rectangle
+                const int select_end_line_no = InputTextFindLineNo(line_starts, (int)(text_selected_end - text_begin));
+                const int skip_lines = ImMin((int)ImCeil((clip_rect.y - rect_pos.y) / g.FontSize), select_end_line_no - select_start_line_no + 1);
+                p = (select_start_line_no + skip_lines <= select_end_line_no) ? text_begin + line_starts[select_start_line_no + skip_lines] : text_selected_end;
+                rect_pos.x = draw_pos.x - draw_scroll.x;
+                rect_pos.y += skip_lines * g.FontSize;
+            }
+            for (; p < text_selected_end; )
             {
                 if (rect_pos.y > clip_rect.w + g.FontSize)
                     break;
-                if (rect_pos.y < clip_rect.y)
-                {
-                    //p = (const ImWchar*)wmemchr((const wchar_t*)p, '\n', text_selected_end - p);  // FIXME-OPT: Could use this when wchar_t are 16-bit
-                    //p = p ? p + 1 : text_selected_end;
-                    while (p < text_selected_end)
-                        if (*p++ == '\n')
-                            break;
-                }
-                else
-                {
-                    ImVec2 rect_size = InputTextCalcTextSizeW(&g, p, text_selected_end, &p, NULL, true);
-                    if (rect_size.x <= 0.0f) rect_size.x = IM_TRUNC(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
-                    ImRect rect(rect_pos + ImVec2(0.0f, bg_offy_up - g.FontSize), rect_pos + ImVec2(rect_size.x, bg_offy_dn));
-                    rect.ClipWith(clip_rect);
-                    if (rect.Overlaps(clip_rect))
-                        draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
-                }
+                ImVec2 rect_size = InputTextCalcTextSize(&g, p, text_selected_end, &p, NULL, true);
+                if (rect_size.x <= 0.0f) rect_size.x = IM_TRUNC(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
+                ImRect rect(rect_pos + ImVec2(0.0f, bg_offy_up - g.FontSize), rect_pos + ImVec2(rect_size.x, bg_offy_dn));
+                rect.ClipWith(clip_rect);
+                if (rect.Overlaps(clip_rect))
+                    draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
                 rect_pos.x = draw_pos.x - draw_scroll.x;
                 rect_pos.y += g.FontSize;
             }
@@ -5051,8 +5188,23 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
         if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
+            // Only submit the visible lines (ImFont::RenderText() would skip the others but still has to scan through them).
+            // We keep one extra line on each side and use the draw list clip rectangle so the output is identical to submitting the whole text.
+            const char* buf_display_visible_begin = buf_display;
+            const char* buf_display_visible_end = buf_display_end;
+            ImVec2 buf_display_visible_pos = draw_pos - draw_scroll;
+            if (is_multiline && !is_displaying_hint)
+            {
+                const ImVec4& draw_clip_rect = draw_window->DrawList->_CmdHeader.ClipRect;
+                const int line_first = ImClamp((int)((draw_clip_rect.y - draw_pos.y) / g.FontSize) - 1, 0, line_starts.Size - 1);
+                const int line_last = ImClamp((int)((draw_clip_rect.w - draw_pos.y) / g.FontSize) + 1, line_first, line_starts.Size - 1);
+                buf_display_visible_begin = buf_display + line_starts[line_first];
+                if (line_last + 1 < line_starts.Size)
+                    buf_display_visible_end = buf_display + line_starts[line_last + 1];
+                buf_display_visible_pos.y += line_first * g.FontSize;
+            }
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
-            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
+            draw_window->DrawList->AddText(g.Font, g.FontSize, buf_display_visible_pos, col, buf_display_visible_begin, buf_display_visible_end, 0.0f, is_multiline ? NULL : &clip_rect);
         }
 
         // Draw blinking cursor
@@ -5142,7 +5294,7 @@ void ImGui::DebugNodeInputTextState(ImGuiInputTextState* state)
     ImStb::StbUndoState* undo_state = &stb_state->undostate;
     Text("ID: 0x%08X, ActiveID: 0x%08X", state->ID, g.ActiveId);
     DebugLocateItemOnHover(state->ID);
-    Text("CurLenW: %d, CurLenA: %d, Cursor: %d, Selection: %d..%d", state->CurLenW, state->CurLenA, stb_state->cursor, stb_state->select_start, stb_state->select_end);
+    Text("CurLenA: %d, Lines: %d, Cursor: %d, Selection: %d..%d", state->CurLenA, state->LineStarts.Size, stb_state->cursor, stb_state->select_start, stb_state->select_end);
     Text("has_preferred_x: %d (%.2f)", stb_state->has_preferred_x, stb_state->preferred_x);
     Text("undo_point: %d, redo_point: %d, undo_char_point: %d, redo_char_point: %d", undo_state->undo_point, undo_state->redo_point, undo_state->undo_char_point, undo_state->redo_char_point);
     if (BeginChild("undopoints", ImVec2(0.0f, GetTextLineHeight() * 10), ImGuiChildFlags_Border | ImGuiChildFlags_ResizeY)) // Visualize undo state
@@ -5156,7 +5308,7 @@ void ImGui::DebugNodeInputTextState(ImGuiInputTextState* state)
                 BeginDisabled();
             char buf[64] = "";
             if (undo_rec_type != ' ' && undo_rec->char_storage != -1)
-                ImTextStrToUtf8(buf, IM_ARRAYSIZE(buf), undo_state->undo_char + undo_rec->char_storage, undo_state->undo_char + undo_rec->char_storage + undo_rec->insert_length);
+                ImStrncpy(buf, undo_state->undo_char + undo_rec->char_storage, ImMin(undo_rec->insert_length + 1, IM_ARRAYSIZE(buf)));
             Text("%c [%02d] where %03d, insert %03d, delete %03d, char_storage %03d \"%s\"",
                 undo_rec_type, n, undo_rec->where, undo_rec->insert_length, undo_rec->delete_length, undo_rec->char_storage, buf);
             if (undo_rec_type == ' ')
@@ -7086,6 +7238,8 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // [SECTION] Widgets: PlotLines, PlotHistogram
 //-------------------------------------------------------------------------
 // - PlotEx() [Internal]
+// - ImGuiPlotBuffer
+// - PlotBufferEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
 //-------------------------------------------------------------------------
@@ -7210,6 +7364,226 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     return idx_hovered;
 }
 
+static inline ImVec2 ImGuiPlotBuffer_GetNode(const ImGuiPlotBuffer* buffer, int node_n)
+{
+    if (node_n < buffer->TreeSize)
+        return buffer->Tree.Data[node_n];
+    const int value_n = node_n - buffer->TreeSize;
+    if (value_n >= buffer->Count) // Values[] is only partially used until the buffer is full, from Values[0] (Offset == 0).
+        return ImVec2(FLT_MAX, -FLT_MAX);
+    const float v = buffer->Values.Data[value_n];
+    if (v != v) // Ignore NaN values
+        return ImVec2(FLT_MAX, -FLT_MAX);
+    return ImVec2(v, v);
+}
+
+// Update min/max of nodes above Values[value_n]
+static void ImGuiPlotBuffer_UpdateNodes(ImGuiPlotBuffer* buffer, int value_n)
+{
+    for (int node_n = (buffer->TreeSize + value_n) >> 1; node_n >= 1; node_n >>= 1)
+    {
+        const ImVec2 a = ImGuiPlotBuffer_GetNode(buffer, node_n * 2);
+        const ImVec2 b = ImGuiPlotBuffer_GetNode(buffer, node_n * 2 + 1);
+        buffer->Tree.Data[node_n] = ImVec2(ImMin(a.x, b.x), ImMax(a.y, b.y));
+    }
+}
+
+// Min/max of Values[value_begin..value_end)
+static ImVec2 ImGuiPlotBuffer_GetMinMaxOfValues(const ImGuiPlotBuffer* buffer, int value_begin, int value_end)
+{
+    ImVec2 mm(FLT_MAX, -FLT_MAX);
+    for (int node_l = buffer->TreeSize + value_begin, node_r = buffer->TreeSize + value_end; node_l < node_r; node_l >>= 1, node_r >>= 1)
+    {
+        if (node_l & 1)
+        {
+            const ImVec2 node = ImGuiPlotBuffer_GetNode(buffer, node_l++);
+            mm = ImVec2(ImMin(mm.x, node.x), ImMax(mm.y, node.y));
+        }
+        if (node_r & 1)
+        {
+            const ImVec2 node = ImGuiPlotBuffer_GetNode(buffer, --node_r);
+            mm = ImVec2(ImMin(mm.x, node.x), ImMax(mm.y, node.y));
+        }
+    }
+    return mm;
+}
+
+void ImGuiPlotBuffer::SetCapacity(int capacity)
+{
+    IM_ASSERT(capacity >= 0);
+    TreeSize = 1;
+    while (TreeSize < capacity)
+        TreeSize <<= 1;
+    Values.resize(capacity);
+    Tree.resize(TreeSize);
+    Clear();
+}
+
+void ImGuiPlotBuffer::Clear()
+{
+    Count = Offset = 0;
+    for (ImVec2& node : Tree)
+        node = ImVec2(FLT_MAX, -FLT_MAX);
+}
+
+void ImGuiPlotBuffer::AddValue(float v)
+{
+    IM_ASSERT(Values.Size > 0 && "Call SetCapacity() first!");
+    int value_n;
+    if (Count < Values.Size)
+    {
+        value_n = Count++;
+    }
+    else
+    {
+        value_n = Offset;
+        Offset = (Offset + 1 < Values.Size) ? Offset + 1 : 0;
+    }
+    Values.Data[value_n] = v;
+    ImGuiPlotBuffer_UpdateNodes(this, value_n);
+}
+
+void ImGuiPlotBuffer::SetValue(int n, float v)
+{
+    IM_ASSERT(n >= 0 && n < Count);
+    n += Offset;
+    const int value_n = (n < Values.Size) ? n : n - Values.Size;
+    Values.Data[value_n] = v;
+    ImGuiPlotBuffer_UpdateNodes(this, value_n);
+}
+
+ImVec2 ImGuiPlotBuffer::GetMinMax(int n_begin, int n_end) const
+{
+    IM_ASSERT(n_begin >= 0 && n_begin <= n_end && n_end <= Count);
+    if (n_begin == n_end)
+        return ImVec2(FLT_MAX, -FLT_MAX);
+    if (n_begin == 0 && n_end == Count && Count == Values.Size)
+        return ImGuiPlotBuffer_GetNode(this, 1); // Whole buffer
+
+    // Logical range may wrap around the end of Values[]
+    const int value_begin = (Offset + n_begin < Values.Size) ? Offset + n_begin : Offset + n_begin - Values.Size;
+    const int value_end = value_begin + (n_end - n_begin);
+    if (value_end <= Values.Size)
+        return ImGuiPlotBuffer_GetMinMaxOfValues(this, value_begin, value_end);
+    const ImVec2 a = ImGuiPlotBuffer_GetMinMaxOfValues(this, value_begin, Values.Size);
+    const ImVec2 b = ImGuiPlotBuffer_GetMinMaxOfValues(this, 0, value_end - Values.Size);
+    return ImVec2(ImMin(a.x, b.x), ImMax(a.y, b.y));
+}
+
+static float Plot_BufferGetter(void* data, int idx)
+{
+    return ((const ImGuiPlotBuffer*)data)->GetValue(idx);
+}
+
+// When there are more values than pixels, draw one column per pixel covering the min/max of its values, instead of sampling one value per pixel.
+// Lines: the column also extends to the last value of previous column, so the plot stays connected.
+// Histogram: the column extends from the zero line to the min/max of its values.
+int ImGui::PlotBufferEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return -1;
+
+    const ImGuiStyle& style = g.Style;
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), label_size.y + style.FramePadding.y * 2.0f);
+    const int columns_count = (int)(frame_size.x - style.FramePadding.x * 2.0f);
+    const int values_count = buffer->GetCount();
+    if (values_count <= columns_count || columns_count <= 0)
+        return PlotEx(plot_type, label, &Plot_BufferGetter, (void*)buffer, values_count, 0, overlay_text, scale_min, scale_max, size_arg);
+
+    const ImGuiID id = window->GetID(label);
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, 0, &frame_bb))
+        return -1;
+    const bool hovered = ItemHoverable(frame_bb, id, g.LastItemData.InFlags);
+
+    // Determine scale from values if not specified
+    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    {
+        const ImVec2 mm = buffer->GetMinMax(0, values_count);
+        if (scale_min == FLT_MAX)
+            scale_min = mm.x;
+        if (scale_max == FLT_MAX)
+            scale_max = mm.y;
+    }
+
+    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+    // Tooltip on hover
+    int column_hovered = -1;
+    int idx_hovered = -1;
+    if (hovered && inner_bb.Contains(g.IO.MousePos))
+    {
+        column_hovered = ImClamp((int)(g.IO.MousePos.x - inner_bb.Min.x), 0, columns_count - 1);
+        const int v_idx_begin = (int)((ImS64)column_hovered * values_count / columns_count);
+        const int v_idx_end = (int)((ImS64)(column_hovered + 1) * values_count / columns_count);
+        const ImVec2 mm = buffer->GetMinMax(v_idx_begin, v_idx_end);
+        if (mm.x <= mm.y)
+            SetTooltip("%d..%d: %8.4g\nmin: %8.4g\nmax: %8.4g", v_idx_begin, v_idx_end - 1, buffer->GetValue(v_idx_end - 1), mm.x, mm.y);
+        else
+            SetTooltip("%d..%d: no value", v_idx_begin, v_idx_end - 1);
+        idx_hovered = v_idx_begin;
+    }
+
+    const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+    const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);
+    const float histogram_zero_line_y = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+    const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+    const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+
+    ImDrawList* draw_list = window->DrawList;
+    draw_list->PrimReserve(columns_count * 6, columns_count * 4);
+    int columns_drawn = 0;
+    float prev_value = FLT_MAX;
+    for (int column_n = 0; column_n < columns_count; column_n++)
+    {
+        const int v_idx_begin = (int)((ImS64)column_n * values_count / columns_count);
+        const int v_idx_end = (int)((ImS64)(column_n + 1) * values_count / columns_count);
+        ImVec2 mm = buffer->GetMinMax(v_idx_begin, v_idx_end);
+        if (mm.x > mm.y)
+            continue; // No value (NaN)
+        float y0, y1;
+        if (plot_type == ImGuiPlotType_Lines)
+        {
+            if (prev_value != FLT_MAX)
+                mm = ImVec2(ImMin(mm.x, prev_value), ImMax(mm.y, prev_value));
+            y0 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((mm.y - scale_min) * inv_scale));
+            y1 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((mm.x - scale_min) * inv_scale));
+            if (y1 < y0 + 1.0f)
+                y1 = y0 + 1.0f;
+            for (int v_idx = v_idx_end - 1; v_idx >= v_idx_begin; v_idx--) // Last value which isn't NaN
+                if (buffer->GetValue(v_idx) == buffer->GetValue(v_idx))
+                {
+                    prev_value = buffer->GetValue(v_idx);
+                    break;
+                }
+        }
+        else
+        {
+            y0 = ImMin(histogram_zero_line_y, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((mm.y - scale_min) * inv_scale)));
+            y1 = ImMax(histogram_zero_line_y, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((mm.x - scale_min) * inv_scale)));
+        }
+        const float x = inner_bb.Min.x + (float)column_n;
+        draw_list->PrimRect(ImVec2(x, y0), ImVec2(x + 1.0f, y1), (column_n == column_hovered) ? col_hovered : col_base);
+        columns_drawn++;
+    }
+    draw_list->PrimUnreserve((columns_count - columns_drawn) * 6, (columns_count - columns_drawn) * 4);
+
+    // Text overlay
+    if (overlay_text)
+        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
+
+    if (label_size.x > 0.0f)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+
+    return idx_hovered;
+}
+
 struct ImGuiPlotArrayGetterData
 {
     const float* Values;
@@ -7247,6 +7621,16 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGui::PlotLines(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotBufferEx(ImGuiPlotType_Lines, label, buffer, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotBufferEx(ImGuiPlotType_Histogram, label, buffer, overlay_text, scale_min, scale_max, graph_size);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
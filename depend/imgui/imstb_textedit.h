@@ -3,6 +3,9 @@
 // Those changes would need to be pushed into nothings/stb:
 // - Fix in stb_textedit_discard_redo (see https://github.com/nothings/stb/issues/321)
 // - Fix in stb_textedit_find_charpos to handle last line (see https://github.com/ocornut/imgui/issues/6000 + #6783)
+// - Added IMSTB_TEXTEDIT_GETNEXTCHARINDEX/IMSTB_TEXTEDIT_GETPREVCHARINDEX so a character may span multiple IMSTB_TEXTEDIT_CHARTYPE (e.g. UTF-8)
+// - Added stb_textedit_text() to insert multiple IMSTB_TEXTEDIT_CHARTYPE as one character, STB_TEXTEDIT_KEYTOTEXT is now optional
+// - Added IMSTB_TEXTEDIT_SEEKROW_FROM_Y/IMSTB_TEXTEDIT_SEEKROW_FROM_CHAR so hosts with a line index can skip the row scans of large texts
 // Grep for [DEAR IMGUI] to find the changes.
 // - Also renamed macros used or defined outside of IMSTB_TEXTEDIT_IMPLEMENTATION block from STB_TEXTEDIT_* to IMSTB_TEXTEDIT_*
 
@@ -137,7 +140,7 @@
 //                                        to the xpos of the i+1'th char for a line of characters
 //                                        starting at character #n (i.e. accounts for kerning
 //                                        with previous char)
-//    STB_TEXTEDIT_KEYTOTEXT(k)         maps a keyboard input to an insertable character
+//    STB_TEXTEDIT_KEYTOTEXT(k)         maps a keyboard input to an insertable character (optional, see stb_textedit_text)
 //                                        (return type is int, -1 means not valid to insert)
 //    STB_TEXTEDIT_GETCHAR(obj,i)       returns the i'th character of obj, 0-based
 //    STB_TEXTEDIT_NEWLINE              the character returned by _GETCHAR() we recognize
@@ -176,6 +179,12 @@
 //    STB_TEXTEDIT_K_TEXTSTART2          secondary keyboard input to move cursor to start of text
 //    STB_TEXTEDIT_K_TEXTEND2            secondary keyboard input to move cursor to end of text
 //
+//    [DEAR IMGUI] Optional:
+//    IMSTB_TEXTEDIT_GETNEXTCHARINDEX(obj,i)          returns the index of the character following the one at i (default i+1)
+//    IMSTB_TEXTEDIT_GETPREVCHARINDEX(obj,i)          returns the index of the character preceding the one at i (default i-1)
+//    IMSTB_TEXTEDIT_SEEKROW_FROM_Y(obj,y,&i,&y0)     sets i/y0 to the start/top of a row at or before the one straddling y
+//    IMSTB_TEXTEDIT_SEEKROW_FROM_CHAR(obj,n,&i,&y0)  sets i/y0 to the start/top of the row before the one containing n (or 0/0)
+//
 // Keyboard input must be encoded as a single integer value; e.g. a character code
 // and some bitflags that represent shift states. to simplify the interface, SHIFT must
 // be a bitflag, so we can test the shifted state of cursor movements to allow selection,
@@ -208,6 +217,7 @@
 //    void stb_textedit_drag(STB_TEXTEDIT_STRING *str, STB_TexteditState *state, float x, float y)
 //    int  stb_textedit_cut(STB_TEXTEDIT_STRING *str, STB_TexteditState *state)
 //    int  stb_textedit_paste(STB_TEXTEDIT_STRING *str, STB_TexteditState *state, STB_TEXTEDIT_CHARTYPE *text, int len)
+//    void stb_textedit_text(STB_TEXTEDIT_STRING *str, STB_TexteditState *state, const STB_TEXTEDIT_CHARTYPE *text, int text_len)
 //    void stb_textedit_key(STB_TEXTEDIT_STRING *str, STB_TexteditState *state, STB_TEXEDIT_KEYTYPE key)
 //
 //    Each of these functions potentially updates the string and updates the
@@ -392,6 +402,14 @@ typedef struct
 #define IMSTB_TEXTEDIT_memmove memmove
 #endif
 
+// [DEAR IMGUI]
+#ifndef IMSTB_TEXTEDIT_GETNEXTCHARINDEX
+#define IMSTB_TEXTEDIT_GETNEXTCHARINDEX(obj, idx) ((idx) + 1)
+#endif
+#ifndef IMSTB_TEXTEDIT_GETPREVCHARINDEX
+#define IMSTB_TEXTEDIT_GETPREVCHARINDEX(obj, idx) ((idx) - 1)
+#endif
+
 
 /////////////////////////////////////////////////////////////////////////////
 //
@@ -410,6 +428,10 @@ static int stb_text_locate_coord(IMSTB_TEXTEDIT_STRING *str, float x, float y)
    r.ymin = r.ymax = 0;
    r.num_chars = 0;
 
+#ifdef IMSTB_TEXTEDIT_SEEKROW_FROM_Y
+   IMSTB_TEXTEDIT_SEEKROW_FROM_Y(str, y, &i, &base_y); // [DEAR IMGUI]
+#endif
+
    // search rows to find one that straddles 'y'
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -438,14 +460,16 @@ static int stb_text_locate_coord(IMSTB_TEXTEDIT_STRING *str, float x, float y)
    if (x < r.x1) {
       // search characters in row for one that straddles 'x'
       prev_x = r.x0;
-      for (k=0; k < r.num_chars; ++k) {
+      for (k=0; k < r.num_chars; ) {
+         int next = IMSTB_TEXTEDIT_GETNEXTCHARINDEX(str, i+k) - i; // [DEAR IMGUI]
          float w = STB_TEXTEDIT_GETWIDTH(str, i, k);
          if (x < prev_x+w) {
             if (x < prev_x+w/2)
                return k+i;
             else
-               return k+i+1;
+               return next+i;
          }
+         k = next;
          prev_x += w;
       }
       // shouldn't happen, but if it does, fall through to end-of-line case
@@ -539,6 +563,10 @@ static void stb_textedit_find_charpos(StbFindState *find, IMSTB_TEXTEDIT_STRING
 
    // search rows to find the one that straddles character n
    find->y = 0;
+#ifdef IMSTB_TEXTEDIT_SEEKROW_FROM_CHAR
+   IMSTB_TEXTEDIT_SEEKROW_FROM_CHAR(str, n, &i, &find->y); // [DEAR IMGUI]
+   prev_start = i;
+#endif
 
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -563,7 +591,7 @@ static void stb_textedit_find_charpos(StbFindState *find, IMSTB_TEXTEDIT_STRING
 
    // now scan to find xpos
    find->x = r.x0;
-   for (i=0; first+i < n; ++i)
+   for (i=0; first+i < n; i = IMSTB_TEXTEDIT_GETNEXTCHARINDEX(str, first+i) - first) // [DEAR IMGUI]
       find->x += STB_TEXTEDIT_GETWIDTH(str, first, i);
 }
 
@@ -716,6 +744,33 @@ static int stb_textedit_paste_internal(IMSTB_TEXTEDIT_STRING *str, STB_TexteditS
    return 0;
 }
 
+// [DEAR IMGUI]
+// API text: insert a character made of one or more IMSTB_TEXTEDIT_CHARTYPE (e.g. a UTF-8 sequence), replacing the selection,
+// or the character under the cursor in insert mode
+static void stb_textedit_text(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *state, const IMSTB_TEXTEDIT_CHARTYPE *text, int text_len)
+{
+   // can't add newline in single-line mode
+   if (text[0] == '\n' && state->single_line)
+      return;
+
+   if (state->insert_mode && !STB_TEXT_HAS_SELECTION(state) && state->cursor < STB_TEXTEDIT_STRINGLEN(str)) {
+      int overwritten_len = IMSTB_TEXTEDIT_GETNEXTCHARINDEX(str, state->cursor) - state->cursor;
+      stb_text_makeundo_replace(str, state, state->cursor, overwritten_len, text_len);
+      STB_TEXTEDIT_DELETECHARS(str, state->cursor, overwritten_len);
+      if (STB_TEXTEDIT_INSERTCHARS(str, state->cursor, text, text_len)) {
+         state->cursor += text_len;
+         state->has_preferred_x = 0;
+      }
+   } else {
+      stb_textedit_delete_selection(str,state); // implicitly clamps
+      if (STB_TEXTEDIT_INSERTCHARS(str, state->cursor, text, text_len)) {
+         stb_text_makeundo_insert(state, state->cursor, text_len);
+         state->cursor += text_len;
+         state->has_preferred_x = 0;
+      }
+   }
+}
+
 #ifndef STB_TEXTEDIT_KEYTYPE
 #define STB_TEXTEDIT_KEYTYPE int
 #endif
@@ -726,30 +781,13 @@ static void stb_textedit_key(IMSTB_TEXTEDIT_STRING *str, STB_TexteditState *stat
 retry:
    switch (key) {
       default: {
+#ifdef STB_TEXTEDIT_KEYTOTEXT
          int c = STB_TEXTEDIT_KEYTOTEXT(key);
          if (c > 0) {
             IMSTB_TEXTEDIT_CHARTYPE ch = (IMSTB_TEXTEDIT_CHARTYPE) c;
-
-            // can't add newline in single-line mode
-            if (c == '\n' && state->single_line)
-               break;
-
-            if (state->insert_mode && !STB_TEXT_HAS_SELECTION(state) && state->cursor < STB_TEXTEDIT_STRINGLEN(str)) {
-               stb_text_makeundo_replace(str, state, state->cursor, 1, 1);
-               STB_TEXTEDIT_DELETECHARS(str, state->cursor, 1);
-               if (STB_TEXTEDIT_INSERTCHARS(str, state->cursor, &ch, 1)) {
-                  ++state->cursor;
-                  state->has_preferred_x = 0;
-               }
-            } else {
-               stb_textedit_delete_selection(str,state); // implicitly clamps
-               if (STB_TEXTEDIT_INSERTCHARS(str, state->cursor, &ch, 1)) {
-                  stb_text_makeundo_insert(state, state->cursor, 1);
-                  ++state->cursor;
-                  state->has_preferred_x = 0;
-               }
-            }
+            stb_textedit_text(str, state, &ch, 1);
          }
+#endif
          break;
       }
 
@@ -775,7 +813,7 @@ retry:
             stb_textedit_move_to_first(state);
          else
             if (state->cursor > 0)
-               --state->cursor;
+               state->cursor = IMSTB_TEXTEDIT_GETPREVCHARINDEX(str, state->cursor); // [DEAR IMGUI]
          state->has_preferred_x = 0;
          break;
 
@@ -784,7 +822,7 @@ retry:
          if (STB_TEXT_HAS_SELECTION(state))
             stb_textedit_move_to_last(str, state);
          else
-            ++state->cursor;
+            state->cursor = IMSTB_TEXTEDIT_GETNEXTCHARINDEX(str, state->cursor); // [DEAR IMGUI]
          stb_textedit_clamp(str, state);
          state->has_preferred_x = 0;
          break;
@@ -794,7 +832,7 @@ retry:
          stb_textedit_prep_selection_at_cursor(state);
          // move selection left
          if (state->select_end > 0)
-            --state->select_end;
+            state->select_end = IMSTB_TEXTEDIT_GETPREVCHARINDEX(str, state->select_end); // [DEAR IMGUI]
          state->cursor = state->select_end;
          state->has_preferred_x = 0;
          break;
@@ -844,7 +882,7 @@ retry:
       case STB_TEXTEDIT_K_RIGHT | STB_TEXTEDIT_K_SHIFT:
          stb_textedit_prep_selection_at_cursor(state);
          // move selection right
-         ++state->select_end;
+         state->select_end = IMSTB_TEXTEDIT_GETNEXTCHARINDEX(str, state->select_end); // [DEAR IMGUI]
          stb_textedit_clamp(str, state);
          state->cursor = state->select_end;
          state->has_preferred_x = 0;
@@ -891,7 +929,8 @@ retry:
             state->cursor = start;
             STB_TEXTEDIT_LAYOUTROW(&row, str, state->cursor);
             x = row.x0;
-            for (i=0; i < row.num_chars; ++i) {
+            for (i=0; i < row.num_chars; ) {
+               int next = IMSTB_TEXTEDIT_GETNEXTCHARINDEX(str, start + i) - start; // [DEAR IMGUI]
                float dx = STB_TEXTEDIT_GETWIDTH(str, start, i);
                #ifdef IMSTB_TEXTEDIT_GETWIDTH_NEWLINE
                if (dx == IMSTB_TEXTEDIT_GETWIDTH_NEWLINE)
@@ -900,7 +939,8 @@ retry:
                x += dx;
                if (x > goal_x)
                   break;
-               ++state->cursor;
+               state->cursor = start + next;
+               i = next;
             }
             stb_textedit_clamp(str, state);
 
@@ -953,7 +993,8 @@ retry:
             state->cursor = find.prev_first;
             STB_TEXTEDIT_LAYOUTROW(&row, str, state->cursor);
             x = row.x0;
-            for (i=0; i < row.num_chars; ++i) {
+            for (i=0; i < row.num_chars; ) {
+               int next = IMSTB_TEXTEDIT_GETNEXTCHARINDEX(str, find.prev_first + i) - find.prev_first; // [DEAR IMGUI]
                float dx = STB_TEXTEDIT_GETWIDTH(str, find.prev_first, i);
                #ifdef IMSTB_TEXTEDIT_GETWIDTH_NEWLINE
                if (dx == IMSTB_TEXTEDIT_GETWIDTH_NEWLINE)
@@ -962,7 +1003,8 @@ retry:
                x += dx;
                if (x > goal_x)
                   break;
-               ++state->cursor;
+               state->cursor = find.prev_first + next;
+               i = next;
             }
             stb_textedit_clamp(str, state);
 
@@ -990,7 +1032,7 @@ retry:
          else {
             int n = STB_TEXTEDIT_STRINGLEN(str);
             if (state->cursor < n)
-               stb_textedit_delete(str, state, state->cursor, 1);
+               stb_textedit_delete(str, state, state->cursor, IMSTB_TEXTEDIT_GETNEXTCHARINDEX(str, state->cursor) - state->cursor); // [DEAR IMGUI]
          }
          state->has_preferred_x = 0;
          break;
@@ -1002,8 +1044,9 @@ retry:
          else {
             stb_textedit_clamp(str, state);
             if (state->cursor > 0) {
-               stb_textedit_delete(str, state, state->cursor-1, 1);
-               --state->cursor;
+               int prev = IMSTB_TEXTEDIT_GETPREVCHARINDEX(str, state->cursor); // [DEAR IMGUI]
+               stb_textedit_delete(str, state, prev, state->cursor - prev);
+               state->cursor = prev;
             }
          }
          state->has_preferred_x = 0;
@@ -0,0 +1,56 @@
+/*
+ * C API of the engine's shared job pool (`engine/src/JobPool.zig`), for C and
+ * C++ code such as the UI. All functions use the process-wide pool, which the
+ * client creates at startup. Before it is created and after it is destroyed,
+ * every function but `viletech_jobs_parallel_for` fails, returning false or 0.
+ */
+
+#ifndef VILETECH_JOBS_H
+#define VILETECH_JOBS_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Jobs are taken strictly in this order. */
+typedef enum viletech_JobPriority {
+    viletech_jobprio_sim = 0,
+    viletech_jobprio_ui = 1,
+    viletech_jobprio_background = 2,
+} viletech_JobPriority;
+
+typedef void (*viletech_JobFn)(void *ctx);
+
+/* Queues `func(ctx)`. Returns false if the job could not be queued. */
+bool viletech_jobs_spawn(int priority, viletech_JobFn func, void *ctx);
+
+/*
+ * Runs one queued job on the calling thread, if there is one. Use this while
+ * waiting on jobs instead of sleeping, so that the core stays busy.
+ * Returns false if every queue was empty.
+ */
+bool viletech_jobs_help(void);
+
+int viletech_jobs_worker_count(void);
+
+/*
+ * Runs `job_func(job_data, i)` for every `i` in `[0, jobs_count)`, at UI
+ * priority, one of them on the calling thread, and returns once all are done.
+ * Matches Dear ImGui's `ImGuiParallelForFunc` (`user_data` is unused), e.g.
+ * for `ImGuiTableSortIndex::ParallelFor`. Unlike the functions above, this
+ * still works without the pool, running every job on the calling thread.
+ */
+void viletech_jobs_parallel_for(
+    void *user_data,
+    int jobs_count,
+    void (*job_func)(void *job_data, int job_index),
+    void *job_data
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VILETECH_JOBS_H */
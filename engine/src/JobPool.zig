@@ -0,0 +1,526 @@
+//! A work-stealing job system shared by the whole process.
+//!
+//! The game simulation (including flecs' pipeline workers, via `taskNew` and
+//! `taskJoin`), UI builders and background asset work all draw from one set of
+//! threads, rather than each subsystem oversubscribing cores with a pool of its
+//! own. Jobs are taken strictly in `Priority` order; within a priority, each
+//! worker prefers its own newest jobs, then the oldest jobs submitted from
+//! outside the pool, then the oldest jobs of other workers.
+//!
+//! C and C++ code reaches the pool through `c_api`, declared in
+//! `engine/include/viletech_jobs.h`.
+
+const std = @import("std");
+
+const Deque = @import("deque").Deque;
+
+const Self = @This();
+
+pub const Priority = enum(u8) {
+    /// Game simulation. Always taken first.
+    sim,
+    /// UI builders; e.g. draw list generation.
+    ui,
+    /// Asset loading, node building, and other work which no frame waits on.
+    background,
+};
+
+const priority_count = std.enums.values(Priority).len;
+
+pub const JobFn = *const fn (ctx: ?*anyopaque) callconv(.C) void;
+
+pub const Job = struct {
+    func: JobFn,
+    ctx: ?*anyopaque,
+};
+
+const Queue = struct {
+    mutex: std.Thread.Mutex = .{},
+    jobs: [priority_count]Deque(Job),
+
+    fn init(allocator: std.mem.Allocator) std.mem.Allocator.Error!Queue {
+        var ret = Queue{ .jobs = undefined };
+        var initialized: usize = 0;
+
+        errdefer for (ret.jobs[0..initialized]) |dq| dq.deinit();
+
+        for (&ret.jobs) |*dq| {
+            dq.* = try Deque(Job).init(allocator);
+            initialized += 1;
+        }
+
+        return ret;
+    }
+
+    fn deinit(self: *Queue) void {
+        for (self.jobs) |dq| dq.deinit();
+    }
+
+    fn take(self: *Queue, priority: usize, newest: bool) ?Job {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        return if (newest) self.jobs[priority].popBack() else self.jobs[priority].popFront();
+    }
+};
+
+const Worker = struct {
+    queue: Queue,
+    thread: std.Thread,
+};
+
+/// The pool used by `taskNew`, `taskJoin` and `c_api`, which have no other way
+/// of being given one. Store to this (`.release`) once at startup, before any
+/// of them are used, and load from it with `.acquire`.
+pub var global = std.atomic.Value(?*Self).init(null);
+
+threadlocal var current_pool: ?*Self = null;
+threadlocal var current_worker: usize = 0;
+
+/// Must be thread-safe, since jobs can be submitted from any thread.
+allocator: std.mem.Allocator,
+workers: []Worker,
+/// Jobs submitted from threads outside the pool.
+injector: Queue,
+/// Jobs which may block until other jobs run (see `taskNew`). Guarded by
+/// `injector.mutex`, and only ever taken by workers; never by `help`.
+tasks: Deque(Job),
+
+/// How many jobs are queued across all queues.
+pending: std.atomic.Value(usize),
+running: std.atomic.Value(bool),
+idle_mutex: std.Thread.Mutex,
+idle_cond: std.Thread.Condition,
+
+pub const Config = struct {
+    /// Defaults to one fewer than the number of logical CPUs (at least 1),
+    /// leaving a core for the main thread.
+    workers: ?usize = null,
+};
+
+pub fn create(allocator: std.mem.Allocator, config: Config) !*Self {
+    const worker_count = config.workers orelse
+        @max(1, (std.Thread.getCpuCount() catch 2) - 1);
+
+    const self = try allocator.create(Self);
+    errdefer allocator.destroy(self);
+
+    self.* = Self{
+        .allocator = allocator,
+        .workers = try allocator.alloc(Worker, worker_count),
+        .injector = undefined,
+        .tasks = undefined,
+        .pending = std.atomic.Value(usize).init(0),
+        .running = std.atomic.Value(bool).init(true),
+        .idle_mutex = .{},
+        .idle_cond = .{},
+    };
+    errdefer allocator.free(self.workers);
+
+    self.injector = try Queue.init(allocator);
+    errdefer self.injector.deinit();
+
+    self.tasks = try Deque(Job).init(allocator);
+    errdefer self.tasks.deinit();
+
+    var initialized: usize = 0;
+
+    errdefer for (self.workers[0..initialized]) |*w| w.queue.deinit();
+
+    for (self.workers) |*w| {
+        w.queue = try Queue.init(allocator);
+        initialized += 1;
+    }
+
+    var spawned: usize = 0;
+
+    errdefer {
+        self.stop();
+        for (self.workers[0..spawned]) |w| w.thread.join();
+    }
+
+    for (self.workers, 0..) |*w, i| {
+        w.thread = try std.Thread.spawn(.{}, workerLoop, .{ self, i });
+        spawned += 1;
+    }
+
+    return self;
+}
+
+/// Runs every job still queued, then stops and joins all workers.
+pub fn destroy(self: *Self) void {
+    self.stop();
+
+    for (self.workers) |*w| {
+        w.thread.join();
+        w.queue.deinit();
+    }
+
+    self.tasks.deinit();
+    self.injector.deinit();
+    self.allocator.free(self.workers);
+    self.allocator.destroy(self);
+}
+
+pub fn workerCount(self: *const Self) usize {
+    return self.workers.len;
+}
+
+/// Queues `job`. Called from a worker, it goes on that worker's own queue;
+/// otherwise, it goes on the shared queue.
+pub fn spawn(self: *Self, priority: Priority, job: Job) std.mem.Allocator.Error!void {
+    const queue = if (self.currentWorker()) |i| &self.workers[i].queue else &self.injector;
+
+    // Counted before the push, so that `pending` never under-counts.
+    _ = self.pending.fetchAdd(1, .release);
+
+    {
+        queue.mutex.lock();
+        defer queue.mutex.unlock();
+
+        queue.jobs[@intFromEnum(priority)].pushBack(job) catch |err| {
+            _ = self.pending.fetchSub(1, .release);
+            return err;
+        };
+    }
+
+    self.notify();
+}
+
+/// Runs one queued job on the calling thread, if there is one.
+/// Returns `false` if every queue was empty.
+pub fn help(self: *Self) bool {
+    const job = self.take(self.currentWorker()) orelse return false;
+    job.func(job.ctx);
+    return true;
+}
+
+/// Like `std.Thread.Pool.spawnWg`: calls `wg.start()`, then queues
+/// `@call(.auto, func, args)` followed by `wg.finish()`. If the job can not be
+/// queued, it runs on the calling thread instead.
+pub fn spawnWg(
+    self: *Self,
+    priority: Priority,
+    wg: *std.Thread.WaitGroup,
+    comptime func: anytype,
+    args: anytype,
+) void {
+    wg.start();
+
+    const Args = @TypeOf(args);
+    const Closure = struct {
+        pool: *Self,
+        wg: *std.Thread.WaitGroup,
+        args: Args,
+
+        fn run(ctx: ?*anyopaque) callconv(.C) void {
+            const closure: *@This() = @alignCast(@ptrCast(ctx.?));
+            @call(.auto, func, closure.args);
+            const closure_wg = closure.wg;
+            closure.pool.allocator.destroy(closure);
+            closure_wg.finish();
+        }
+    };
+
+    const closure = self.allocator.create(Closure) catch {
+        @call(.auto, func, args);
+        wg.finish();
+        return;
+    };
+
+    closure.* = Closure{ .pool = self, .wg = wg, .args = args };
+
+    self.spawn(priority, .{ .func = Closure.run, .ctx = closure }) catch {
+        self.allocator.destroy(closure);
+        @call(.auto, func, args);
+        wg.finish();
+    };
+}
+
+/// Runs queued jobs on the calling thread until `wg` is done, so that waiting
+/// on a batch of jobs does not leave a core idle.
+pub fn waitAndWork(self: *Self, wg: *std.Thread.WaitGroup) void {
+    while (!wg.isDone()) {
+        if (!self.help()) {
+            wg.wait();
+            return;
+        }
+    }
+}
+
+fn stop(self: *Self) void {
+    self.idle_mutex.lock();
+    defer self.idle_mutex.unlock();
+    self.running.store(false, .release);
+    self.idle_cond.broadcast();
+}
+
+fn currentWorker(self: *const Self) ?usize {
+    const pool = current_pool orelse return null;
+    return if (pool == self) current_worker else null;
+}
+
+fn notify(self: *Self) void {
+    // Taking the lock orders this against a worker checking `pending` before
+    // it waits, so the signal can not be lost.
+    self.idle_mutex.lock();
+    defer self.idle_mutex.unlock();
+    self.idle_cond.signal();
+}
+
+fn take(self: *Self, me: ?usize) ?Job {
+    for (0..priority_count) |p| {
+        if (me) |i| {
+            if (self.workers[i].queue.take(p, true)) |job| return self.taken(job);
+        }
+
+        if (self.injector.take(p, false)) |job| return self.taken(job);
+
+        const start = if (me) |i| i + 1 else 0;
+
+        for (0..self.workers.len) |k| {
+            const victim = (start + k) % self.workers.len;
+            if (me != null and victim == me.?) continue;
+            if (self.workers[victim].queue.take(p, false)) |job| return self.taken(job);
+        }
+    }
+
+    return null;
+}
+
+fn takeTask(self: *Self) ?Job {
+    self.injector.mutex.lock();
+    defer self.injector.mutex.unlock();
+    return if (self.tasks.popFront()) |job| self.taken(job) else null;
+}
+
+fn taken(self: *Self, job: Job) Job {
+    _ = self.pending.fetchSub(1, .acq_rel);
+    return job;
+}
+
+fn workerLoop(self: *Self, index: usize) void {
+    current_pool = self;
+    current_worker = index;
+
+    while (true) {
+        if (self.takeTask() orelse self.take(index)) |job| {
+            job.func(job.ctx);
+            continue;
+        }
+
+        self.idle_mutex.lock();
+        defer self.idle_mutex.unlock();
+
+        while (self.pending.load(.acquire) == 0) {
+            if (!self.running.load(.acquire)) return;
+            self.idle_cond.wait(&self.idle_mutex);
+        }
+    }
+}
+
+// flecs OS API task hooks /////////////////////////////////////////////////////
+
+const Task = struct {
+    pool: *Self,
+    callback: *const fn (?*anyopaque) callconv(.C) ?*anyopaque,
+    param: ?*anyopaque,
+    result: ?*anyopaque = null,
+    done: std.Thread.ResetEvent = .{},
+
+    fn run(ctx: ?*anyopaque) callconv(.C) void {
+        const task: *Task = @alignCast(@ptrCast(ctx.?));
+        task.result = task.callback(task.param);
+        task.done.set();
+    }
+};
+
+/// Matches flecs' `ecs_os_api_task_new_t`. To run flecs' pipeline on
+/// `global`, install this and `taskJoin` as `ecs_os_api.task_new_` and
+/// `ecs_os_api.task_join_`, then call `ecs_set_task_threads` instead of
+/// `ecs_set_threads`.
+///
+/// flecs' workers wait on each other at every sync point, so all of a frame's
+/// tasks must be running at once: pass `ecs_set_task_threads` no more than
+/// `workerCount() + 1` (stage 0 runs on the thread calling `ecs_progress`).
+/// Tasks are taken before all other jobs, but a worker busy with a long job
+/// delays them, so keep `background` jobs short.
+pub fn taskNew(
+    callback: ?*const fn (?*anyopaque) callconv(.C) ?*anyopaque,
+    param: ?*anyopaque,
+) callconv(.C) usize {
+    const self = global.load(.acquire) orelse return 0;
+
+    const task = self.allocator.create(Task) catch return 0;
+    task.* = Task{ .pool = self, .callback = callback.?, .param = param };
+
+    _ = self.pending.fetchAdd(1, .release);
+
+    {
+        self.injector.mutex.lock();
+        defer self.injector.mutex.unlock();
+
+        self.tasks.pushBack(.{ .func = Task.run, .ctx = task }) catch {
+            _ = self.pending.fetchSub(1, .release);
+            self.allocator.destroy(task);
+            return 0;
+        };
+    }
+
+    self.notify();
+    return @intFromPtr(task);
+}
+
+/// Matches flecs' `ecs_os_api_task_join_t`. See `taskNew`.
+pub fn taskJoin(thread: usize) callconv(.C) ?*anyopaque {
+    const task: *Task = @ptrFromInt(thread);
+    task.done.wait();
+    const ret = task.result;
+    task.pool.allocator.destroy(task);
+    return ret;
+}
+
+// C API ///////////////////////////////////////////////////////////////////////
+
+/// Exported for C and C++ code; see `engine/include/viletech_jobs.h`.
+/// All of these use `global`. While it is null, `viletech_jobs_parallel_for`
+/// runs every job on the calling thread, and the rest fail (returning `false`
+/// or 0).
+pub const c_api = struct {
+    export fn viletech_jobs_spawn(priority: c_int, func: JobFn, ctx: ?*anyopaque) bool {
+        const pool = global.load(.acquire) orelse return false;
+        const p = std.meta.intToEnum(Priority, priority) catch return false;
+        pool.spawn(p, .{ .func = func, .ctx = ctx }) catch return false;
+        return true;
+    }
+
+    export fn viletech_jobs_help() bool {
+        const pool = global.load(.acquire) orelse return false;
+        return pool.help();
+    }
+
+    export fn viletech_jobs_worker_count() c_int {
+        const pool = global.load(.acquire) orelse return 0;
+        return @intCast(pool.workerCount());
+    }
+
+    /// Matches Dear ImGui's `ImGuiParallelForFunc`; `user_data` is unused.
+    export fn viletech_jobs_parallel_for(
+        user_data: ?*anyopaque,
+        jobs_count: c_int,
+        job_func: *const fn (?*anyopaque, c_int) callconv(.C) void,
+        job_data: ?*anyopaque,
+    ) void {
+        _ = user_data;
+
+        if (jobs_count <= 0) return;
+        const count: usize = @intCast(jobs_count);
+
+        const pool = global.load(.acquire) orelse {
+            for (0..count) |i| job_func(job_data, @intCast(i));
+            return;
+        };
+
+        var wg = std.Thread.WaitGroup{};
+
+        for (1..count) |i| {
+            pool.spawnWg(.ui, &wg, callIndexed, .{ job_func, job_data, @as(c_int, @intCast(i)) });
+        }
+
+        job_func(job_data, 0);
+        pool.waitAndWork(&wg);
+    }
+
+    fn callIndexed(
+        job_func: *const fn (?*anyopaque, c_int) callconv(.C) void,
+        job_data: ?*anyopaque,
+        index: c_int,
+    ) void {
+        job_func(job_data, index);
+    }
+};
+
+test "spawn, steal, wait" {
+    const pool = try Self.create(std.testing.allocator, .{ .workers = 3 });
+    defer pool.destroy();
+
+    const Ctx = struct {
+        pool: *Self,
+        sum: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+        wg: std.Thread.WaitGroup = .{},
+
+        fn leaf(ctx: ?*anyopaque) callconv(.C) void {
+            const this: *@This() = @alignCast(@ptrCast(ctx.?));
+            _ = this.sum.fetchAdd(1, .monotonic);
+            this.wg.finish();
+        }
+
+        // Spawns from inside a worker, so that other workers have to steal.
+        fn fanOut(ctx: ?*anyopaque) callconv(.C) void {
+            const this: *@This() = @alignCast(@ptrCast(ctx.?));
+
+            for (0..100) |_| {
+                this.wg.start();
+                this.pool.spawn(.background, .{ .func = leaf, .ctx = this }) catch unreachable;
+            }
+
+            this.wg.finish();
+        }
+    };
+
+    var ctx = Ctx{ .pool = pool };
+
+    for (0..10) |_| {
+        ctx.wg.start();
+        try pool.spawn(.ui, .{ .func = Ctx.fanOut, .ctx = &ctx });
+    }
+
+    pool.waitAndWork(&ctx.wg);
+    try std.testing.expectEqual(1000, ctx.sum.load(.monotonic));
+}
+
+test "flecs-style tasks run concurrently" {
+    const pool = try Self.create(std.testing.allocator, .{ .workers = 2 });
+    defer pool.destroy();
+
+    const prev = global.swap(pool, .acq_rel);
+    defer global.store(prev, .release);
+
+    // Like flecs' workers, each task waits until all of them have started.
+    const Barrier = struct {
+        arrived: std.atomic.Value(u32) = std.atomic.Value(u32).init(0),
+
+        fn run(param: ?*anyopaque) callconv(.C) ?*anyopaque {
+            const this: *@This() = @alignCast(@ptrCast(param.?));
+            _ = this.arrived.fetchAdd(1, .acq_rel);
+            while (this.arrived.load(.acquire) < 2) std.Thread.yield() catch {};
+            return param;
+        }
+    };
+
+    var barrier = Barrier{};
+    const t0 = taskNew(Barrier.run, &barrier);
+    const t1 = taskNew(Barrier.run, &barrier);
+    try std.testing.expect(t0 != 0 and t1 != 0);
+
+    try std.testing.expectEqual(@as(?*anyopaque, &barrier), taskJoin(t0));
+    try std.testing.expectEqual(@as(?*anyopaque, &barrier), taskJoin(t1));
+}
+
+test "spawnWg" {
+    const pool = try Self.create(std.testing.allocator, .{ .workers = 2 });
+    defer pool.destroy();
+
+    const Sum = struct {
+        fn add(sum: *std.atomic.Value(usize), n: usize) void {
+            _ = sum.fetchAdd(n, .monotonic);
+        }
+    };
+
+    var sum = std.atomic.Value(usize).init(0);
+    var wg = std.Thread.WaitGroup{};
+
+    for (1..101) |n| pool.spawnWg(.background, &wg, Sum.add, .{ &sum, n });
+
+    pool.waitAndWork(&wg);
+    try std.testing.expectEqual(5050, sum.load(.monotonic));
+}
@@ -7,6 +7,7 @@ pub const BoomRng = @import("BoomRng.zig");
 pub const ContentId = @import("contentid.zig").ContentId;
 pub const fxp = @import("fxp.zig");
 pub const gamemode = if (builtin.is_test) void else @import("gamemode.zig");
+pub const JobPool = @import("jobpool");
 pub const stdx = @import("stdx.zig");
 
 pub const Fxp = fxp.Fxp;
@@ -170,3 +170,20 @@ pub const all = [_]Checksums{
     tnt_psn,
     tnt_kex,
 };
+
+/// A SHA-1 digest of a level's lumps (in the order given), for use as a
+/// content-addressed key; e.g. by `nodebuild.Cache`. Each lump's length is
+/// hashed ahead of its bytes, so moving data between adjacent lumps changes
+/// the digest.
+pub fn level(lumps: []const []const u8) [20]u8 {
+    var hasher = std.crypto.hash.Sha1.init(.{});
+
+    for (lumps) |lump| {
+        var len: [8]u8 = undefined;
+        std.mem.writeInt(u64, &len, lump.len, .little);
+        hasher.update(&len);
+        hasher.update(lump);
+    }
+
+    return hasher.finalResult();
+}
@@ -2,22 +2,51 @@
 //!
 //! Currently this is [ZNBX], but a long-term goal is to replace it with a pure-Zig port.
 //!
+//! ZNBX makes no guarantee that separate processors share no global state, so
+//! `NodeBuilder` only lets one of them be alive at a time, process-wide; see
+//! `NodeBuilder.init`. `buildAll` spreads a batch of levels' hashing and
+//! `Cache` I/O across threads and skips rebuilding levels whose nodes are
+//! already cached, but its builds still run one after another.
+//!
 //! [node builder]: https://doomwiki.org/wiki/Node_builder
 //! [ZNBX]: https://github.com/jerome-trc/znbx
 
 const std = @import("std");
 
+const JobPool = @import("jobpool");
+
 const c = @cImport({
     @cInclude("znbx.h");
 });
 const root = @import("root.zig");
+const hashes = root.hashes;
 const Node = root.Node;
 
+pub const Flavor = enum { vanilla, extended };
+
+/// Mixed into every `Level.key`. Bump this whenever a change to ZNBX, to its
+/// defaults or to the layout of `Node` would change the nodes of a level, so
+/// that stale `Cache` entries stop being hits.
+pub const cache_version: u32 = 1;
+
+pub const Config = struct {
+    aa_preference: i32 = c.AA_PREFERENCE_DEFAULT,
+    max_segs: i32 = c.MAX_SEGS_DEFAULT,
+    split_cost: i32 = c.SPLIT_COST_DEFAULT,
+};
+
 pub const NodeBuilder = opaque {
     pub const NodeVisitor = fn (anytype, *const Node) void;
 
+    /// One permit, held from a successful `init` or `initUdmf` until `deinit`.
+    /// A semaphore rather than a mutex, so that a builder may be destroyed by
+    /// a different thread than the one which created it.
+    var alive = std.Thread.Semaphore{ .permits = 1 };
+
+    /// Blocks while another `NodeBuilder` is alive, on any thread, so never
+    /// call this while the calling thread holds one itself.
     pub fn init(
-        flavor: enum { vanilla, extended },
+        flavor: Flavor,
         level_name: [8:0]u8,
         things: []const u8,
         vertices: []const u8,
@@ -34,6 +63,9 @@ pub const NodeBuilder = opaque {
             .sectors = c.znbx_SliceU8{ .ptr = sectors.ptr, .len = sectors.len },
         };
 
+        alive.wait();
+        errdefer alive.post();
+
         const ret = switch (flavor) {
             .vanilla => c.znbx_processor_new_vanilla(level) orelse return error.InitFail,
             .extended => c.znbx_processor_new_extended(level) orelse return error.InitFail,
@@ -42,10 +74,14 @@ pub const NodeBuilder = opaque {
         return @as(*@This(), @ptrCast(ret));
     }
 
+    /// Blocks like `init`.
     pub fn initUdmf(
         level_name: [8:0]u8,
         textmap: []const u8,
     ) Error!*NodeBuilder {
+        alive.wait();
+        errdefer alive.post();
+
         const level = c.znbx_Level{
             .name = level_name,
             .textmap = c.znbx_SliceU8{ .ptr = textmap.ptr, .len = textmap.len },
@@ -56,17 +92,14 @@ pub const NodeBuilder = opaque {
 
     pub fn deinit(self: *NodeBuilder) void {
         c.znbx_processor_destroy(@ptrCast(self));
+        alive.post();
     }
 
     pub fn run(self: *NodeBuilder) void {
         c.znbx_processor_run(@ptrCast(self), null);
     }
 
-    pub fn runWith(self: *NodeBuilder, config: struct {
-        aa_preference: i32 = c.AA_PREFERENCE_DEFAULT,
-        max_segs: i32 = c.MAX_SEGS_DEFAULT,
-        split_cost: i32 = c.SPLIT_COST_DEFAULT,
-    }) void {
+    pub fn runWith(self: *NodeBuilder, config: Config) void {
         const cfg = c.znbx_NodeConfig{
             .aa_preference = config.aa_preference,
             .max_segs = config.max_segs,
@@ -91,8 +124,223 @@ pub const NodeBuilder = opaque {
 
         c.znbx_processor_nodes_foreach(@ptrCast(self), context, callback.callback);
     }
+
+    /// Copies every node built by the last `run` or `runWith` into a new slice
+    /// owned by the caller.
+    pub fn collectNodes(self: *NodeBuilder, allocator: std.mem.Allocator) std.mem.Allocator.Error![]Node {
+        var ctx = struct {
+            nodes: std.ArrayList(Node),
+            oom: bool = false,
+
+            pub fn foreach(this: *@This(), node: *const Node) void {
+                this.nodes.append(node.*) catch {
+                    this.oom = true;
+                };
+            }
+        }{
+            .nodes = std.ArrayList(Node).init(allocator),
+        };
+        errdefer ctx.nodes.deinit();
+
+        self.foreachNode(&ctx);
+        if (ctx.oom) return error.OutOfMemory;
+        return try ctx.nodes.toOwnedSlice();
+    }
 };
 
+/// The inputs to one node build; the lumps are borrowed, not owned.
+pub const Level = struct {
+    flavor: Flavor,
+    name: [8:0]u8,
+    things: []const u8,
+    vertices: []const u8,
+    linedefs: []const u8,
+    sidedefs: []const u8,
+    sectors: []const u8,
+
+    /// The key under which this level's nodes are stored in a `Cache`.
+    /// The level's name is deliberately left out, so identical geometry
+    /// under a different map slot is still a cache hit.
+    pub fn key(self: *const Level, config: Config) Cache.Key {
+        const lumps = hashes.level(&[_][]const u8{
+            self.things,
+            self.vertices,
+            self.linedefs,
+            self.sidedefs,
+            self.sectors,
+        });
+
+        var hasher = std.crypto.hash.Sha1.init(.{});
+
+        var version: [4]u8 = undefined;
+        std.mem.writeInt(u32, &version, cache_version, .little);
+        hasher.update(&version);
+
+        hasher.update(&lumps);
+        hasher.update(&[_]u8{@intFromEnum(self.flavor)});
+
+        inline for (.{ config.aa_preference, config.max_segs, config.split_cost }) |param| {
+            var bytes: [4]u8 = undefined;
+            std.mem.writeInt(i32, &bytes, param, .little);
+            hasher.update(&bytes);
+        }
+
+        return hasher.finalResult();
+    }
+};
+
+/// A directory of previously-built nodes, one file per `Level.key`.
+/// Safe to share between threads and processes, since entries are only ever
+/// written whole via an atomic rename.
+pub const Cache = struct {
+    pub const Key = [20]u8;
+
+    dir: std.fs.Dir,
+
+    /// Returns `null` on a miss, including when the entry is unreadable or
+    /// malformed; the caller is then expected to rebuild and `put` it.
+    pub fn get(self: Cache, allocator: std.mem.Allocator, key: Key) std.mem.Allocator.Error!?[]Node {
+        const path = fileName(key);
+        const file = self.dir.openFile(&path, .{}) catch return null;
+        defer file.close();
+
+        const size = file.getEndPos() catch return null;
+        if (size % @sizeOf(Node) != 0) return null;
+
+        const nodes = try allocator.alloc(Node, @intCast(size / @sizeOf(Node)));
+        errdefer allocator.free(nodes);
+
+        const bytes = std.mem.sliceAsBytes(nodes);
+        const n = file.readAll(bytes) catch 0;
+
+        if (n != bytes.len) {
+            allocator.free(nodes);
+            return null;
+        }
+
+        return nodes;
+    }
+
+    pub fn put(self: Cache, key: Key, nodes: []const Node) !void {
+        const path = fileName(key);
+        var af = try self.dir.atomicFile(&path, .{});
+        defer af.deinit();
+        try af.file.writeAll(std.mem.sliceAsBytes(nodes));
+        try af.finish();
+    }
+
+    const file_name_len = @sizeOf(Key) * 2 + ".nodes".len;
+
+    fn fileName(key: Key) [file_name_len]u8 {
+        var ret: [file_name_len]u8 = undefined;
+        _ = std.fmt.bufPrint(&ret, "{s}.nodes", .{std.fmt.fmtSliceHexLower(&key)}) catch unreachable;
+        return ret;
+    }
+};
+
+/// One level's worth of work for `buildAll`.
+pub const Job = struct {
+    level: Level,
+    config: Config = .{},
+
+    /// Set by `buildAll`; allocated by the allocator passed to it.
+    nodes: []Node = &.{},
+    /// Set by `buildAll` if `nodes` came from the cache rather than ZNBX.
+    cached: bool = false,
+    /// Set by `buildAll` if this level could not be built.
+    err: ?BuildError = null,
+};
+
+pub const BuildError = Error || std.mem.Allocator.Error;
+
+/// Builds nodes for every job in `jobs`, one `NodeBuilder` per job. Blocks
+/// until all jobs are done; failures are reported per job through `Job.err`.
+/// `allocator` must be thread-safe.
+///
+/// Key hashing and cache reads and writes run as `background` jobs on `pool`,
+/// but the builds themselves run one at a time on the calling thread (see the
+/// module documentation), so that no worker blocks waiting for one.
+///
+/// If `cache` is given, levels with an entry in it are not rebuilt, and newly
+/// built levels are added to it. Failing to write an entry is not an error,
+/// since the nodes themselves were still built.
+pub fn buildAll(
+    allocator: std.mem.Allocator,
+    pool: *JobPool,
+    cache: ?Cache,
+    jobs: []Job,
+) void {
+    const keys = allocator.alloc(Cache.Key, if (cache != null) jobs.len else 0) catch |err| {
+        for (jobs) |*job| job.err = err;
+        return;
+    };
+    defer allocator.free(keys);
+
+    if (cache) |ch| {
+        var lookups = std.Thread.WaitGroup{};
+
+        for (jobs, keys) |*job, *key| {
+            pool.spawnWg(.background, &lookups, lookUp, .{ allocator, ch, job, key });
+        }
+
+        pool.waitAndWork(&lookups);
+    }
+
+    var stores = std.Thread.WaitGroup{};
+    // Must run before `keys` is freed.
+    defer pool.waitAndWork(&stores);
+
+    for (jobs, 0..) |*job, i| {
+        if (job.cached or job.err != null) continue;
+
+        buildOne(allocator, job);
+        if (job.err != null) continue;
+
+        if (cache) |ch| pool.spawnWg(.background, &stores, store, .{ ch, &keys[i], job });
+    }
+}
+
+fn lookUp(allocator: std.mem.Allocator, cache: Cache, job: *Job, key: *Cache.Key) void {
+    key.* = job.level.key(job.config);
+
+    const hit = cache.get(allocator, key.*) catch |err| {
+        job.err = err;
+        return;
+    };
+
+    if (hit) |nodes| {
+        job.nodes = nodes;
+        job.cached = true;
+    }
+}
+
+fn buildOne(allocator: std.mem.Allocator, job: *Job) void {
+    const builder = NodeBuilder.init(
+        job.level.flavor,
+        job.level.name,
+        job.level.things,
+        job.level.vertices,
+        job.level.linedefs,
+        job.level.sidedefs,
+        job.level.sectors,
+    ) catch |err| {
+        job.err = err;
+        return;
+    };
+    defer builder.deinit();
+
+    builder.runWith(job.config);
+
+    job.nodes = builder.collectNodes(allocator) catch |err| {
+        job.err = err;
+        return;
+    };
+}
+
+fn store(cache: Cache, key: *const Cache.Key, job: *const Job) void {
+    cache.put(key.*, job.nodes) catch {};
+}
+
 pub const Error = error{
     InitFail,
 };
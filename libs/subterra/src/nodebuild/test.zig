@@ -1,5 +1,7 @@
 const std = @import("std");
 
+const JobPool = @import("jobpool");
+
 const root = @import("../root.zig");
 const nb = root.nodebuild;
 const Node = root.Node;
@@ -57,3 +59,50 @@ test "Node builder, vanilla, smoke" {
     // TODO: copy over the unit tests from Rust once the standard library's MD5
     // implementation stabilizes.
 }
+
+test "Node builder, batch, cached" {
+    const f = try std.fs.cwd().openFile("sample/freedoom2/map01.wad", .{});
+    defer f.close();
+
+    const bytes = try f.readToEndAlloc(std.testing.allocator, 1024 * 128);
+    defer std.testing.allocator.free(bytes);
+
+    const level = nb.Level{
+        .flavor = .vanilla,
+        .name = [8:0]u8{ 'M', 'A', 'P', '0', '1', 0, 0, 0 },
+        .things = bytes[12..1632],
+        .linedefs = bytes[1632..16598],
+        .sidedefs = bytes[16598..66578],
+        .vertices = bytes[66578..70610],
+        .sectors = bytes[(70610 + 22056 + 2212 + 15456)..][0..5148],
+    };
+
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+
+    const pool = try JobPool.create(std.testing.allocator, .{ .workers = 2 });
+    defer pool.destroy();
+
+    const cache = nb.Cache{ .dir = tmp.dir };
+
+    var jobs = [_]nb.Job{ .{ .level = level }, .{ .level = level, .config = .{ .split_cost = 16 } } };
+    nb.buildAll(std.testing.allocator, pool, cache, &jobs);
+    defer for (jobs) |job| std.testing.allocator.free(job.nodes);
+
+    for (jobs) |job| {
+        try std.testing.expectEqual(null, job.err);
+        try std.testing.expect(!job.cached);
+        try std.testing.expect(job.nodes.len > 0);
+    }
+
+    var rerun = [_]nb.Job{.{ .level = level }};
+    nb.buildAll(std.testing.allocator, pool, cache, &rerun);
+    defer std.testing.allocator.free(rerun[0].nodes);
+
+    try std.testing.expect(rerun[0].cached);
+    try std.testing.expectEqualSlices(
+        u8,
+        std.mem.sliceAsBytes(jobs[0].nodes),
+        std.mem.sliceAsBytes(rerun[0].nodes),
+    );
+}
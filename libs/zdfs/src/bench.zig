@@ -0,0 +1,84 @@
+//! Times mounting a set of archives with repeated `VirtualFs.mount` calls
+//! against `VirtualFs.mountAll`, with the page cache both cold and warm.
+//! Build and run with `zig build bench-zdfs -- <archives...>`.
+//! Output is one `name value unit` line per measurement.
+//!
+//! A cold cache is approximated by asking the kernel to drop each archive's
+//! clean pages (`POSIX_FADV_DONTNEED`) before every round, which needs no
+//! privileges; this is Linux-only, so elsewhere only warm timings are printed.
+
+const builtin = @import("builtin");
+const std = @import("std");
+
+const JobPool = @import("jobpool");
+const zdfs = @import("zdfs");
+
+const rounds = 5;
+
+pub fn main() !void {
+    var gpa = std.heap.GeneralPurposeAllocator(.{}){};
+    defer _ = gpa.deinit();
+    const allocator = gpa.allocator();
+
+    const args = try std.process.argsAlloc(allocator);
+    defer std.process.argsFree(allocator, args);
+
+    if (args.len < 2) {
+        std.debug.print("usage: {s} <archives...>\n", .{args[0]});
+        return error.NoArchives;
+    }
+
+    const paths = args[1..];
+    zdfs.setMainThread();
+
+    const pool = try JobPool.create(allocator, .{});
+    defer pool.destroy();
+
+    const stdout = std.io.getStdOut().writer();
+    try stdout.print("archives {} count\n", .{paths.len});
+
+    const caches: []const bool = if (builtin.os.tag == .linux)
+        &.{ true, false }
+    else
+        &.{false};
+
+    for (caches) |cold| {
+        const cache = if (cold) "cold" else "warm";
+
+        for ([_]bool{ false, true }) |all| {
+            var total: u64 = 0;
+
+            for (0..rounds) |_| {
+                if (cold) evict(paths);
+
+                const vfs = try zdfs.VirtualFs.init();
+                defer vfs.deinit();
+
+                var timer = try std.time.Timer.start();
+
+                if (all) {
+                    try vfs.mountAll(allocator, pool, paths);
+                } else {
+                    for (paths) |path| try vfs.mount(path);
+                    vfs.initHashChains();
+                }
+
+                total += timer.read();
+            }
+
+            try stdout.print("{s}_{s} {d:.3} ms\n", .{
+                if (all) "mount_all" else "mount_serial",
+                cache,
+                @as(f64, @floatFromInt(total / rounds)) / std.time.ns_per_ms,
+            });
+        }
+    }
+}
+
+fn evict(paths: []const [:0]const u8) void {
+    for (paths) |path| {
+        const file = std.fs.cwd().openFileZ(path, .{}) catch continue;
+        defer file.close();
+        _ = std.os.linux.fadvise(file.handle, 0, 0, std.os.linux.POSIX_FADV.DONTNEED);
+    }
+}
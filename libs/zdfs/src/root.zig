@@ -1,8 +1,11 @@
 //! Wrapper around ZDFS' C API for more ergonomic use by Zig code.
 
+const builtin = @import("builtin");
 const std = @import("std");
 const log = std.log.scoped(.zdfs);
 
+const JobPool = @import("jobpool");
+
 const c = @cImport(@cInclude("zdfs/zdfs.h"));
 
 pub const LumpNum = i32;
@@ -45,6 +48,49 @@ pub const VirtualFs = packed struct {
         if (!c.zdfs_fs_mount(self.ptr, path)) return Error.MountFail;
     }
 
+    /// Mounts every archive in `paths`, in order, then calls `initHashChains`.
+    ///
+    /// Parsing is not parallelized: ZDFS only parses archives on the main
+    /// thread, one at a time, exactly as repeated calls to `mount` would.
+    /// What `pool` is used for is warming the page cache; `background` jobs
+    /// memory-map each archive and fault in `prefetch_window` bytes at either
+    /// end, where directories live. This only helps when the archives are not
+    /// already cached (first launch, spinning disks, network mounts); with a
+    /// warm cache it costs a few `mmap` calls and gains nothing.
+    /// `zig build bench-zdfs -- <archives...>` measures both cases.
+    ///
+    /// Stops at the first archive which fails to mount; the archives before it
+    /// stay mounted, but hash chains are not initialized.
+    pub fn mountAll(
+        self: Self,
+        allocator: std.mem.Allocator,
+        pool: *JobPool,
+        paths: []const [:0]const u8,
+    ) (Error || std.mem.Allocator.Error)!void {
+        const events = try allocator.alloc(std.Thread.ResetEvent, paths.len);
+        defer allocator.free(events);
+        @memset(events, .{});
+
+        var wg = std.Thread.WaitGroup{};
+        // Must run before `events` is freed, including when a mount fails.
+        defer pool.waitAndWork(&wg);
+
+        for (paths, events) |path, *event| {
+            pool.spawnWg(.background, &wg, prefetch, .{ path, event });
+        }
+
+        for (paths, events) |path, *event| {
+            // Rather than idle, run this prefetch (or any other job) here.
+            while (!event.isSet()) {
+                if (!pool.help()) event.wait();
+            }
+
+            try self.mount(path);
+        }
+
+        self.initHashChains();
+    }
+
     pub fn numEntries(self: Self) usize {
         return c.zdfs_fs_num_entries(self.ptr);
     }
@@ -59,6 +105,47 @@ pub const Error = error{
     MountFail,
 };
 
+/// How much of each end of an archive `prefetch` faults in. WADs, zips and 7z
+/// archives all keep their directories at (or point to them from) one end.
+const prefetch_window = 1024 * 1024;
+
+/// Best-effort; any failure here is left for `zdfs_fs_mount` to report.
+fn prefetch(path: [:0]const u8, done: *std.Thread.ResetEvent) void {
+    defer done.set();
+
+    if (builtin.os.tag == .windows) return;
+
+    const file = std.fs.cwd().openFileZ(path, .{}) catch return;
+    defer file.close();
+
+    const len = file.getEndPos() catch return;
+    if (len == 0) return;
+
+    const map = std.posix.mmap(
+        null,
+        len,
+        std.posix.PROT.READ,
+        .{ .TYPE = .PRIVATE },
+        file.handle,
+        0,
+    ) catch return;
+    defer std.posix.munmap(map);
+
+    const head = map[0..@min(len, prefetch_window)];
+    const tail = map[(len - @min(len, prefetch_window))..];
+    var sum: u8 = 0;
+
+    for ([_][]const u8{ head, tail }) |region| {
+        var i: usize = 0;
+
+        while (i < region.len) : (i += std.mem.page_size) {
+            sum +%= region[i];
+        }
+    }
+
+    std.mem.doNotOptimizeAway(sum);
+}
+
 extern "C" fn vsnprintf(
     buffer: [*c]u8,
     bufsz: usize,
@@ -108,3 +195,19 @@ test "mount single" {
     try vfs.mount(path_buf[0..]);
     try std.testing.expectEqual(1, vfs.numEntries());
 }
+
+test "mount all" {
+    var vfs = try VirtualFs.init();
+    defer vfs.deinit();
+
+    const pool = try JobPool.create(std.testing.allocator, .{ .workers = 2 });
+    defer pool.destroy();
+
+    var path_buf: [std.c.PATH_MAX:0]u8 = [1:0]u8{0} ** std.c.PATH_MAX;
+    const path = try std.fs.cwd().realpathZ("libs/zdfs/src/root.zig", path_buf[0..]);
+    path_buf[path.len] = 0;
+
+    const paths = [_][:0]const u8{ path_buf[0..path.len :0], path_buf[0..path.len :0] };
+    try vfs.mountAll(std.testing.allocator, pool, &paths);
+    try std.testing.expectEqual(2, vfs.numEntries());
+}
@@ -0,0 +1,302 @@
+//! Decode-ahead streaming.
+//!
+//! A dedicated thread renders a stream source (e.g. a ZMSX song) into a
+//! lock-free single-producer, single-consumer ring of buffers, several buffers
+//! ahead of playback. The audio callback only ever copies out of the ring, so
+//! an expensive synth or a contended lock on the decode side costs latency
+//! headroom instead of causing an underrun.
+
+const std = @import("std");
+
+const Self = @This();
+
+pub const Source = struct {
+    ctx: *anyopaque,
+    /// Must fill all of `buf`, padding with silence if need be. Returns `false`
+    /// once the stream has ended; `buf` is still played in that case.
+    fill: *const fn (ctx: *anyopaque, buf: []u8) bool,
+};
+
+pub const Config = struct {
+    /// Size of each buffer in the ring, in bytes. One audio device period is a
+    /// good choice.
+    buffer_size: usize = 4096,
+    /// How many buffers the decode thread may run ahead of playback by.
+    /// Added latency is `depth * buffer_size` bytes' worth of audio.
+    /// Must be a power of two, so that buffer indices stay in order when the
+    /// buffer counters wrap.
+    depth: u32 = 4,
+    /// Upper bound on how long the decode thread sleeps while the ring is full
+    /// before re-checking it, in case a wakeup is missed.
+    poll_ns: u64 = 5 * std.time.ns_per_ms,
+};
+
+/// Counters which can be read from any thread at any time.
+pub const Stats = struct {
+    /// How many times `read` could not fill its output entirely.
+    underruns: u64,
+    /// How many bytes of silence `read` substituted due to underruns.
+    underrun_bytes: u64,
+    /// How many buffers the source has rendered so far.
+    buffers_decoded: u64,
+};
+
+allocator: std.mem.Allocator,
+source: Source,
+config: Config,
+thread: std.Thread,
+/// `config.depth * config.buffer_size` bytes.
+ring: []u8,
+
+/// Count of buffers published by the decode thread. Wraps.
+head: std.atomic.Value(u32),
+/// Count of buffers released by `read`. Wraps.
+tail: std.atomic.Value(u32),
+/// Consumer-only: how far into the buffer at `tail` has been read.
+read_offset: usize,
+
+running: std.atomic.Value(bool),
+ended: std.atomic.Value(bool),
+/// Set by the decode thread while it sleeps on a full ring, so that `read`
+/// only makes the wake syscall when there is someone to wake.
+producer_waiting: std.atomic.Value(bool),
+
+underruns: std.atomic.Value(u64),
+underrun_bytes: std.atomic.Value(u64),
+buffers_decoded: std.atomic.Value(u64),
+
+/// Fills the whole ring on the calling thread, then starts the decode thread.
+pub fn create(allocator: std.mem.Allocator, source: Source, config: Config) !*Self {
+    std.debug.assert(config.buffer_size > 0);
+    std.debug.assert(std.math.isPowerOfTwo(config.depth));
+
+    const self = try allocator.create(Self);
+    errdefer allocator.destroy(self);
+
+    const ring = try allocator.alloc(u8, config.buffer_size * config.depth);
+    errdefer allocator.free(ring);
+
+    self.* = Self{
+        .allocator = allocator,
+        .source = source,
+        .config = config,
+        .thread = undefined,
+        .ring = ring,
+        .head = std.atomic.Value(u32).init(0),
+        .tail = std.atomic.Value(u32).init(0),
+        .read_offset = 0,
+        .running = std.atomic.Value(bool).init(true),
+        .ended = std.atomic.Value(bool).init(false),
+        .producer_waiting = std.atomic.Value(bool).init(false),
+        .underruns = std.atomic.Value(u64).init(0),
+        .underrun_bytes = std.atomic.Value(u64).init(0),
+        .buffers_decoded = std.atomic.Value(u64).init(0),
+    };
+
+    while (self.head.raw < config.depth and !self.ended.raw) {
+        self.decodeOne();
+    }
+
+    self.thread = try std.Thread.spawn(.{}, decodeLoop, .{self});
+    return self;
+}
+
+/// Stops and joins the decode thread. Any in-progress `Source.fill` call
+/// is allowed to finish first.
+pub fn destroy(self: *Self) void {
+    self.running.store(false, .release);
+    std.Thread.Futex.wake(&self.tail, 1);
+    self.thread.join();
+
+    self.allocator.free(self.ring);
+    self.allocator.destroy(self);
+}
+
+/// Copies the next `out.len` bytes of the stream into `out`. Never blocks or
+/// allocates, and only makes a syscall to wake the decode thread if it is
+/// waiting for room, so it is safe to call from an audio callback. If the decode
+/// thread has fallen behind, the remainder of `out` is filled with zeroes and
+/// counted as an underrun; after the stream ends, it is simply zero-filled.
+///
+/// Only one thread may call this at a time.
+pub fn read(self: *Self, out: []u8) void {
+    var written: usize = 0;
+
+    while (written < out.len) {
+        const tail = self.tail.raw;
+
+        if (self.head.load(.acquire) == tail) {
+            // The last buffer is published before `ended` is set, so it may
+            // have arrived since `head` was loaded.
+            const ended = self.ended.load(.acquire);
+            if (ended and self.head.load(.acquire) != tail) continue;
+
+            @memset(out[written..], 0);
+
+            if (!ended) {
+                _ = self.underruns.fetchAdd(1, .monotonic);
+                _ = self.underrun_bytes.fetchAdd(out.len - written, .monotonic);
+            }
+
+            return;
+        }
+
+        const buf = self.buffer(tail)[self.read_offset..];
+        const n = @min(buf.len, out.len - written);
+        @memcpy(out[written..][0..n], buf[0..n]);
+        written += n;
+        self.read_offset += n;
+
+        if (self.read_offset == self.config.buffer_size) {
+            self.read_offset = 0;
+            // Sequentially consistent, paired with `decodeLoop`: either this
+            // sees `producer_waiting` set, or the producer sees the new `tail`.
+            self.tail.store(tail +% 1, .seq_cst);
+
+            if (self.producer_waiting.load(.seq_cst)) {
+                std.Thread.Futex.wake(&self.tail, 1);
+            }
+        }
+    }
+}
+
+/// How many bytes `read` can currently return without underrunning.
+/// Only meaningful on the thread which calls `read`.
+pub fn available(self: *const Self) usize {
+    const buffers = self.head.load(.acquire) -% self.tail.raw;
+    return buffers * self.config.buffer_size - self.read_offset;
+}
+
+/// `false` once the source has ended and everything it rendered has been read.
+pub fn isPlaying(self: *const Self) bool {
+    return !self.ended.load(.acquire) or self.head.load(.acquire) != self.tail.load(.acquire);
+}
+
+pub fn stats(self: *const Self) Stats {
+    return Stats{
+        .underruns = self.underruns.load(.monotonic),
+        .underrun_bytes = self.underrun_bytes.load(.monotonic),
+        .buffers_decoded = self.buffers_decoded.load(.monotonic),
+    };
+}
+
+fn buffer(self: *const Self, count: u32) []u8 {
+    const i = count & (self.config.depth - 1);
+    return self.ring[(i * self.config.buffer_size)..][0..self.config.buffer_size];
+}
+
+/// Producer-only; the caller ensures there is a free buffer.
+fn decodeOne(self: *Self) void {
+    const head = self.head.raw;
+    const more = self.source.fill(self.source.ctx, self.buffer(head));
+    _ = self.buffers_decoded.fetchAdd(1, .monotonic);
+
+    // `head` first: a consumer which sees `ended` must also see the last buffer.
+    self.head.store(head +% 1, .release);
+    if (!more) self.ended.store(true, .release);
+}
+
+fn decodeLoop(self: *Self) void {
+    while (self.running.load(.acquire) and !self.ended.load(.monotonic)) {
+        const tail = self.tail.load(.acquire);
+
+        if (self.head.raw -% tail == self.config.depth) {
+            self.producer_waiting.store(true, .seq_cst);
+            defer self.producer_waiting.store(false, .monotonic);
+
+            // Re-check after publishing `producer_waiting`, in case `read`
+            // released a buffer before it could see the flag.
+            if (self.tail.load(.seq_cst) == tail) {
+                std.Thread.Futex.timedWait(&self.tail, tail, self.config.poll_ns) catch {};
+            }
+
+            continue;
+        }
+
+        self.decodeOne();
+    }
+}
+
+test "in order, no underruns" {
+    const Counter = struct {
+        next: u8 = 0,
+        remaining: usize = 64,
+
+        fn fill(ctx: *anyopaque, buf: []u8) bool {
+            const this: *@This() = @alignCast(@ptrCast(ctx));
+
+            for (buf) |*b| {
+                b.* = this.next;
+                this.next +%= 1;
+            }
+
+            this.remaining -= 1;
+            return this.remaining > 0;
+        }
+    };
+
+    var counter = Counter{};
+    const stream = try Self.create(std.testing.allocator, .{
+        .ctx = &counter,
+        .fill = Counter.fill,
+    }, .{ .buffer_size = 256, .depth = 2 });
+    defer stream.destroy();
+
+    var expected: u8 = 0;
+    var out: [100]u8 = undefined;
+    var total: usize = 0;
+
+    while (total < 64 * 256) {
+        const n = @min(out.len, 64 * 256 - total);
+        while (stream.available() < n) std.Thread.yield() catch {};
+
+        stream.read(out[0..n]);
+
+        for (out[0..n]) |b| {
+            try std.testing.expectEqual(expected, b);
+            expected +%= 1;
+        }
+
+        total += n;
+    }
+
+    try std.testing.expect(!stream.isPlaying());
+    try std.testing.expectEqual(64, stream.stats().buffers_decoded);
+    try std.testing.expectEqual(0, stream.stats().underruns);
+
+    // Reading past the end yields silence without counting as an underrun.
+    stream.read(out[0..]);
+    try std.testing.expectEqual(0, std.mem.max(u8, out[0..]));
+    try std.testing.expectEqual(0, stream.stats().underruns);
+}
+
+test "underrun" {
+    const Stalled = struct {
+        started: bool = false,
+        release: std.Thread.ResetEvent = .{},
+
+        fn fill(ctx: *anyopaque, buf: []u8) bool {
+            const this: *@This() = @alignCast(@ptrCast(ctx));
+            if (this.started) this.release.wait();
+            this.started = true;
+            @memset(buf, 1);
+            return true;
+        }
+    };
+
+    var stalled = Stalled{};
+    const stream = try Self.create(std.testing.allocator, .{
+        .ctx = &stalled,
+        .fill = Stalled.fill,
+    }, .{ .buffer_size = 64, .depth = 1 });
+    defer stream.destroy();
+    defer stalled.release.set();
+
+    var out: [96]u8 = undefined;
+    stream.read(out[0..]);
+
+    try std.testing.expectEqual(1, std.mem.min(u8, out[0..64]));
+    try std.testing.expectEqual(0, std.mem.max(u8, out[64..]));
+    try std.testing.expectEqual(1, stream.stats().underruns);
+    try std.testing.expectEqual(32, stream.stats().underrun_bytes);
+}
@@ -9,9 +9,15 @@ const std = @import("std");
 
 const c = @cImport(@cInclude("zmsx.h"));
 
+pub const DecodeAhead = @import("DecodeAhead.zig");
+
 test "smoke" {
     var out_count: c_int = 0;
     const devices = c.zmsx_get_midi_devices(&out_count);
     try std.testing.expect(devices != null);
     try std.testing.expect(out_count > 0);
 }
+
+test {
+    std.testing.refAllDecls(@This());
+}